@@ -22,6 +22,7 @@
 #include <range/v3/action/concepts.hpp>
 #include <range/v3/algorithm/max.hpp>
 #include <range/v3/iterator/common_iterator.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -171,6 +172,39 @@ namespace ranges
                 auto pos = insert_reserve_helper(cont, std::move(p), delta);
                 return cont.insert(pos, C{ranges::begin(rng)}, C{ranges::end(rng)});
             }
+
+            struct size_hinted_tag
+            {};
+
+            // A range that does not know its size but can bound it gets room
+            // for as many elements as it is sure to have.
+            template(typename Cont, typename I, typename Rng)(
+                /// \pre
+                requires random_access_reservable<Cont> AND
+                    ranges::detail::size_hinted_<Rng>)
+            auto insert_impl(Cont && cont_, I p, Rng && rng, size_hinted_tag)
+                -> decltype(unwrap_reference(cont_).insert(
+                    begin(unwrap_reference(cont_)),
+                    range_cpp17_iterator_t<Rng>{ranges::begin(rng)},
+                    range_cpp17_iterator_t<Rng>{ranges::end(rng)}))
+            {
+                using C = range_cpp17_iterator_t<Rng>;
+                auto && cont = unwrap_reference(cont_);
+                auto const room = cont.max_size() - ranges::size(cont);
+                auto const n =
+                    ranges::detail::size_hint_reserve_(ranges::size_hint(rng));
+                auto const delta = static_cast<range_size_t<Cont>>(
+                    n < static_cast<std::size_t>(room) ? n : room);
+                auto pos = insert_reserve_helper(cont, std::move(p), delta);
+                return cont.insert(pos, C{ranges::begin(rng)}, C{ranges::end(rng)});
+            }
+
+            template<typename Cont, typename Rng>
+            using insert_reserve_t = meta::if_c<
+                random_access_reservable<Cont> && sized_range<Rng>, std::true_type,
+                meta::if_c<random_access_reservable<Cont> &&
+                               ranges::detail::size_hinted_<Rng>,
+                           size_hinted_tag, std::false_type>>;
         } // namespace detail
         /// \endcond
 
@@ -202,13 +236,12 @@ namespace ranges
         auto insert(Cont && cont, I p, Rng && rng)
             -> decltype(detail::insert_impl(
                 static_cast<Cont &&>(cont), std::move(p), static_cast<Rng &&>(rng),
-                meta::bool_<random_access_reservable<Cont> && sized_range<Rng>>{}))
+                detail::insert_reserve_t<Cont, Rng>{}))
         {
             return detail::insert_impl(static_cast<Cont &&>(cont),
                                        std::move(p),
                                        static_cast<Rng &&>(rng),
-                                       meta::bool_<random_access_reservable<Cont> &&
-                                                   sized_range<Rng>>{});
+                                       detail::insert_reserve_t<Cont, Rng>{});
         }
 
         struct insert_fn
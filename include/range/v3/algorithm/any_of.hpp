@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_ALGORITHM_ANY_OF_HPP
 #define RANGES_V3_ALGORITHM_ANY_OF_HPP
 
+#include <type_traits>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -27,12 +28,39 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename F, typename P>
+        bool any_of_(I first, S last, F & pred, P & proj, std::false_type)
+        {
+            for(; first != last; ++first)
+                if(invoke(pred, invoke(proj, *first)))
+                    return true;
+            return false;
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        bool any_of_(I first, S last, F & pred, P & proj, std::true_type)
+        {
+            bool found = false;
+            auto no_match = [&](auto && ref) {
+                found = invoke(pred, invoke(proj, static_cast<decltype(ref)>(ref)));
+                return !found;
+            };
+            detail::for_each_while_(std::move(first), std::move(last), no_match);
+            return found;
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(any_of)
 
         /// \brief function template \c any_of
@@ -42,10 +70,11 @@ namespace ranges
             indirect_unary_predicate<F, projected<I, P>>)
         bool RANGES_FUNC(any_of)(I first, S last, F pred, P proj = P{}) //
         {
-            for(; first != last; ++first)
-                if(invoke(pred, invoke(proj, *first)))
-                    return true;
-            return false;
+            return detail::any_of_(std::move(first),
+                                   std::move(last),
+                                   pred,
+                                   proj,
+                                   detail::internally_iterable_t<I, S>{});
         }
 
         /// \overload
@@ -0,0 +1,223 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_PARALLEL_MERGE_SORT_HPP
+#define RANGES_V3_ALGORITHM_AUX_PARALLEL_MERGE_SORT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/thread_pool.hpp>
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    namespace aux
+    {
+        /// Sorts `[first, last)` on the thread pool: `sort_run` sorts one
+        /// contiguous run per thread, then rounds of pairwise merges, each split
+        /// into independent pieces along the merge path, combine the runs while
+        /// moving them back and forth between the range and a temporary buffer.
+        /// The result is stable if `sort_run` is. Falls back to a single call of
+        /// `sort_run` when the range is small or no buffer can be had.
+        struct parallel_merge_sort_fn
+        {
+        private:
+            // The number of elements among the first `d` of the stable merge of
+            // `[a, a + na)` and `[b, b + nb)` that come from the former.
+            template<typename X, typename D, typename C, typename P>
+            static D merge_path(X a, D na, X b, D nb, D d, C & pred, P & proj)
+            {
+                D lo = d > nb ? d - nb : 0, hi = d < na ? d : na;
+                while(lo < hi)
+                {
+                    D const mid = lo + (hi - lo) / 2;
+                    if(!invoke(pred,
+                               invoke(proj, *(b + (d - mid - 1))),
+                               invoke(proj, *(a + mid))))
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+                return lo;
+            }
+
+            template<typename X, typename Y, typename C, typename P>
+            static void merge_move(X a, X a_end, X b, X b_end, Y out, C & pred,
+                                   P & proj)
+            {
+                for(; a != a_end && b != b_end; ++out)
+                {
+                    if(invoke(pred, invoke(proj, *b), invoke(proj, *a)))
+                    {
+                        *out = iter_move(b);
+                        ++b;
+                    }
+                    else
+                    {
+                        *out = iter_move(a);
+                        ++a;
+                    }
+                }
+                for(; a != a_end; ++a, ++out)
+                    *out = iter_move(a);
+                for(; b != b_end; ++b, ++out)
+                    *out = iter_move(b);
+            }
+
+            // Merges the runs of `src` delimited by `bounds` pairwise into the same
+            // positions of the output given by `out_at`, and drops every other
+            // bound. Every piece is located along its merge path before any is
+            // moved: the searches read elements that other pieces move from.
+            template<typename X, typename OutAt, typename D, typename C, typename P>
+            static void merge_round(X src, OutAt out_at, std::vector<D> & bounds,
+                                    D piece, C & pred, P & proj)
+            {
+                struct piece_t
+                {
+                    D lo, mid, hi, d0, d1, i0, i1;
+                };
+                std::size_t const runs = bounds.size() - 1;
+                std::vector<piece_t> pieces;
+                for(std::size_t r = 0; r < runs; r += 2)
+                {
+                    D const lo = bounds[r], mid = bounds[r + 1];
+                    D const hi = r + 2 <= runs ? bounds[r + 2] : mid;
+                    auto const n =
+                        static_cast<std::size_t>((hi - lo + piece - 1) / piece);
+                    for(std::size_t k = 0; k < n; ++k)
+                    {
+                        D const d0 = detail::parallel_chunk_begin(hi - lo, n, k);
+                        D const d1 = detail::parallel_chunk_begin(hi - lo, n, k + 1);
+                        pieces.push_back({lo, mid, hi, d0, d1, 0, 0});
+                    }
+                }
+                detail::parallel_for(pieces.size(), [&](std::size_t k) {
+                    piece_t & p = pieces[k];
+                    X const a = src + p.lo, b = src + p.mid;
+                    D const na = p.mid - p.lo, nb = p.hi - p.mid;
+                    p.i0 = merge_path(a, na, b, nb, p.d0, pred, proj);
+                    p.i1 = merge_path(a, na, b, nb, p.d1, pred, proj);
+                });
+                detail::parallel_for(pieces.size(), [&](std::size_t k) {
+                    piece_t const & p = pieces[k];
+                    X const a = src + p.lo, b = src + p.mid;
+                    merge_move(a + p.i0,
+                               a + p.i1,
+                               b + (p.d0 - p.i0),
+                               b + (p.d1 - p.i1),
+                               out_at(p.lo + p.d0),
+                               pred,
+                               proj);
+                });
+                std::size_t j = 0;
+                for(std::size_t r = 0; r < runs; r += 2)
+                    bounds[j++] = bounds[r];
+                bounds[j++] = bounds[runs];
+                bounds.resize(j);
+            }
+
+        public:
+            template(typename I, typename Sort, typename C = less, typename P = identity)(
+                /// \pre
+                requires random_access_iterator<I> AND sortable<I, C, P>)
+            I operator()(I first, I last, Sort sort_run, C pred = C{}, P proj = P{}) const
+            {
+                using D = iter_difference_t<I>;
+                using V = iter_value_t<I>;
+                D const n = last - first;
+                D const grain = detail::parallel_grain();
+                std::size_t const threads = detail::parallel_concurrency();
+                std::size_t runs = detail::parallel_chunk_count(n, grain);
+                if(runs > threads)
+                    runs = threads;
+                if(runs < 2)
+                {
+                    sort_run(first, last);
+                    return last;
+                }
+                auto const buf = detail::get_temporary_buffer<V>(n);
+                std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+                if(buf.second < n)
+                {
+                    sort_run(first, last);
+                    return last;
+                }
+
+                std::vector<D> bounds(runs + 1);
+                for(std::size_t i = 0; i <= runs; ++i)
+                    bounds[i] = detail::parallel_chunk_begin(n, runs, i);
+                detail::parallel_for(runs, [&](std::size_t i) {
+                    sort_run(first + bounds[i], first + bounds[i + 1]);
+                });
+
+                // The first round constructs the elements of the buffer; the later
+                // ones assign back and forth.
+                V * const b = buf.first;
+                D const share = n / static_cast<D>(threads * 2);
+                D const piece = share < grain ? grain : share;
+                merge_round(
+                    first,
+                    [b](D k) { return raw_storage_iterator<V *, V>(b + k); },
+                    bounds,
+                    piece,
+                    pred,
+                    proj);
+                bool in_buffer = true;
+                while(bounds.size() > 2)
+                {
+                    if(in_buffer)
+                        merge_round(b,
+                                    [first](D k) { return first + k; },
+                                    bounds,
+                                    piece,
+                                    pred,
+                                    proj);
+                    else
+                        merge_round(
+                            first, [b](D k) { return b + k; }, bounds, piece, pred, proj);
+                    in_buffer = !in_buffer;
+                }
+                detail::parallel_chunked(n, runs, [&](std::size_t, D lo, D hi) {
+                    for(D k = lo; k != hi; ++k)
+                    {
+                        if(in_buffer)
+                            *(first + k) = std::move(b[k]);
+                        b[k].~V();
+                    }
+                });
+                return last;
+            }
+        };
+
+        RANGES_INLINE_VARIABLE(parallel_merge_sort_fn, parallel_merge_sort)
+    } // namespace aux
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -28,6 +28,9 @@
 #include <range/v3/utility/copy.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/batched_read.hpp>
+#include <range/v3/detail/memmove.hpp>
+#include <range/v3/detail/segmented.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -37,6 +40,73 @@ namespace ranges
     template<typename I, typename O>
     using copy_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O>
+        constexpr copy_result<I, O> copy_(I first, S last, O out, std::false_type,
+                                          std::false_type)
+        {
+            for(; first != last; ++first, ++out)
+                *out = *first;
+            return {first, out};
+        }
+
+        template<typename I, typename S, typename O>
+        constexpr copy_result<I, O> copy_(I first, S last, O out, std::true_type,
+                                          std::false_type)
+        {
+            if(!detail::is_constant_evaluated())
+            {
+                auto const n = last - first;
+                out = detail::memmove_n(first, n, out);
+                return {first + n, out};
+            }
+            return detail::copy_(first, last, out, std::false_type{}, std::false_type{});
+        }
+
+        template<typename I, typename S, typename O>
+        copy_result<I, O> copy_(I first, S last, O out, std::false_type, std::true_type)
+        {
+            auto assign = [&out](iter_reference_t<I> && ref) {
+                *out = static_cast<iter_reference_t<I> &&>(ref);
+                ++out;
+            };
+            first = detail::batched_for_each(std::move(first), std::move(last), assign);
+            return {first, out};
+        }
+
+        template<typename I, typename S, typename O>
+        constexpr copy_result<I, O> copy_segmented_(I first, S last, O out,
+                                                    std::false_type)
+        {
+            return detail::copy_(std::move(first),
+                                 std::move(last),
+                                 std::move(out),
+                                 meta::bool_<detail::memmove_copyable<I, O> &&
+                                             sized_sentinel_for<S, I>>{},
+                                 detail::batched_reader<I, S>{});
+        }
+
+        template<typename I, typename S, typename O>
+        copy_result<I, O> copy_segmented_(I first, S last, O out, std::true_type)
+        {
+            first = detail::segmented_visit(
+                std::move(first), std::move(last), [&out](auto lfirst, auto llast) {
+                    using LI = decltype(lfirst);
+                    using LS = decltype(llast);
+                    auto res = detail::copy_segmented_(std::move(lfirst),
+                                                       std::move(llast),
+                                                       std::move(out),
+                                                       detail::segmented_t<LI, LS>{});
+                    out = std::move(res.out);
+                    return std::move(res.in);
+                });
+            return {std::move(first), std::move(out)};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_HIDDEN_DETAIL(namespace _copy CPP_PP_LBRACE())
     RANGES_FUNC_BEGIN(copy)
 
@@ -47,9 +117,10 @@ namespace ranges
             weakly_incrementable<O> AND indirectly_copyable<I, O>)
         constexpr copy_result<I, O> RANGES_FUNC(copy)(I first, S last, O out) //
         {
-            for(; first != last; ++first, ++out)
-                *out = *first;
-            return {first, out};
+            return detail::copy_segmented_(std::move(first),
+                                           std::move(last),
+                                           std::move(out),
+                                           detail::segmented_t<I, S>{});
         }
 
         /// \overload
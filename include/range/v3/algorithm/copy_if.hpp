@@ -13,8 +13,12 @@
 #ifndef RANGES_V3_ALGORITHM_COPY_IF_HPP
 #define RANGES_V3_ALGORITHM_COPY_IF_HPP
 
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <range/v3/range_fwd.hpp>
 
@@ -27,8 +31,10 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -38,6 +44,68 @@ namespace ranges
     template<typename I, typename O>
     using copy_if_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O, typename F, typename P>
+        copy_if_result<I, O> copy_if_(I first, S last, O out, F & pred, P & proj,
+                                      std::false_type)
+        {
+            for(; first != last; ++first)
+            {
+                auto && x = *first;
+                if(invoke(pred, invoke(proj, x)))
+                {
+                    *out = (decltype(x) &&)x;
+                    ++out;
+                }
+            }
+            return {first, out};
+        }
+
+        // The predicate is evaluated once per element in a first parallel pass
+        // that also counts the matches of every chunk; a second pass copies each
+        // chunk's matches to its offset in the output.
+        template<typename I, typename S, typename O, typename F, typename P>
+        copy_if_result<I, O> copy_if_(I first, S last, O out, F & pred, P & proj,
+                                      std::true_type)
+        {
+            using D = iter_difference_t<I>;
+            D const n = last - first;
+            std::size_t const chunks =
+                detail::parallel_chunk_count(n, D(detail::parallel_grain()));
+            std::unique_ptr<bool[]> const keep{new bool[static_cast<std::size_t>(n)]};
+            std::vector<D> offsets(chunks + 1);
+            detail::parallel_chunked(n, chunks, [&](std::size_t i, D lo, D hi) {
+                D c = 0;
+                I it = first + lo;
+                for(D k = lo; k != hi; ++k, ++it)
+                {
+                    bool const b = invoke(pred, invoke(proj, *it));
+                    keep[static_cast<std::size_t>(k)] = b;
+                    c += b;
+                }
+                offsets[i + 1] = c;
+            });
+            for(std::size_t i = 0; i < chunks; ++i)
+                offsets[i + 1] += offsets[i];
+            detail::parallel_chunked(n, chunks, [&](std::size_t i, D lo, D hi) {
+                O o = out + static_cast<iter_difference_t<O>>(offsets[i]);
+                I it = first + lo;
+                for(D k = lo; k != hi; ++k, ++it)
+                {
+                    if(keep[static_cast<std::size_t>(k)])
+                    {
+                        *o = *it;
+                        ++o;
+                    }
+                }
+            });
+            return {first + n, out + static_cast<iter_difference_t<O>>(offsets[chunks])};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(copy_if)
 
         /// \brief function template \c copy_if
@@ -75,6 +143,46 @@ namespace ranges
                 begin(rng), end(rng), std::move(out), std::move(pred), std::move(proj));
         }
 
+        /// \overload
+        /// Work is split across threads only when both the input and the output
+        /// are random-access.
+        template(typename E, typename I, typename S, typename O, typename F,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_iterator<I> AND
+                sentinel_for<S, I> AND weakly_incrementable<O> AND
+                indirect_unary_predicate<F, projected<I, P>> AND
+                indirectly_copyable<I, O>)
+        copy_if_result<I, O> //
+        RANGES_FUNC(copy_if)(E &&, I first, S last, O out, F pred, P proj = P{}) //
+        {
+            return detail::copy_if_(std::move(first),
+                                    std::move(last),
+                                    std::move(out),
+                                    pred,
+                                    proj,
+                                    meta::bool_<detail::parallelizable<E, I, S>::value &&
+                                                random_access_iterator<O>>{});
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename O, typename F, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_range<Rng> AND
+            weakly_incrementable<O> AND
+            indirect_unary_predicate<F, projected<iterator_t<Rng>, P>> AND
+            indirectly_copyable<iterator_t<Rng>, O>)
+        copy_if_result<borrowed_iterator_t<Rng>, O> //
+        RANGES_FUNC(copy_if)(E && policy, Rng && rng, O out, F pred, P proj = P{})
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(copy_if)
 
     namespace cpp20
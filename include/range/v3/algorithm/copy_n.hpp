@@ -29,6 +29,7 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/memmove.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -38,6 +39,30 @@ namespace ranges
     template<typename I, typename O>
     using copy_n_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename O>
+        copy_n_result<I, O> copy_n_(I first, iter_difference_t<I> n, O out,
+                                    std::false_type)
+        {
+            auto norig = n;
+            auto b = uncounted(first);
+            for(; n != 0; ++b, ++out, --n)
+                *out = *b;
+            return {recounted(first, b, norig), out};
+        }
+
+        template<typename I, typename O>
+        copy_n_result<I, O> copy_n_(I first, iter_difference_t<I> n, O out,
+                                    std::true_type)
+        {
+            out = detail::memmove_n(first, n, out);
+            return {first + n, out};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(copy_n)
 
         /// \brief function template \c copy_n
@@ -48,11 +73,10 @@ namespace ranges
         copy_n_result<I, O> RANGES_FUNC(copy_n)(I first, iter_difference_t<I> n, O out)
         {
             RANGES_EXPECT(0 <= n);
-            auto norig = n;
-            auto b = uncounted(first);
-            for(; n != 0; ++b, ++out, --n)
-                *out = *b;
-            return {recounted(first, b, norig), out};
+            return detail::copy_n_(std::move(first),
+                                   n,
+                                   std::move(out),
+                                   meta::bool_<detail::memmove_copyable<I, O>>{});
         }
 
     RANGES_FUNC_END(copy_n)
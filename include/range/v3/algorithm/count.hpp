@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_COUNT_HPP
 #define RANGES_V3_ALGORITHM_COUNT_HPP
 
+#include <memory>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -26,12 +27,39 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/simd.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename V, typename P>
+        iter_difference_t<I> count_(I first, S last, V const & val, P & proj,
+                                    std::false_type)
+        {
+            iter_difference_t<I> n = 0;
+            for(; first != last; ++first)
+                if(invoke(proj, *first) == val)
+                    ++n;
+            return n;
+        }
+
+        template<typename I, typename S, typename V, typename P>
+        iter_difference_t<I> count_(I first, S last, V const & val, P &, std::true_type)
+        {
+            auto const n = last - first;
+            if(n == 0)
+                return 0;
+            return static_cast<iter_difference_t<I>>(
+                detail::simd_count(std::addressof(*first), n, val));
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(count)
 
         /// \brief function template \c count
@@ -42,11 +70,13 @@ namespace ranges
         iter_difference_t<I> //
         RANGES_FUNC(count)(I first, S last, V const & val, P proj = P{})
         {
-            iter_difference_t<I> n = 0;
-            for(; first != last; ++first)
-                if(invoke(proj, *first) == val)
-                    ++n;
-            return n;
+            return detail::count_(
+                std::move(first),
+                std::move(last),
+                val,
+                proj,
+                meta::bool_<detail::vectorizable_iterator<I, S> && same_as<P, identity> &&
+                            same_as<V, iter_value_t<I>>>{});
         }
 
         /// \overload
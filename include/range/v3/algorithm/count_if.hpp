@@ -13,7 +13,10 @@
 #ifndef RANGES_V3_ALGORITHM_COUNT_IF_HPP
 #define RANGES_V3_ALGORITHM_COUNT_IF_HPP
 
+#include <cstddef>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <range/v3/range_fwd.hpp>
 
@@ -24,14 +27,104 @@
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// \cond
+    namespace detail
+    {
+        // Adds the number of matching elements to n and returns the end of the
+        // input.
+        template<typename I, typename S, typename R, typename P, typename D>
+        I count_if_segmented_(I first, S last, R & pred, P & proj, D & n,
+                              std::false_type)
+        {
+            D count = 0;
+            for(; first != last; ++first)
+                if(invoke(pred, invoke(proj, *first)))
+                    ++count;
+            n += count;
+            return first;
+        }
+
+        template<typename I, typename S, typename R, typename P, typename D>
+        I count_if_segmented_(I first, S last, R & pred, P & proj, D & n, push_tag)
+        {
+            D count = 0;
+            auto tally = [&](auto && ref) {
+                if(invoke(pred, invoke(proj, static_cast<decltype(ref)>(ref))))
+                    ++count;
+                return true;
+            };
+            first = detail::for_each_while_(std::move(first), std::move(last), tally);
+            n += count;
+            return first;
+        }
+
+        template<typename I, typename S, typename R, typename P, typename D>
+        I count_if_segmented_(I first, S last, R & pred, P & proj, D & n,
+                              std::true_type)
+        {
+            return detail::segmented_visit(
+                std::move(first), std::move(last), [&](auto lfirst, auto llast) {
+                    using LI = decltype(lfirst);
+                    using LS = decltype(llast);
+                    return detail::count_if_segmented_(std::move(lfirst),
+                                                       std::move(llast),
+                                                       pred,
+                                                       proj,
+                                                       n,
+                                                       detail::iteration_t<LI, LS>{});
+                });
+        }
+
+        template<typename I, typename S, typename R, typename P>
+        iter_difference_t<I> count_if_(I first, S last, R & pred, P & proj,
+                                       std::false_type)
+        {
+            iter_difference_t<I> n = 0;
+            detail::count_if_segmented_(std::move(first),
+                                        std::move(last),
+                                        pred,
+                                        proj,
+                                        n,
+                                        detail::iteration_t<I, S>{});
+            return n;
+        }
+
+        template<typename I, typename S, typename R, typename P>
+        iter_difference_t<I> count_if_(I first, S last, R & pred, P & proj,
+                                       std::true_type)
+        {
+            using D = iter_difference_t<I>;
+            D const n = last - first;
+            std::size_t const chunks =
+                detail::parallel_chunk_count(n, D(detail::parallel_grain()));
+            std::vector<D> counts(chunks);
+            detail::parallel_chunked(n, chunks, [&](std::size_t i, D lo, D hi) {
+                D c = 0;
+                for(I it = first + lo, end = first + hi; it != end; ++it)
+                    if(invoke(pred, invoke(proj, *it)))
+                        ++c;
+                counts[i] = c;
+            });
+            D total = 0;
+            for(D c : counts)
+                total += c;
+            return total;
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(count_if)
 
         /// \brief function template \c count_if
@@ -41,11 +134,8 @@ namespace ranges
             indirect_unary_predicate<R, projected<I, P>>)
         iter_difference_t<I> RANGES_FUNC(count_if)(I first, S last, R pred, P proj = P{})
         {
-            iter_difference_t<I> n = 0;
-            for(; first != last; ++first)
-                if(invoke(pred, invoke(proj, *first)))
-                    ++n;
-            return n;
+            return detail::count_if_(
+                std::move(first), std::move(last), pred, proj, std::false_type{});
         }
 
         /// \overload
@@ -59,6 +149,36 @@ namespace ranges
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
 
+        /// \overload
+        template(typename E, typename I, typename S, typename R, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_iterator<I> AND
+            sentinel_for<S, I> AND indirect_unary_predicate<R, projected<I, P>>)
+        iter_difference_t<I> //
+        RANGES_FUNC(count_if)(E &&, I first, S last, R pred, P proj = P{})
+        {
+            return detail::count_if_(std::move(first),
+                                     std::move(last),
+                                     pred,
+                                     proj,
+                                     detail::parallelizable<E, I, S>{});
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename R, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_range<Rng> AND
+            indirect_unary_predicate<R, projected<iterator_t<Rng>, P>>)
+        iter_difference_t<iterator_t<Rng>> //
+        RANGES_FUNC(count_if)(E && policy, Rng && rng, R pred, P proj = P{})
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(count_if)
 
     namespace cpp20
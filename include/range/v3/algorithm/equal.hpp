@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_EQUAL_HPP
 #define RANGES_V3_ALGORITHM_EQUAL_HPP
 
+#include <memory>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -28,6 +29,7 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/simd.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -40,14 +42,56 @@ namespace ranges
     {
         template<typename I0, typename S0, typename I1, typename S1, typename C,
                  typename P0, typename P1>
-        constexpr bool equal_nocheck(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred,
-                                     P0 proj0, P1 proj1)
+        constexpr bool equal_nocheck_(I0 begin0, S0 end0, I1 begin1, S1 end1, C & pred,
+                                      P0 & proj0, P1 & proj1, std::false_type)
         {
             for(; begin0 != end0 && begin1 != end1; ++begin0, ++begin1)
                 if(!invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
                     return false;
             return begin0 == end0 && begin1 == end1;
         }
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        constexpr bool equal_nocheck_(I0 begin0, S0 end0, I1 begin1, S1 end1, C & pred,
+                                      P0 & proj0, P1 & proj1, std::true_type)
+        {
+            if(!detail::is_constant_evaluated())
+            {
+                auto const n = end0 - begin0;
+                if(n != end1 - begin1)
+                    return false;
+                return n == 0 || detail::simd_equal(std::addressof(*begin0),
+                                                    std::addressof(*begin1),
+                                                    n);
+            }
+            return detail::equal_nocheck_(std::move(begin0),
+                                          std::move(end0),
+                                          std::move(begin1),
+                                          std::move(end1),
+                                          pred,
+                                          proj0,
+                                          proj1,
+                                          std::false_type{});
+        }
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        constexpr bool equal_nocheck(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred,
+                                     P0 proj0, P1 proj1)
+        {
+            return detail::equal_nocheck_(
+                std::move(begin0),
+                std::move(end0),
+                std::move(begin1),
+                std::move(end1),
+                pred,
+                proj0,
+                proj1,
+                meta::bool_<detail::vectorizable_pair<I0, S0, I1, S1> &&
+                            same_as<C, equal_to> && same_as<P0, identity> &&
+                            same_as<P1, identity>>{});
+        }
     } // namespace detail
     /// \endcond
 
@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_FIND_HPP
 #define RANGES_V3_ALGORITHM_FIND_HPP
 
+#include <memory>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -27,12 +28,41 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/simd.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename V, typename P>
+        constexpr I find_(I first, S last, V const & val, P & proj, std::false_type)
+        {
+            for(; first != last; ++first)
+                if(invoke(proj, *first) == val)
+                    break;
+            return first;
+        }
+
+        template<typename I, typename S, typename V, typename P>
+        constexpr I find_(I first, S last, V const & val, P & proj, std::true_type)
+        {
+            if(!detail::is_constant_evaluated())
+            {
+                auto const n = last - first;
+                if(n == 0)
+                    return first;
+                return first + static_cast<iter_difference_t<I>>(
+                                   detail::simd_find(std::addressof(*first), n, val));
+            }
+            return detail::find_(std::move(first), last, val, proj, std::false_type{});
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(find)
         /// \brief template function \c find
         ///
@@ -49,10 +79,13 @@ namespace ranges
             indirect_relation<equal_to, projected<I, P>, V const *>)
         constexpr I RANGES_FUNC(find)(I first, S last, V const & val, P proj = P{})
         {
-            for(; first != last; ++first)
-                if(invoke(proj, *first) == val)
-                    break;
-            return first;
+            return detail::find_(
+                std::move(first),
+                std::move(last),
+                val,
+                proj,
+                meta::bool_<detail::vectorizable_iterator<I, S> && same_as<P, identity> &&
+                            same_as<V, iter_value_t<I>>>{});
         }
 
         /// \overload
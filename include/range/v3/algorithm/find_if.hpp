@@ -13,6 +13,9 @@
 #ifndef RANGES_V3_ALGORITHM_FIND_IF_HPP
 #define RANGES_V3_ALGORITHM_FIND_IF_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -25,14 +28,100 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename F, typename P>
+        I find_if_segmented_(I first, S last, F & pred, P & proj, std::false_type)
+        {
+            for(; first != last; ++first)
+                if(invoke(pred, invoke(proj, *first)))
+                    break;
+            return first;
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I find_if_segmented_(I first, S last, F & pred, P & proj, push_tag)
+        {
+            auto no_match = [&](auto && ref) -> bool {
+                return !invoke(pred, invoke(proj, static_cast<decltype(ref)>(ref)));
+            };
+            return detail::for_each_while_(std::move(first), std::move(last), no_match);
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I find_if_segmented_(I first, S last, F & pred, P & proj, std::true_type)
+        {
+            return detail::segmented_visit(
+                std::move(first), std::move(last), [&](auto lfirst, auto llast) {
+                    using LI = decltype(lfirst);
+                    using LS = decltype(llast);
+                    return detail::find_if_segmented_(std::move(lfirst),
+                                                      std::move(llast),
+                                                      pred,
+                                                      proj,
+                                                      detail::iteration_t<LI, LS>{});
+                });
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I find_if_(I first, S last, F & pred, P & proj, std::false_type)
+        {
+            return detail::find_if_segmented_(std::move(first),
+                                              std::move(last),
+                                              pred,
+                                              proj,
+                                              detail::iteration_t<I, S>{});
+        }
+
+        // Every chunk is searched in blocks; a chunk stops early once a match
+        // has been found before its next block.
+        template<typename I, typename S, typename F, typename P>
+        I find_if_(I first, S last, F & pred, P & proj, std::true_type)
+        {
+            using D = iter_difference_t<I>;
+            D const n = last - first;
+            D const block = 1024;
+            std::atomic<D> found{n};
+            detail::parallel_chunked(
+                n,
+                detail::parallel_chunk_count(n, D(detail::parallel_grain())),
+                [&](std::size_t, D lo, D hi) {
+                    for(D b = lo; b < hi; b += block)
+                    {
+                        if(found.load(std::memory_order_relaxed) < b)
+                            return;
+                        D const e = hi - b < block ? hi : b + block;
+                        I it = first + b;
+                        for(D k = b; k != e; ++k, ++it)
+                        {
+                            if(invoke(pred, invoke(proj, *it)))
+                            {
+                                D prev = found.load(std::memory_order_relaxed);
+                                while(k < prev && !found.compare_exchange_weak(prev, k))
+                                    ;
+                                return;
+                            }
+                        }
+                    }
+                });
+            return first + found.load();
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(find_if)
         /// \brief template function \c find
         ///
@@ -51,10 +140,11 @@ namespace ranges
             indirect_unary_predicate<F, projected<I, P>>)
         I RANGES_FUNC(find_if)(I first, S last, F pred, P proj = P{})
         {
-            for(; first != last; ++first)
-                if(invoke(pred, invoke(proj, *first)))
-                    break;
-            return first;
+            return detail::find_if_segmented_(std::move(first),
+                                              std::move(last),
+                                              pred,
+                                              proj,
+                                              detail::iteration_t<I, S>{});
         }
 
         /// \overload
@@ -67,6 +157,35 @@ namespace ranges
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
 
+        /// \overload
+        template(typename E, typename I, typename S, typename F, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_iterator<I> AND
+            sentinel_for<S, I> AND indirect_unary_predicate<F, projected<I, P>>)
+        I RANGES_FUNC(find_if)(E &&, I first, S last, F pred, P proj = P{})
+        {
+            return detail::find_if_(std::move(first),
+                                    std::move(last),
+                                    pred,
+                                    proj,
+                                    detail::parallelizable<E, I, S>{});
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename F, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_range<Rng> AND
+            indirect_unary_predicate<F, projected<iterator_t<Rng>, P>>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(find_if)(E && policy, Rng && rng, F pred, P proj = P{})
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(find_if)
 
     namespace cpp20
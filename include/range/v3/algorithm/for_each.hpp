@@ -13,7 +13,9 @@
 #ifndef RANGES_V3_ALGORITHM_FOR_EACH_HPP
 #define RANGES_V3_ALGORITHM_FOR_EACH_HPP
 
+#include <cstddef>
 #include <functional>
+#include <type_traits>
 
 #include <range/v3/range_fwd.hpp>
 
@@ -26,8 +28,13 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/batched_read.hpp>
+#include <range/v3/detail/for_each_while.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -37,6 +44,87 @@ namespace ranges
     template<typename I, typename F>
     using for_each_result = detail::in_fun_result<I, F>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename F, typename P>
+        I for_each_seq_(I first, S last, F & fun, P & proj, std::false_type)
+        {
+            for(; first != last; ++first)
+                invoke(fun, invoke(proj, *first));
+            return first;
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I for_each_seq_(I first, S last, F & fun, P & proj, std::true_type)
+        {
+            auto apply = [&](iter_reference_t<I> && ref) {
+                invoke(fun, invoke(proj, static_cast<iter_reference_t<I> &&>(ref)));
+            };
+            return detail::batched_for_each(std::move(first), std::move(last), apply);
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I for_each_segmented_(I first, S last, F & fun, P & proj, std::false_type)
+        {
+            return detail::for_each_seq_(std::move(first),
+                                         std::move(last),
+                                         fun,
+                                         proj,
+                                         detail::batched_reader<I, S>{});
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I for_each_segmented_(I first, S last, F & fun, P & proj, push_tag)
+        {
+            auto apply = [&](auto && ref) {
+                invoke(fun, invoke(proj, static_cast<decltype(ref)>(ref)));
+                return true;
+            };
+            return detail::for_each_while_(std::move(first), std::move(last), apply);
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I for_each_segmented_(I first, S last, F & fun, P & proj, std::true_type)
+        {
+            return detail::segmented_visit(
+                std::move(first), std::move(last), [&](auto lfirst, auto llast) {
+                    using LI = decltype(lfirst);
+                    using LS = decltype(llast);
+                    return detail::for_each_segmented_(std::move(lfirst),
+                                                       std::move(llast),
+                                                       fun,
+                                                       proj,
+                                                       detail::iteration_t<LI, LS>{});
+                });
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I for_each_(I first, S last, F & fun, P & proj, std::false_type)
+        {
+            return detail::for_each_segmented_(std::move(first),
+                                               std::move(last),
+                                               fun,
+                                               proj,
+                                               detail::iteration_t<I, S>{});
+        }
+
+        template<typename I, typename S, typename F, typename P>
+        I for_each_(I first, S last, F & fun, P & proj, std::true_type)
+        {
+            auto const n = last - first;
+            detail::parallel_chunked(
+                n,
+                detail::parallel_chunk_count(n, detail::parallel_grain()),
+                [&](std::size_t, iter_difference_t<I> lo, iter_difference_t<I> hi) {
+                    for(I it = first + lo, end = first + hi; it != end; ++it)
+                        invoke(fun, invoke(proj, *it));
+                });
+            return first + n;
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(for_each)
 
         /// \brief function template \c for_each
@@ -46,10 +134,11 @@ namespace ranges
             indirectly_unary_invocable<F, projected<I, P>>)
         for_each_result<I, F> RANGES_FUNC(for_each)(I first, S last, F fun, P proj = P{})
         {
-            for(; first != last; ++first)
-            {
-                invoke(fun, invoke(proj, *first));
-            }
+            first = detail::for_each_segmented_(std::move(first),
+                                                std::move(last),
+                                                fun,
+                                                proj,
+                                                detail::iteration_t<I, S>{});
             return {detail::move(first), detail::move(fun)};
         }
 
@@ -65,6 +154,37 @@ namespace ranges
                     detail::move(fun)};
         }
 
+        /// \overload
+        /// Applies \c fun to the elements in the manner requested by the execution
+        /// policy. Returns the end of the input.
+        template(typename E, typename I, typename S, typename F, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_iterator<I> AND
+            sentinel_for<S, I> AND indirectly_unary_invocable<F, projected<I, P>>)
+        I RANGES_FUNC(for_each)(E &&, I first, S last, F fun, P proj = P{})
+        {
+            return detail::for_each_(std::move(first),
+                                     std::move(last),
+                                     fun,
+                                     proj,
+                                     detail::parallelizable<E, I, S>{});
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename F, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_range<Rng> AND
+            indirectly_unary_invocable<F, projected<iterator_t<Rng>, P>>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(for_each)(E && policy, Rng && rng, F fun, P proj = P{})
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(fun),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(for_each)
 
     namespace cpp20
@@ -0,0 +1,74 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_FOR_EACH_WHILE_HPP
+#define RANGES_V3_ALGORITHM_FOR_EACH_WHILE_HPP
+
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/for_each_while.hpp>
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-algorithms
+    /// @{
+    RANGES_FUNC_BEGIN(for_each_while)
+
+        /// \brief function template \c for_each_while
+        ///
+        /// Calls \c sink with the elements of the sequence in order for as long as
+        /// it returns \c true, and returns the position of the element for which
+        /// it returned \c false, or the end. Views that know how (\c iota_view,
+        /// \c filter, \c transform, \c take_while, \c join, \c cartesian_product,
+        /// and adaptors that pass the elements of such views through unchanged)
+        /// push their elements into \c sink in a loop of their own rather than
+        /// being walked an iterator increment at a time.
+        template(typename I, typename S, typename F)(
+            /// \pre
+            requires input_iterator<I> AND sentinel_for<S, I> AND
+            indirect_unary_predicate<F, I>)
+        I RANGES_FUNC(for_each_while)(I first, S last, F sink)
+        {
+            auto push = [&sink](auto && ref) -> bool {
+                return invoke(sink, static_cast<decltype(ref)>(ref));
+            };
+            return detail::for_each_while_(std::move(first), std::move(last), push);
+        }
+
+        /// \overload
+        template(typename Rng, typename F)(
+            /// \pre
+            requires input_range<Rng> AND indirect_unary_predicate<F, iterator_t<Rng>>)
+        borrowed_iterator_t<Rng> RANGES_FUNC(for_each_while)(Rng && rng, F sink)
+        {
+            return (*this)(begin(rng), end(rng), std::move(sink));
+        }
+
+    RANGES_FUNC_END(for_each_while)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
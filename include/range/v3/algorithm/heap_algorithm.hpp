@@ -21,7 +21,9 @@
 #ifndef RANGES_V3_ALGORITHM_HEAP_ALGORITHM_HPP
 #define RANGES_V3_ALGORITHM_HEAP_ALGORITHM_HPP
 
+#include <cstddef>
 #include <functional>
+#include <type_traits>
 
 #include <meta/meta.hpp>
 
@@ -257,6 +259,157 @@ namespace ranges
         };
 
         RANGES_INLINE_VARIABLE(sift_down_n_fn, sift_down_n)
+
+        // The heaps of any arity. The children of the element at offset `i` of
+        // an `Arity`-ary heap are at offsets `Arity * i + 1` to `Arity * i + Arity`,
+        // and its parent is at `(i - 1) / Arity`.
+
+        // The largest of the `n` siblings that start at `child`.
+        template<typename I, typename N, typename C, typename P>
+        I heap_max_child_(I child, N n, C & pred, P & proj)
+        {
+            I best = child;
+            for(iter_difference_t<I> k = 1; k < n; ++k)
+            {
+                ++child;
+                if(invoke(pred, invoke(proj, *best), invoke(proj, *child)))
+                    best = child;
+            }
+            return best;
+        }
+
+        // Moves the empty slot at offset `hole` down to a leaf of the heap of
+        // `len` elements, filling it with its largest child at each level, and
+        // returns the leaf. This is the first half of Floyd's sift-down: it
+        // takes `Arity - 1` comparisons a level, rather than `Arity`, because
+        // it does not check whether the element that goes into the slot could
+        // stop higher up.
+        template<std::size_t Arity, typename I, typename C, typename P>
+        iter_difference_t<I> heap_hole_down_(I first, iter_difference_t<I> len,
+                                             iter_difference_t<I> hole, C & pred,
+                                             P & proj)
+        {
+            using D = iter_difference_t<I>;
+            constexpr D arity = static_cast<D>(Arity);
+            // While the slot has all its children, their number is a constant.
+            for(D child; (child = arity * hole + 1) <= len - arity;)
+            {
+                I const max = detail::heap_max_child_(
+                    first + child, std::integral_constant<D, arity>{}, pred, proj);
+                *(first + hole) = iter_move(max);
+                hole = max - first;
+            }
+            D const child = arity * hole + 1;
+            if(child < len)
+            {
+                I const max = detail::heap_max_child_(first + child, len - child, pred,
+                                                      proj);
+                *(first + hole) = iter_move(max);
+                hole = max - first;
+            }
+            return hole;
+        }
+
+        // Stores `v` in the empty slot at offset `hole`, after moving it up past
+        // the ancestors that are smaller than `v`, but no higher than `top`.
+        template<std::size_t Arity, typename I, typename V, typename C, typename P>
+        void heap_hole_up_(I first, iter_difference_t<I> top, iter_difference_t<I> hole,
+                           V && v, C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            constexpr D arity = static_cast<D>(Arity);
+            while(hole > top)
+            {
+                D const parent = (hole - 1) / arity;
+                I const p = first + parent;
+                if(!invoke(pred, invoke(proj, *p), invoke(proj, v)))
+                    break;
+                *(first + hole) = iter_move(p);
+                hole = parent;
+            }
+            *(first + hole) = static_cast<V &&>(v);
+        }
+
+        template<std::size_t Arity, typename I, typename C, typename P>
+        void heap_push_n_(I first, iter_difference_t<I> len, C & pred, P & proj)
+        {
+            if(len > 1)
+            {
+                auto const parent = (len - 2) / static_cast<iter_difference_t<I>>(Arity);
+                I const last = first + (len - 1), p = first + parent;
+                if(invoke(pred, invoke(proj, *p), invoke(proj, *last)))
+                {
+                    iter_value_t<I> v = iter_move(last);
+                    *last = iter_move(p);
+                    detail::heap_hole_up_<Arity>(
+                        first, 0, parent, std::move(v), pred, proj);
+                }
+            }
+        }
+
+        // Floyd's pop: the slot of the top sinks to a leaf, the last element
+        // fills it and climbs back up, which it seldom does far.
+        template<std::size_t Arity, typename I, typename C, typename P>
+        void heap_pop_n_(I first, iter_difference_t<I> len, C & pred, P & proj)
+        {
+            if(len > 1)
+            {
+                auto const last = len - 1;
+                iter_value_t<I> top = iter_move(first);
+                auto const hole =
+                    detail::heap_hole_down_<Arity>(first, len, 0, pred, proj);
+                if(hole == last)
+                    *(first + last) = std::move(top);
+                else
+                {
+                    iter_value_t<I> v = iter_move(first + last);
+                    *(first + last) = std::move(top);
+                    detail::heap_hole_up_<Arity>(
+                        first, 0, hole, std::move(v), pred, proj);
+                }
+            }
+        }
+
+        // Floyd's heap construction, with each element sunk bottom-up.
+        template<std::size_t Arity, typename I, typename C, typename P>
+        void heap_make_n_(I first, iter_difference_t<I> len, C & pred, P & proj)
+        {
+            if(len > 1)
+            {
+                for(auto start = (len - 2) / static_cast<iter_difference_t<I>>(Arity);
+                    start >= 0;
+                    --start)
+                {
+                    iter_value_t<I> v = iter_move(first + start);
+                    auto const hole =
+                        detail::heap_hole_down_<Arity>(first, len, start, pred, proj);
+                    detail::heap_hole_up_<Arity>(
+                        first, start, hole, std::move(v), pred, proj);
+                }
+            }
+        }
+
+        template<std::size_t Arity, typename I, typename C, typename P>
+        void heap_sort_n_(I first, iter_difference_t<I> len, C & pred, P & proj)
+        {
+            for(auto i = len; i > 1; --i)
+                detail::heap_pop_n_<Arity>(first, i, pred, proj);
+        }
+
+        template<std::size_t Arity, typename I, typename C, typename P>
+        I heap_until_n_(I first, iter_difference_t<I> len, C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            constexpr D arity = static_cast<D>(Arity);
+            for(D parent = 0, child = 1; child < len; ++parent)
+            {
+                I const p = first + parent;
+                for(D k = 0; k < arity && child < len; ++k, ++child)
+                    if(invoke(pred, invoke(proj, *p), invoke(proj, *(first + child))))
+                        return first + child;
+            }
+            return first + len;
+        }
     } // namespace detail
     /// \endcond
 
@@ -308,12 +461,7 @@ namespace ranges
             void operator()(I first, iter_difference_t<I> len, C pred = C{},
                             P proj = P{}) const
             {
-                if(len > 1)
-                {
-                    ranges::iter_swap(first, first + (len - 1));
-                    detail::sift_down_n(
-                        first, len - 1, first, std::move(pred), std::move(proj));
-                }
+                detail::heap_pop_n_<2>(first, len, pred, proj);
             }
         };
 
@@ -432,6 +580,223 @@ namespace ranges
     {
         using ranges::sort_heap;
     }
+
+    /// \brief The heap algorithms for heaps in which every element has up to
+    /// `Arity` children, such as `push_dary_heap<4>`.
+    ///
+    /// A heap of higher arity is shallower, and the children of an element are
+    /// adjacent, so that finding the largest of them reads one or two cache
+    /// lines. Pushes make fewer moves and pops touch fewer cache lines than in
+    /// a binary heap, for `Arity - 2` more comparisons a level on the way down.
+    /// `is_dary_heap<2>` and the others of arity 2 work on the same heaps as
+    /// `is_heap` and the others.
+    template<std::size_t Arity>
+    struct is_dary_heap_until_fn
+    {
+        static_assert(Arity >= 2, "A heap needs an arity of 2 or more.");
+
+        template(typename I, typename S, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+            indirect_strict_weak_order<C, projected<I, P>>)
+        I operator()(I first, S last, C pred = C{}, P proj = P{}) const
+        {
+            auto const n = distance(first, last);
+            return detail::heap_until_n_<Arity>(std::move(first), n, pred, proj);
+        }
+
+        /// \overload
+        template(typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND
+            indirect_strict_weak_order<C, projected<iterator_t<Rng>, P>>)
+        borrowed_iterator_t<Rng> operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+        {
+            return detail::heap_until_n_<Arity>(begin(rng), distance(rng), pred, proj);
+        }
+    };
+
+    /// \sa `is_dary_heap_until_fn`
+    template<std::size_t Arity>
+    struct is_dary_heap_fn
+    {
+        static_assert(Arity >= 2, "A heap needs an arity of 2 or more.");
+
+        template(typename I, typename S, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+            indirect_strict_weak_order<C, projected<I, P>>)
+        bool operator()(I first, S last, C pred = C{}, P proj = P{}) const
+        {
+            auto const n = distance(first, last);
+            return detail::heap_until_n_<Arity>(first, n, pred, proj) == first + n;
+        }
+
+        /// \overload
+        template(typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND
+            indirect_strict_weak_order<C, projected<iterator_t<Rng>, P>>)
+        bool operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+        {
+            auto const n = distance(rng);
+            return detail::heap_until_n_<Arity>(begin(rng), n, pred, proj) ==
+                   begin(rng) + n;
+        }
+    };
+
+    /// \sa `is_dary_heap_until_fn`
+    template<std::size_t Arity>
+    struct push_dary_heap_fn
+    {
+        static_assert(Arity >= 2, "A heap needs an arity of 2 or more.");
+
+        template(typename I, typename S, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+            sortable<I, C, P>)
+        I operator()(I first, S last, C pred = C{}, P proj = P{}) const
+        {
+            auto const n = distance(first, last);
+            detail::heap_push_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+
+        /// \overload
+        template(typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND sortable<iterator_t<Rng>, C, P>)
+        borrowed_iterator_t<Rng> operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+        {
+            iterator_t<Rng> first = ranges::begin(rng);
+            auto const n = distance(rng);
+            detail::heap_push_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+    };
+
+    /// \sa `is_dary_heap_until_fn`
+    template<std::size_t Arity>
+    struct pop_dary_heap_fn
+    {
+        static_assert(Arity >= 2, "A heap needs an arity of 2 or more.");
+
+        template(typename I, typename S, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+            sortable<I, C, P>)
+        I operator()(I first, S last, C pred = C{}, P proj = P{}) const
+        {
+            auto const n = distance(first, last);
+            detail::heap_pop_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+
+        /// \overload
+        template(typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND sortable<iterator_t<Rng>, C, P>)
+        borrowed_iterator_t<Rng> operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+        {
+            iterator_t<Rng> first = ranges::begin(rng);
+            auto const n = distance(rng);
+            detail::heap_pop_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+    };
+
+    /// \sa `is_dary_heap_until_fn`
+    template<std::size_t Arity>
+    struct make_dary_heap_fn
+    {
+        static_assert(Arity >= 2, "A heap needs an arity of 2 or more.");
+
+        template(typename I, typename S, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+            sortable<I, C, P>)
+        I operator()(I first, S last, C pred = C{}, P proj = P{}) const
+        {
+            auto const n = distance(first, last);
+            detail::heap_make_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+
+        /// \overload
+        template(typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND sortable<iterator_t<Rng>, C, P>)
+        borrowed_iterator_t<Rng> operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+        {
+            iterator_t<Rng> first = ranges::begin(rng);
+            auto const n = distance(rng);
+            detail::heap_make_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+    };
+
+    /// \sa `is_dary_heap_until_fn`
+    template<std::size_t Arity>
+    struct sort_dary_heap_fn
+    {
+        static_assert(Arity >= 2, "A heap needs an arity of 2 or more.");
+
+        template(typename I, typename S, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+            sortable<I, C, P>)
+        I operator()(I first, S last, C pred = C{}, P proj = P{}) const
+        {
+            auto const n = distance(first, last);
+            detail::heap_sort_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+
+        /// \overload
+        template(typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND sortable<iterator_t<Rng>, C, P>)
+        borrowed_iterator_t<Rng> operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+        {
+            iterator_t<Rng> first = ranges::begin(rng);
+            auto const n = distance(rng);
+            detail::heap_sort_n_<Arity>(first, n, pred, proj);
+            return first + n;
+        }
+    };
+
+    /// \sa `is_dary_heap_until_fn`
+#if RANGES_CXX_INLINE_VARIABLES < RANGES_CXX_INLINE_VARIABLES_17
+    namespace
+    {
+        template<std::size_t Arity>
+        constexpr auto & is_dary_heap_until =
+            static_const<is_dary_heap_until_fn<Arity>>::value;
+        template<std::size_t Arity>
+        constexpr auto & is_dary_heap = static_const<is_dary_heap_fn<Arity>>::value;
+        template<std::size_t Arity>
+        constexpr auto & push_dary_heap = static_const<push_dary_heap_fn<Arity>>::value;
+        template<std::size_t Arity>
+        constexpr auto & pop_dary_heap = static_const<pop_dary_heap_fn<Arity>>::value;
+        template<std::size_t Arity>
+        constexpr auto & make_dary_heap = static_const<make_dary_heap_fn<Arity>>::value;
+        template<std::size_t Arity>
+        constexpr auto & sort_dary_heap = static_const<sort_dary_heap_fn<Arity>>::value;
+    } // namespace
+#else  // RANGES_CXX_INLINE_VARIABLES >= RANGES_CXX_INLINE_VARIABLES_17
+    template<std::size_t Arity>
+    inline constexpr is_dary_heap_until_fn<Arity> is_dary_heap_until{};
+    template<std::size_t Arity>
+    inline constexpr is_dary_heap_fn<Arity> is_dary_heap{};
+    template<std::size_t Arity>
+    inline constexpr push_dary_heap_fn<Arity> push_dary_heap{};
+    template<std::size_t Arity>
+    inline constexpr pop_dary_heap_fn<Arity> pop_dary_heap{};
+    template<std::size_t Arity>
+    inline constexpr make_dary_heap_fn<Arity> make_dary_heap{};
+    template<std::size_t Arity>
+    inline constexpr sort_dary_heap_fn<Arity> sort_dary_heap{};
+#endif // RANGES_CXX_INLINE_VARIABLES
     /// @}
 } // namespace ranges
 
@@ -13,6 +13,9 @@
 #ifndef RANGES_V3_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP
 #define RANGES_V3_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP
 
+#include <memory>
+#include <type_traits>
+
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/functional/comparisons.hpp>
@@ -25,12 +28,47 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/simd.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// \cond
+    namespace detail
+    {
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        bool lexicographical_compare_(I0 begin0, S0 end0, I1 begin1, S1 end1, C & pred,
+                                      P0 & proj0, P1 & proj1, std::false_type)
+        {
+            for(; begin1 != end1; ++begin0, ++begin1)
+            {
+                if(begin0 == end0 ||
+                   invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
+                    return true;
+                if(invoke(pred, invoke(proj1, *begin1), invoke(proj0, *begin0)))
+                    return false;
+            }
+            return false;
+        }
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        bool lexicographical_compare_(I0 begin0, S0 end0, I1 begin1, S1 end1, C &, P0 &,
+                                      P1 &, std::true_type)
+        {
+            auto const n0 = end0 - begin0;
+            auto const n1 = end1 - begin1;
+            if(n0 == 0 || n1 == 0)
+                return n0 < n1;
+            return detail::simd_lexicographical_compare(
+                std::addressof(*begin0), n0, std::addressof(*begin1), n1);
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(lexicographical_compare)
 
         /// \brief function template \c lexicographical_compare
@@ -53,15 +91,18 @@ namespace ranges
                                                   P0 proj0 = P0{},
                                                   P1 proj1 = P1{})
         {
-            for(; begin1 != end1; ++begin0, ++begin1)
-            {
-                if(begin0 == end0 ||
-                   invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
-                    return true;
-                if(invoke(pred, invoke(proj1, *begin1), invoke(proj0, *begin0)))
-                    return false;
-            }
-            return false;
+            return detail::lexicographical_compare_(
+                std::move(begin0),
+                std::move(end0),
+                std::move(begin1),
+                std::move(end1),
+                pred,
+                proj0,
+                proj1,
+                meta::bool_<detail::vectorizable_pair<I0, S0, I1, S1> &&
+                            std::is_integral<iter_value_t<I0>>::value &&
+                            same_as<C, less> && same_as<P0, identity> &&
+                            same_as<P1, identity>>{});
         }
 
         /// \overload
@@ -0,0 +1,343 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_LOWER_BOUND_BATCH_HPP
+#define RANGES_V3_ALGORITHM_LOWER_BOUND_BATCH_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/gallop.hpp>
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-algorithms
+    /// @{
+    template<typename I, typename O>
+    using lower_bound_batch_result = detail::in_out_result<I, O>;
+
+    /// Tells \c lower_bound_batch that the queries are sorted by the order of
+    /// the search, so that each search can start where the one before ended.
+    struct sorted_queries_t
+    {};
+
+    RANGES_INLINE_VARIABLE(sorted_queries_t, sorted_queries)
+
+    /// \cond
+    namespace detail
+    {
+        // How many searches lower_bound_batch runs in lockstep. While one
+        // search waits for the cache line it will probe next, the others make
+        // progress.
+        constexpr std::size_t lower_bound_batch_width_ = 16;
+
+        // The results are the iterators themselves, or if the output does not
+        // take those, their offsets from the start of the sequence.
+        template<typename O, typename I>
+        using lower_bound_batch_writes_iterators_t =
+            meta::bool_<indirectly_writable<O, I>>;
+
+        template<typename O, typename I>
+        void lower_bound_batch_put_(O & out, I const &, I it, std::true_type)
+        {
+            *out = std::move(it);
+            ++out;
+        }
+        template<typename O, typename I>
+        void lower_bound_batch_put_(O & out, I const & first, I it, std::false_type)
+        {
+            *out = ranges::distance(first, it);
+            ++out;
+        }
+
+        // The sorted searches know the offset of each result from the start.
+        template<typename O, typename I, typename D>
+        void lower_bound_batch_put_at_(O & out, I it, D, std::true_type)
+        {
+            *out = std::move(it);
+            ++out;
+        }
+        template<typename O, typename I, typename D>
+        void lower_bound_batch_put_at_(O & out, I const &, D offset, std::false_type)
+        {
+            *out = offset;
+            ++out;
+        }
+
+        template<typename I>
+        void lower_bound_batch_prefetch_(I const & it, std::true_type)
+        {
+            RANGES_PREFETCH(std::addressof(*it));
+        }
+        template<typename I>
+        void lower_bound_batch_prefetch_(I const &, std::false_type)
+        {}
+
+        // Up to lower_bound_batch_width_ branchless searches of [first, first + n)
+        // at a time. All the searches of a batch halve ranges of the same
+        // length, so they take their steps together; after each step, each one
+        // prefetches the element it will compare with in the next.
+        template<typename I, typename QI, typename QS, typename O, typename C,
+                 typename P, typename Put>
+        lower_bound_batch_result<QI, O> lower_bound_lockstep_(I first,
+                                                              iter_difference_t<I> n,
+                                                              QI qfirst, QS qlast, O out,
+                                                              C & pred, P & proj, Put put)
+        {
+            using D = iter_difference_t<I>;
+            using contiguous_t = meta::bool_<contiguous_iterator<I>>;
+            constexpr std::size_t width = lower_bound_batch_width_;
+            I base[width];
+            QI query[width];
+            while(qfirst != qlast)
+            {
+                std::size_t m = 0;
+                for(; m < width && qfirst != qlast; ++m, ++qfirst)
+                {
+                    base[m] = first;
+                    query[m] = qfirst;
+                }
+                for(D len = n; len > 1;)
+                {
+                    D const half = len / 2;
+                    len -= half;
+                    for(std::size_t j = 0; j < m; ++j)
+                    {
+                        I const mid = base[j] + half;
+                        base[j] =
+                            invoke(pred, invoke(proj, *mid), *query[j]) ? mid : base[j];
+                        detail::lower_bound_batch_prefetch_(base[j] + len / 2,
+                                                            contiguous_t{});
+                    }
+                }
+                for(std::size_t j = 0; j < m; ++j)
+                {
+                    if(n > 0 && invoke(pred, invoke(proj, *base[j]), *query[j]))
+                        ++base[j];
+                    detail::lower_bound_batch_put_(out, first, std::move(base[j]), put);
+                }
+            }
+            return {qfirst, out};
+        }
+
+        template<typename I, typename S, typename QI, typename QS, typename O,
+                 typename C, typename P, typename Put>
+        lower_bound_batch_result<QI, O> lower_bound_batch_(I first, S last, QI qfirst,
+                                                           QS qlast, O out, C & pred,
+                                                           P & proj, Put put,
+                                                           std::true_type)
+        {
+            auto const n = last - first;
+            return detail::lower_bound_lockstep_(
+                std::move(first), n, std::move(qfirst), std::move(qlast),
+                std::move(out), pred, proj, put);
+        }
+        template<typename I, typename S, typename QI, typename QS, typename O,
+                 typename C, typename P, typename Put>
+        lower_bound_batch_result<QI, O> lower_bound_batch_(I first, S last, QI qfirst,
+                                                           QS qlast, O out, C & pred,
+                                                           P & proj, Put put,
+                                                           std::false_type)
+        {
+            for(; qfirst != qlast; ++qfirst)
+                detail::lower_bound_batch_put_(
+                    out, first, lower_bound(first, last, *qfirst, pred, proj), put);
+            return {qfirst, out};
+        }
+
+        // Moves `it` past the elements that are `before`, given that *it is one,
+        // and returns how far it went.
+        template<typename I, typename S, typename F>
+        iter_difference_t<I> lower_bound_batch_advance_(I & it, S const & last,
+                                                        F & before, std::true_type)
+        {
+            I const from = it;
+            it = detail::gallop_(it, last, before);
+            return it - from;
+        }
+        template<typename I, typename S, typename F>
+        iter_difference_t<I> lower_bound_batch_advance_(I & it, S const & last,
+                                                        F & before, std::false_type)
+        {
+            iter_difference_t<I> d = 0;
+            do
+                ++it, ++d;
+            while(it != last && before(*it));
+            return d;
+        }
+    } // namespace detail
+    /// \endcond
+
+    RANGES_FUNC_BEGIN(lower_bound_batch)
+
+        /// \brief function template \c lower_bound_batch
+        ///
+        /// Writes `ranges::lower_bound(first, last, q, pred, proj)` to `out` for
+        /// each query `q` of `[qfirst, qlast)`, in order. If `out` does not take
+        /// iterators of `[first, last)`, it gets their offsets from `first`
+        /// instead. When `[first, last)` is random-access and sized, the searches
+        /// run in lockstep and prefetch what they will read next, so that many
+        /// of them wait on memory at once rather than one after the other.
+        template(typename I, typename S, typename QI, typename QS, typename O,
+                 typename C = less, typename P = identity)(
+            /// \pre
+            requires forward_iterator<I> AND sentinel_for<S, I> AND
+                forward_iterator<QI> AND sentinel_for<QS, QI> AND
+                weakly_incrementable<O> AND
+                (indirectly_writable<O, I> ||
+                 indirectly_writable<O, iter_difference_t<I>>) AND
+                indirect_strict_weak_order<C, QI, projected<I, P>>)
+        lower_bound_batch_result<QI, O> RANGES_FUNC(lower_bound_batch)(I first,
+                                                                       S last,
+                                                                       QI qfirst,
+                                                                       QS qlast,
+                                                                       O out,
+                                                                       C pred = C{},
+                                                                       P proj = P{})
+        {
+            using put_t = detail::lower_bound_batch_writes_iterators_t<O, I>;
+            using lockstep_t =
+                meta::bool_<random_access_iterator<I> && sized_sentinel_for<S, I>>;
+            return detail::lower_bound_batch_(std::move(first),
+                                              std::move(last),
+                                              std::move(qfirst),
+                                              std::move(qlast),
+                                              std::move(out),
+                                              pred,
+                                              proj,
+                                              put_t{},
+                                              lockstep_t{});
+        }
+
+        /// \overload
+        template(typename Rng, typename Q, typename O, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires forward_range<Rng> AND forward_range<Q> AND
+                weakly_incrementable<O> AND
+                (indirectly_writable<O, iterator_t<Rng>> ||
+                 indirectly_writable<O, range_difference_t<Rng>>) AND
+                indirect_strict_weak_order<C,
+                                           iterator_t<Q>,
+                                           projected<iterator_t<Rng>, P>>)
+        lower_bound_batch_result<borrowed_iterator_t<Q>, O> //
+        RANGES_FUNC(lower_bound_batch)(
+            Rng && rng, Q && queries, O out, C pred = C{}, P proj = P{})
+        {
+            return (*this)(begin(rng),
+                           end(rng),
+                           begin(queries),
+                           end(queries),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+        /// \overload
+        /// The queries are sorted by `pred`, so each search gallops forward from
+        /// where the one before it ended, or steps forward if `[first, last)` is
+        /// not random-access. The searches of `m` queries then take
+        /// `O(m log(n / m))` comparisons in all rather than `O(m log n)`.
+        template(typename I, typename S, typename QI, typename QS, typename O,
+                 typename C = less, typename P = identity)(
+            /// \pre
+            requires forward_iterator<I> AND sentinel_for<S, I> AND
+                input_iterator<QI> AND sentinel_for<QS, QI> AND
+                weakly_incrementable<O> AND
+                (indirectly_writable<O, I> ||
+                 indirectly_writable<O, iter_difference_t<I>>) AND
+                indirect_strict_weak_order<C, QI, projected<I, P>>)
+        lower_bound_batch_result<QI, O> RANGES_FUNC(lower_bound_batch)(sorted_queries_t,
+                                                                       I first,
+                                                                       S last,
+                                                                       QI qfirst,
+                                                                       QS qlast,
+                                                                       O out,
+                                                                       C pred = C{},
+                                                                       P proj = P{})
+        {
+            using put_t = detail::lower_bound_batch_writes_iterators_t<O, I>;
+            using gallop_t = detail::gallopable_t<I, S>;
+            I it = first;
+            iter_difference_t<I> offset = 0;
+            for(; qfirst != qlast; ++qfirst)
+            {
+                auto && q = *qfirst;
+                auto before = [&](iter_reference_t<I> e) -> bool {
+                    return invoke(pred, invoke(proj, e), q);
+                };
+                if(it != last && before(*it))
+                    offset +=
+                        detail::lower_bound_batch_advance_(it, last, before, gallop_t{});
+                detail::lower_bound_batch_put_at_(out, it, offset, put_t{});
+            }
+            return {qfirst, out};
+        }
+
+        /// \overload
+        template(typename Rng, typename Q, typename O, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires forward_range<Rng> AND input_range<Q> AND
+                weakly_incrementable<O> AND
+                (indirectly_writable<O, iterator_t<Rng>> ||
+                 indirectly_writable<O, range_difference_t<Rng>>) AND
+                indirect_strict_weak_order<C,
+                                           iterator_t<Q>,
+                                           projected<iterator_t<Rng>, P>>)
+        lower_bound_batch_result<borrowed_iterator_t<Q>, O> //
+        RANGES_FUNC(lower_bound_batch)(sorted_queries_t sorted,
+                                       Rng && rng,
+                                       Q && queries,
+                                       O out,
+                                       C pred = C{},
+                                       P proj = P{})
+        {
+            return (*this)(sorted,
+                           begin(rng),
+                           end(rng),
+                           begin(queries),
+                           end(queries),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+    RANGES_FUNC_END(lower_bound_batch)
+
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -27,6 +27,7 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/memmove.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -36,6 +37,26 @@ namespace ranges
     template<typename I, typename O>
     using move_backward_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename O>
+        move_backward_result<I, O> move_backward_(I first, I last, O out, std::false_type)
+        {
+            I i = last;
+            while(first != i)
+                *--out = iter_move(--i);
+            return {last, out};
+        }
+
+        template<typename I, typename O>
+        move_backward_result<I, O> move_backward_(I first, I last, O out, std::true_type)
+        {
+            return {last, detail::memmove_backward_n(first, last - first, out)};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(move_backward)
 
         /// \brief function template \c move_backward
@@ -45,10 +66,11 @@ namespace ranges
             bidirectional_iterator<O> AND indirectly_movable<I, O>)
         move_backward_result<I, O> RANGES_FUNC(move_backward)(I first, S end_, O out) //
         {
-            I i = ranges::next(first, end_), last = i;
-            while(first != i)
-                *--out = iter_move(--i);
-            return {last, out};
+            I last = ranges::next(first, end_);
+            return detail::move_backward_(std::move(first),
+                                          std::move(last),
+                                          std::move(out),
+                                          meta::bool_<detail::memmove_movable<I, O>>{});
         }
 
         /// \overload
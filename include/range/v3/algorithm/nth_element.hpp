@@ -23,6 +23,8 @@
 #ifndef RANGES_V3_ALGORITHM_NTH_ELEMENT_HPP
 #define RANGES_V3_ALGORITHM_NTH_ELEMENT_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -99,215 +101,222 @@ namespace ranges
                     ranges::iter_swap(first, i);
             }
         }
-    } // namespace detail
-    /// \endcond
 
-    /// \addtogroup group-algorithms
-    /// @{
-    RANGES_FUNC_BEGIN(nth_element)
+        // Puts the at most 7 elements of [first, last) in order.
+        template<typename I, typename C, typename P>
+        void nth_element_small_(I first, I last, C & pred, P & proj)
+        {
+            switch(last - first)
+            {
+            case 0:
+            case 1:
+                return;
+            case 2:
+                if(invoke(pred, invoke(proj, *--last), invoke(proj, *first)))
+                    ranges::iter_swap(first, last);
+                return;
+            case 3:
+            {
+                I m = first;
+                detail::sort3(first, ++m, --last, pred, proj);
+                return;
+            }
+            default:
+                detail::selection_sort(first, last, pred, proj);
+            }
+        }
 
-        /// \brief function template \c nth_element
-        template(typename I, typename S, typename C = less, typename P = identity)(
-            /// \pre
-            requires random_access_iterator<I> AND sortable<I, C, P>)
-        I RANGES_FUNC(nth_element)(
-            I first, I nth, S end_, C pred = C{}, P proj = P{}) //
+        // Partitions [first, last) around *first, and returns where the pivot
+        // ends up: no element before it is greater, and none after it is less.
+        // Both scans stop at elements equivalent to the pivot, so runs of them
+        // split evenly instead of piling up on one side.
+        template<typename I, typename C, typename P>
+        I nth_element_partition_(I first, I last, C & pred, P & proj)
         {
-            I last = ranges::next(nth, end_), end_orig = last;
-            // C is known to be a reference type
-            using difference_type = iter_difference_t<I>;
-            difference_type const limit = 7;
+            I i = first, j = last;
             while(true)
             {
-            restart:
-                if(nth == last)
-                    return end_orig;
-                difference_type len = last - first;
-                switch(len)
-                {
-                case 0:
-                case 1:
-                    return end_orig;
-                case 2:
-                    if(invoke(pred, invoke(proj, *--last), invoke(proj, *first)))
-                        ranges::iter_swap(first, last);
-                    return end_orig;
-                case 3:
-                {
-                    I m = first;
-                    detail::sort3(first, ++m, --last, pred, proj);
-                    return end_orig;
-                }
-                }
-                if(len <= limit)
-                {
-                    detail::selection_sort(first, last, pred, proj);
-                    return end_orig;
-                }
-                // len > limit >= 3
-                I m = first + len / 2;
-                I lm1 = last;
-                unsigned n_swaps = detail::sort3(first, m, --lm1, pred, proj);
-                // *m is median
-                // partition [first, m) < *m and *m <= [m, last)
-                //(this inhibits tossing elements equivalent to m around unnecessarily)
-                I i = first;
-                I j = lm1;
-                // j points beyond range to be tested, *lm1 is known to be <= *m
-                // The search going up is known to be guarded but the search coming down
-                // isn't. Prime the downward search with a guard.
-                if(!invoke(pred, invoke(proj, *i), invoke(proj, *m))) // if *first == *m
+                while(++i != j && invoke(pred, invoke(proj, *i), invoke(proj, *first)))
+                    ;
+                while(invoke(pred, invoke(proj, *first), invoke(proj, *--j)))
+                    ;
+                if(i >= j)
+                    break;
+                ranges::iter_swap(i, j);
+            }
+            ranges::iter_swap(first, j);
+            return j;
+        }
+
+        // Blum, Floyd, Pratt, Rivest and Tarjan's selection: the pivot is the
+        // median of the medians of groups of five, which has at least 30% of
+        // the elements on either side. It takes linear time whatever the
+        // input, but is several times slower than picking pivots by sampling.
+        template<typename I, typename C, typename P>
+        void nth_element_linear_(I first, I nth, I last, C & pred, P & proj)
+        {
+            while(last - first > 7)
+            {
+                I medians = first;
+                for(I g = first; last - g >= 5; g += 5)
                 {
-                    // *first == *m, *first doesn't go in first part
-                    // manually guard downward moving j against i
-                    while(true)
-                    {
-                        if(i == --j)
-                        {
-                            // *first == *m, *m <= all other elements
-                            // Parition instead into [first, i) == *first and *first < [i,
-                            // last)
-                            ++i; // first + 1
-                            j = last;
-                            if(!invoke(
-                                   pred,
-                                   invoke(proj, *first),
-                                   invoke(
-                                       proj,
-                                       *--j))) // we need a guard if *first == *(last-1)
-                            {
-                                while(true)
-                                {
-                                    if(i == j)
-                                        return end_orig; // [first, last) all equivalent
-                                                         // elements
-                                    if(invoke(
-                                           pred, invoke(proj, *first), invoke(proj, *i)))
-                                    {
-                                        ranges::iter_swap(i, j);
-                                        ++n_swaps;
-                                        ++i;
-                                        break;
-                                    }
-                                    ++i;
-                                }
-                            }
-                            // [first, i) == *first and *first < [j, last) and j == last -
-                            // 1
-                            if(i == j)
-                                return end_orig;
-                            while(true)
-                            {
-                                while(
-                                    !invoke(pred, invoke(proj, *first), invoke(proj, *i)))
-                                    ++i;
-                                while(invoke(
-                                    pred, invoke(proj, *first), invoke(proj, *--j)))
-                                    ;
-                                if(i >= j)
-                                    break;
-                                ranges::iter_swap(i, j);
-                                ++n_swaps;
-                                ++i;
-                            }
-                            // [first, i) == *first and *first < [i, last)
-                            // The first part is sorted,
-                            if(nth < i)
-                                return end_orig;
-                            // nth_element the second part
-                            // nth_element<C>(i, nth, last, pred);
-                            first = i;
-                            goto restart;
-                        }
-                        if(invoke(pred, invoke(proj, *j), invoke(proj, *m)))
-                        {
-                            ranges::iter_swap(i, j);
-                            ++n_swaps;
-                            break; // found guard for downward moving j, now use unguarded
-                                   // partition
-                        }
-                    }
+                    detail::selection_sort(g, g + 5, pred, proj);
+                    ranges::iter_swap(medians++, g + 2);
                 }
-                ++i;
-                // j points beyond range to be tested, *lm1 is known to be <= *m
-                // if not yet partitioned...
-                if(i < j)
+                I const mid = first + (medians - first) / 2;
+                detail::nth_element_linear_(first, mid, medians, pred, proj);
+
+                // Splits [first, last) into the elements less than the pivot,
+                // equivalent to it, and greater than it, so that each round drops
+                // at least 30% of them even if many are equivalent.
+                ranges::iter_swap(first, mid);
+                I lt = first + 1, i = lt, gt = last;
+                while(i != gt)
                 {
-                    // known that *(i - 1) < *m
-                    while(true)
-                    {
-                        // m still guards upward moving i
-                        while(invoke(pred, invoke(proj, *i), invoke(proj, *m)))
-                            ++i;
-                        // It is now known that a guard exists for downward moving j
-                        while(!invoke(pred, invoke(proj, *--j), invoke(proj, *m)))
-                            ;
-                        if(i >= j)
-                            break;
-                        ranges::iter_swap(i, j);
-                        ++n_swaps;
-                        // It is known that m != j
-                        // If m just moved, follow it
-                        if(m == i)
-                            m = j;
+                    if(invoke(pred, invoke(proj, *i), invoke(proj, *first)))
+                        ranges::iter_swap(lt++, i++);
+                    else if(invoke(pred, invoke(proj, *first), invoke(proj, *i)))
+                        ranges::iter_swap(i, --gt);
+                    else
                         ++i;
-                    }
-                }
-                // [first, i) < *m and *m <= [i, last)
-                if(i != m && invoke(pred, invoke(proj, *m), invoke(proj, *i)))
-                {
-                    ranges::iter_swap(i, m);
-                    ++n_swaps;
                 }
-                // [first, i) < *i and *i <= [i+1, last)
-                if(nth == i)
-                    return end_orig;
-                if(n_swaps == 0)
+                ranges::iter_swap(first, --lt);
+                if(nth < lt)
+                    last = lt;
+                else if(gt <= nth)
+                    first = gt;
+                else
+                    return;
+            }
+            detail::nth_element_small_(first, last, pred, proj);
+        }
+
+        // Ranges longer than this pick their pivot by Floyd and Rivest's
+        // sampling.
+        constexpr int nth_element_sample_cutoff_ = 600;
+
+        // The window of a range of `n` elements that Floyd and Rivest's SELECT
+        // recurses on to find the pivot for rank `k`: about n^(2/3) elements
+        // around `k`, skewed toward the middle so that the pivot lands just on
+        // the far side of the element sought.
+        template<typename D>
+        std::pair<D, D> nth_element_window_(D n, D k)
+        {
+            double const dn = static_cast<double>(n), dk = static_cast<double>(k);
+            double const z = std::log(dn);
+            double const s = 0.5 * std::exp(2 * z / 3);
+            double const sd =
+                (2 * dk < dn ? -0.5 : 0.5) * std::sqrt(z * s * (dn - s) / dn);
+            auto lo = static_cast<D>((std::max)(0.0, dk - dk * s / dn + sd));
+            auto hi = static_cast<D>((std::min)(dn, dk + (dn - dk) * s / dn + sd));
+            return {(std::min)(lo, k), (std::max)(hi, static_cast<D>(k + 1))};
+        }
+
+        // Introselect: quickselect whose pivots come from a sample of the range,
+        // and which falls back on the median of medians as soon as two rounds
+        // in a row fail to halve the range, as they may for inputs that are
+        // not random (Musser). The rounds before the fallback thus partition
+        // ranges that shrink geometrically, so it takes linear time in the
+        // worst case, and close to `n + min(k, n - k)` comparisons on average.
+        template<typename I, typename C, typename P>
+        void nth_element_(I first, I nth, I last, C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            D checked = last - first;
+            for(int rounds = 0; last - first > 7; ++rounds)
+            {
+                D const len = last - first;
+                if(rounds == 2)
                 {
-                    // We were given a perfectly partitioned sequence.  Coincidence?
-                    if(nth < i)
+                    if(len > checked / 2)
                     {
-                        // Check for [first, i) already sorted
-                        j = m = first;
-                        while(++j != i)
-                        {
-                            if(invoke(pred, invoke(proj, *j), invoke(proj, *m)))
-                                // not yet sorted, so sort
-                                goto not_sorted;
-                            m = j;
-                        }
-                        // [first, i) sorted
-                        return end_orig;
-                    }
-                    else
-                    {
-                        // Check for [i, last) already sorted
-                        j = m = i;
-                        while(++j != last)
-                        {
-                            if(invoke(pred, invoke(proj, *j), invoke(proj, *m)))
-                                // not yet sorted, so sort
-                                goto not_sorted;
-                            m = j;
-                        }
-                        // [i, last) sorted
-                        return end_orig;
+                        detail::nth_element_linear_(first, nth, last, pred, proj);
+                        return;
                     }
+                    checked = len;
+                    rounds = 0;
                 }
-            not_sorted:
-                // nth_element on range containing nth
-                if(nth < i)
+                I pivot;
+                if(len > nth_element_sample_cutoff_)
                 {
-                    // nth_element<C>(first, nth, i, pred);
-                    last = i;
+                    // Floyd and Rivest take the window as it is, which is only a
+                    // fair sample if the input is in random order. Elements from
+                    // across the range go into it first, and then its element of
+                    // the rank of nth goes to nth.
+                    auto const w = detail::nth_element_window_(len, D(nth - first));
+                    D const step = len / (w.second - w.first);
+                    for(D i = w.first, j = 0; i != w.second; ++i, j += step)
+                        ranges::iter_swap(first + i, first + j);
+                    detail::nth_element_(
+                        first + w.first, nth, first + w.second, pred, proj);
+                    pivot = nth;
                 }
                 else
                 {
-                    // nth_element<C>(i+1, nth, last, pred);
-                    first = ++i;
+                    pivot = first + len / 2;
+                    I lm1 = last;
+                    detail::sort3(first, pivot, --lm1, pred, proj);
                 }
+                ranges::iter_swap(first, pivot);
+                I const cut = detail::nth_element_partition_(first, last, pred, proj);
+                if(cut == nth)
+                    return;
+                if(nth < cut)
+                    last = cut;
+                else
+                    first = cut + 1;
+            }
+            detail::nth_element_small_(first, last, pred, proj);
+        }
+
+        // Selects the ranks [pfirst, plast), which are sorted offsets from
+        // `origin` that fall in [first, last): the middle one first, and then
+        // those on each side of it in the part of the range on that side.
+        template<typename I, typename PI, typename C, typename P>
+        void nth_elements_(I origin, I first, I last, PI pfirst, PI plast, C & pred,
+                           P & proj)
+        {
+            while(pfirst != plast)
+            {
+                PI pm = pfirst + (plast - pfirst) / 2;
+                I const nth = origin + static_cast<iter_difference_t<I>>(*pm);
+                RANGES_EXPECT(first <= nth && nth < last);
+                detail::nth_element_(first, nth, last, pred, proj);
+                // Repeated ranks are done with.
+                PI lo = pm;
+                while(lo != pfirst && origin + static_cast<iter_difference_t<I>>(
+                                                   *(lo - 1)) == nth)
+                    --lo;
+                detail::nth_elements_(origin, first, nth, pfirst, lo, pred, proj);
+                while(++pm != plast &&
+                      origin + static_cast<iter_difference_t<I>>(*pm) == nth)
+                    ;
+                first = nth + 1;
+                pfirst = pm;
             }
-            return end_orig;
+        }
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-algorithms
+    /// @{
+    RANGES_FUNC_BEGIN(nth_element)
+
+        /// \brief function template \c nth_element
+        ///
+        /// Picks pivots by Floyd and Rivest's sampling, and falls back on the
+        /// median of medians when they do badly, so it takes linear time in the
+        /// worst case.
+        template(typename I, typename S, typename C = less, typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sortable<I, C, P>)
+        I RANGES_FUNC(nth_element)(
+            I first, I nth, S end_, C pred = C{}, P proj = P{}) //
+        {
+            I last = ranges::next(nth, end_);
+            if(nth != last)
+                detail::nth_element_(std::move(first), std::move(nth), last, pred, proj);
+            return last;
         }
 
         /// \overload
@@ -323,6 +332,55 @@ namespace ranges
 
     RANGES_FUNC_END(nth_element)
 
+    RANGES_FUNC_BEGIN(nth_elements)
+
+        /// \brief function template \c nth_elements
+        ///
+        /// Does what `nth_element(first, first + r, last)` does for every rank
+        /// `r` of `[pfirst, plast)`, at once: each element of such a rank ends up
+        /// where it would be if the range were sorted, with no greater element
+        /// before it and no lesser one after. Finding `m` ranks of `n` elements
+        /// takes `O(n log m)` time rather than `O(n m)`, so that many quantiles
+        /// cost little more than one.
+        ///
+        /// \pre The ranks are sorted, and each is in `[0, last - first)`.
+        template(typename I, typename S, typename PI, typename PS, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+                sortable<I, C, P> AND random_access_iterator<PI> AND
+                sized_sentinel_for<PS, PI> AND
+                convertible_to<iter_reference_t<PI>, iter_difference_t<I>>)
+        I RANGES_FUNC(nth_elements)(
+            I first, S end_, PI pfirst, PS plast, C pred = C{}, P proj = P{}) //
+        {
+            I last = ranges::next(first, end_);
+            detail::nth_elements_(
+                first, first, last, pfirst, pfirst + (plast - pfirst), pred, proj);
+            return last;
+        }
+
+        /// \overload
+        template(typename Rng, typename Ranks, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND sortable<iterator_t<Rng>, C, P> AND
+                random_access_range<Ranks> AND sized_range<Ranks> AND
+                convertible_to<range_reference_t<Ranks>, range_difference_t<Rng>>)
+        borrowed_iterator_t<Rng> RANGES_FUNC(nth_elements)(
+            Rng && rng, Ranks && ranks, C pred = C{}, P proj = P{}) //
+        {
+            auto pfirst = begin(ranks);
+            return (*this)(begin(rng),
+                           end(rng),
+                           pfirst,
+                           pfirst + ranges::distance(ranks),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+    RANGES_FUNC_END(nth_elements)
+
     namespace cpp20
     {
         using ranges::nth_element;
@@ -0,0 +1,444 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+#define RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        template<std::size_t Size>
+        struct radix_uint_;
+        template<>
+        struct radix_uint_<1>
+        {
+            using type = std::uint8_t;
+        };
+        template<>
+        struct radix_uint_<2>
+        {
+            using type = std::uint16_t;
+        };
+        template<>
+        struct radix_uint_<4>
+        {
+            using type = std::uint32_t;
+        };
+        template<>
+        struct radix_uint_<8>
+        {
+            using type = std::uint64_t;
+        };
+
+        // Maps keys to unsigned integers of the same width that order the same
+        // way: signed integers have their sign bit flipped, and IEEE floats are
+        // ordered -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN.
+        template<typename K, typename = void>
+        struct radix_traits_
+        {};
+        template<typename K>
+        struct radix_traits_<K, meta::if_c<std::is_integral<K>::value &&
+                                           !std::is_same<K, bool>::value>>
+        {
+            using bits_t = typename radix_uint_<sizeof(K)>::type;
+            static constexpr bits_t bits(K k) noexcept
+            {
+                return std::is_signed<K>::value
+                           ? static_cast<bits_t>(static_cast<bits_t>(k) ^
+                                                 (bits_t(1) << (sizeof(K) * 8 - 1)))
+                           : static_cast<bits_t>(k);
+            }
+        };
+        template<typename K>
+        struct radix_traits_<K, meta::if_c<std::is_floating_point<K>::value &&
+                                           std::numeric_limits<K>::is_iec559 &&
+                                           (sizeof(K) == 4 || sizeof(K) == 8)>>
+        {
+            using bits_t = typename radix_uint_<sizeof(K)>::type;
+            static bits_t bits(K k) noexcept
+            {
+                bits_t u;
+                std::memcpy(&u, &k, sizeof(K));
+                bits_t const sign = bits_t(1) << (sizeof(K) * 8 - 1);
+                return (u & sign) ? static_cast<bits_t>(~u)
+                                  : static_cast<bits_t>(u | sign);
+            }
+        };
+
+        template<typename K>
+        using radix_bits_t = typename radix_traits_<K>::bits_t;
+
+        // clang-format off
+        template<typename K>
+        CPP_concept radix_key_ =
+            meta::is_trait<meta::defer<radix_bits_t, K>>::value;
+        // clang-format on
+
+        // Projects an element onto the unsigned form of its key.
+        template<typename P>
+        struct radix_bits_fn
+        {
+            P & proj;
+
+            template<typename T>
+            auto operator()(T && t) const
+            {
+                using K = uncvref_t<invoke_result_t<P &, T>>;
+                return radix_traits_<K>::bits(invoke(proj, static_cast<T &&>(t)));
+            }
+        };
+
+        template<typename Bits>
+        constexpr std::size_t radix_digit_(Bits bits, std::size_t byte) noexcept
+        {
+            return static_cast<std::size_t>(bits >> (byte * 8)) & 0xff;
+        }
+
+        // Below this many elements insertion sort beats another pass.
+        constexpr std::ptrdiff_t radix_sort_cutoff_ = 48;
+
+        // Destroys the elements that a pass constructed in the scratch space.
+        template<typename V>
+        struct radix_buffer_guard_
+        {
+            V * data;
+            std::ptrdiff_t size = 0;
+
+            ~radix_buffer_guard_()
+            {
+                for(std::ptrdiff_t i = 0; i < size; ++i)
+                    data[i].~V();
+            }
+        };
+
+        // Moves [src, src + n) to where the counting of the digits puts them in
+        // dst, constructing them there if dst is raw storage.
+        template<typename Src, typename Dst, typename F, typename Construct>
+        void radix_scatter_(Src src, std::ptrdiff_t n, Dst dst, std::ptrdiff_t * offsets,
+                            std::size_t byte, F & bits, Construct)
+        {
+            for(std::ptrdiff_t i = 0; i < n; ++i, ++src)
+            {
+                auto & at = offsets[detail::radix_digit_(bits(*src), byte)];
+                if(Construct::value)
+                    ::new(static_cast<void *>(std::addressof(dst[at])))
+                        iter_value_t<Src>(iter_move(src));
+                else
+                    dst[at] = iter_move(src);
+                ++at;
+            }
+        }
+
+        // Least-significant-digit first: one counting pass for all the digits,
+        // then one stable scatter per digit, back and forth between the sequence
+        // and the buffer. Digits that all keys share are skipped.
+        template<typename I, typename V, typename P>
+        void radix_sort_lsd(I first, std::ptrdiff_t n, V * buffer, P & proj)
+        {
+            auto bits = detail::radix_bits_fn<P>{proj};
+            using Bits = decltype(bits(*first));
+            constexpr std::size_t digits = sizeof(Bits);
+            std::array<std::array<std::ptrdiff_t, 256>, digits> counts{};
+            Bits const some = bits(*first);
+            {
+                I it = first;
+                for(std::ptrdiff_t i = 0; i < n; ++i, ++it)
+                {
+                    Bits const b = bits(*it);
+                    for(std::size_t d = 0; d < digits; ++d)
+                        ++counts[d][detail::radix_digit_(b, d)];
+                }
+            }
+
+            radix_buffer_guard_<V> guard{buffer};
+            bool in_buffer = false;
+            if(!std::is_nothrow_move_constructible<V>::value)
+            {
+                // Fill the buffer one element at a time so that only elements
+                // that were constructed get destroyed if a move throws.
+                for(I it = first; guard.size < n; ++guard.size, ++it)
+                    ::new(static_cast<void *>(buffer + guard.size)) V(iter_move(it));
+                in_buffer = true;
+            }
+            for(std::size_t d = 0; d < digits; ++d)
+            {
+                auto & count = counts[d];
+                if(count[detail::radix_digit_(some, d)] == n)
+                    continue;
+                std::array<std::ptrdiff_t, 256> offsets;
+                std::ptrdiff_t sum = 0;
+                for(std::size_t i = 0; i < 256; ++i)
+                {
+                    offsets[i] = sum;
+                    sum += count[i];
+                }
+                if(in_buffer)
+                    detail::radix_scatter_(
+                        buffer, n, first, offsets.data(), d, bits, std::false_type{});
+                else if(guard.size == 0)
+                {
+                    detail::radix_scatter_(
+                        first, n, buffer, offsets.data(), d, bits, std::true_type{});
+                    guard.size = n;
+                }
+                else
+                    detail::radix_scatter_(
+                        first, n, buffer, offsets.data(), d, bits, std::false_type{});
+                in_buffer = !in_buffer;
+            }
+            if(in_buffer)
+            {
+                V * src = buffer;
+                for(std::ptrdiff_t i = 0; i < n; ++i, ++src, ++first)
+                    *first = iter_move(src);
+            }
+        }
+
+        template<typename I, typename V, typename P>
+        void radix_sort_buffered(I first, I last, V * buffer, P & proj)
+        {
+            auto const n = static_cast<std::ptrdiff_t>(last - first);
+            if(n < detail::radix_sort_cutoff_)
+            {
+                auto bits = detail::radix_bits_fn<P>{proj};
+                less pred;
+                detail::insertion_sort(first, last, pred, bits);
+            }
+            else
+                detail::radix_sort_lsd(first, n, buffer, proj);
+        }
+
+        // Most-significant-digit first, in place: the elements are permuted into
+        // their buckets along cycles, American flag style, and then each bucket
+        // is sorted on the next digit.
+        template<typename I, typename P>
+        void american_flag_sort_(I first, std::ptrdiff_t n, std::size_t byte, P & proj)
+        {
+            auto bits = detail::radix_bits_fn<P>{proj};
+            while(true)
+            {
+                if(n < detail::radix_sort_cutoff_)
+                {
+                    less pred;
+                    detail::insertion_sort(first, first + n, pred, bits);
+                    return;
+                }
+                std::array<std::ptrdiff_t, 256> counts{};
+                for(std::ptrdiff_t i = 0; i < n; ++i)
+                    ++counts[detail::radix_digit_(bits(first[i]), byte)];
+                if(counts[detail::radix_digit_(bits(*first), byte)] == n)
+                {
+                    if(byte-- == 0)
+                        return;
+                    continue;
+                }
+
+                std::array<std::ptrdiff_t, 256> next, ends;
+                std::ptrdiff_t sum = 0;
+                for(std::size_t i = 0; i < 256; ++i)
+                {
+                    next[i] = sum;
+                    ends[i] = sum += counts[i];
+                }
+                for(std::size_t b = 0; b < 256; ++b)
+                {
+                    while(next[b] != ends[b])
+                    {
+                        auto const d = detail::radix_digit_(bits(first[next[b]]), byte);
+                        if(d == b)
+                            ++next[b];
+                        else
+                            ranges::iter_swap(first + next[b], first + next[d]++);
+                    }
+                }
+                if(byte == 0)
+                    return;
+                for(std::size_t b = 0; b < 256; ++b)
+                    if(counts[b] > 1)
+                        detail::american_flag_sort_(
+                            first + (ends[b] - counts[b]), counts[b], byte - 1, proj);
+                return;
+            }
+        }
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-concepts
+    /// @{
+
+    // clang-format off
+    /// \concept radix_sortable_
+    /// \brief The \c radix_sortable_ concept
+    template(typename I, typename P)(
+    concept (radix_sortable_)(I, P),
+        detail::radix_key_<uncvref_t<indirect_result_t<P &, I>>>);
+
+    /// \concept radix_sortable
+    /// \brief The \c radix_sortable concept
+    template<typename I, typename P = identity>
+    CPP_concept radix_sortable =
+        permutable<I> &&
+        indirectly_regular_unary_invocable<P, I> &&
+        CPP_concept_ref(ranges::radix_sortable_, I, P);
+    // clang-format on
+    /// @}
+
+    /// \addtogroup group-algorithms
+    /// @{
+    RANGES_FUNC_BEGIN(radix_sort)
+
+        /// \brief function template \c radix_sort
+        ///
+        /// Sorts by the projected keys, which are integers other than \c bool or
+        /// IEEE \c float or \c double, without comparing them. The sort is
+        /// stable. It makes one pass per byte of the key, skipping bytes that
+        /// are the same for all keys, and uses a buffer as large as the sequence.
+        /// Without one it falls back on an in-place stable sort.
+        template(typename I, typename S, typename P = identity)(
+            /// \pre
+            requires radix_sortable<I, P> AND random_access_iterator<I> AND
+                sentinel_for<S, I>)
+        I RANGES_FUNC(radix_sort)(I first, S end_, P proj = P{})
+        {
+            I last = ranges::next(first, end_);
+            using V = iter_value_t<I>;
+            auto const n = static_cast<std::ptrdiff_t>(last - first);
+            if(n < detail::radix_sort_cutoff_)
+            {
+                detail::radix_sort_buffered(first, last, static_cast<V *>(nullptr), proj);
+                return last;
+            }
+            auto buf = detail::get_temporary_buffer<V>(n);
+            std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+            if(buf.second < n)
+            {
+                auto bits = detail::radix_bits_fn<P>{proj};
+                less pred;
+                detail::inplace_stable_sort(first, last, pred, bits);
+            }
+            else
+                detail::radix_sort_lsd(first, n, buf.first, proj);
+            return last;
+        }
+
+        /// \overload
+        template(typename Rng, typename P = identity)(
+            /// \pre
+            requires radix_sortable<iterator_t<Rng>, P> AND random_access_range<Rng>)
+        borrowed_iterator_t<Rng> RANGES_FUNC(radix_sort)(Rng && rng, P proj = P{})
+        {
+            return (*this)(begin(rng), end(rng), std::move(proj));
+        }
+
+        /// \overload
+        /// Sorts with the storage of `buf`, which it grows to the length of the
+        /// sequence if need be, as the buffer.
+        template(typename I, typename S, typename A, typename P = identity)(
+            /// \pre
+            requires radix_sortable<I, P> AND random_access_iterator<I> AND
+                sentinel_for<S, I>)
+        I RANGES_FUNC(radix_sort)(I first, S end_,
+                                  scratch_buffer<iter_value_t<I>, A> & buf,
+                                  P proj = P{})
+        {
+            I last = ranges::next(first, end_);
+            buf.reserve(static_cast<std::ptrdiff_t>(last - first));
+            detail::radix_sort_buffered(first, last, buf.data(), proj);
+            return last;
+        }
+
+        /// \overload
+        template(typename Rng, typename A, typename P = identity)(
+            /// \pre
+            requires radix_sortable<iterator_t<Rng>, P> AND random_access_range<Rng>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(radix_sort)(Rng && rng, scratch_buffer<range_value_t<Rng>, A> & buf,
+                                P proj = P{})
+        {
+            return (*this)(begin(rng), end(rng), buf, std::move(proj));
+        }
+
+    RANGES_FUNC_END(radix_sort)
+
+    RANGES_FUNC_BEGIN(american_flag_sort)
+
+        /// \brief function template \c american_flag_sort
+        ///
+        /// Sorts by the projected keys like \c radix_sort, but in place and
+        /// without stability: a byte at a time from the most significant one,
+        /// swapping the elements into their buckets and then sorting each bucket
+        /// on the next byte.
+        template(typename I, typename S, typename P = identity)(
+            /// \pre
+            requires radix_sortable<I, P> AND random_access_iterator<I> AND
+                sentinel_for<S, I>)
+        I RANGES_FUNC(american_flag_sort)(I first, S end_, P proj = P{})
+        {
+            I last = ranges::next(first, end_);
+            using K = uncvref_t<indirect_result_t<P &, I>>;
+            detail::american_flag_sort_(first,
+                                        static_cast<std::ptrdiff_t>(last - first),
+                                        sizeof(detail::radix_bits_t<K>) - 1,
+                                        proj);
+            return last;
+        }
+
+        /// \overload
+        template(typename Rng, typename P = identity)(
+            /// \pre
+            requires radix_sortable<iterator_t<Rng>, P> AND random_access_range<Rng>)
+        borrowed_iterator_t<Rng> RANGES_FUNC(american_flag_sort)(Rng && rng,
+                                                                 P proj = P{})
+        {
+            return (*this)(begin(rng), end(rng), std::move(proj));
+        }
+
+    RANGES_FUNC_END(american_flag_sort)
+
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
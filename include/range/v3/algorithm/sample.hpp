@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
 #define RANGES_V3_ALGORITHM_SAMPLE_HPP
 
+#include <random>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -29,6 +30,7 @@
 #include <range/v3/utility/random.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/sample_skip.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -51,23 +53,77 @@ namespace ranges
         {
             if(pop_size > 0 && sample_size > 0)
             {
-                std::uniform_int_distribution<iter_difference_t<I>> dist;
-                using param_t = typename decltype(dist)::param_type;
-                for(; first != last; ++first)
+                using D = iter_difference_t<I>;
+                // Skips straight to each element it picks; see sample_skip_.
+                detail::sample_skip_<D> skip;
+                while(true)
                 {
                     if(sample_size >= pop_size)
                         return copy_n(std::move(first), pop_size, std::move(out));
 
-                    if(dist(gen, param_t{0, --pop_size}) < sample_size)
+                    D const s = skip(pop_size, static_cast<D>(sample_size), gen);
+                    ranges::advance(first, s, last);
+                    pop_size -= s + 1;
+                    *out = *first;
+                    ++out;
+                    if(--sample_size == 0)
+                        break;
+                    ++first;
+                }
+            }
+
+            return {std::move(first), std::move(out)};
+        }
+
+        // Fills the reservoir [out, out + n) from a range of unknown length.
+        template<typename I, typename S, typename O, typename Gen>
+        sample_result<I, O> sample_reservoir_impl(I first, S last, O out,
+                                                  iter_difference_t<O> const n,
+                                                  Gen && gen)
+        {
+            if(n > 0)
+            {
+                for(iter_difference_t<O> i = 0; i < n; (void)++i, ++first)
+                {
+                    if(first == last)
                     {
-                        *out = *first;
-                        ++out;
-                        if(--sample_size == 0)
-                            break;
+                        advance(out, i);
+                        return {std::move(first), std::move(out)};
                     }
+                    *next(out, i) = *first;
+                }
+
+                // While most elements still replace one in the reservoir, a
+                // draw for each is cheaper than working out the skips.
+                std::uniform_int_distribution<iter_difference_t<O>> dist;
+                using param_t = typename decltype(dist)::param_type;
+                iter_difference_t<O> seen = n;
+                for(; seen / 8 < n; (void)++seen, ++first)
+                {
+                    if(first == last)
+                    {
+                        advance(out, n);
+                        return {std::move(first), std::move(out)};
+                    }
+                    auto const k = dist(gen, param_t{0, seen});
+                    if(k < n)
+                        *next(out, k) = *first;
+                }
+
+                // Then skips the elements that do not replace one; see
+                // reservoir_skip_.
+                detail::reservoir_skip_<iter_difference_t<I>> skip(n, seen, gen);
+                while(true)
+                {
+                    ranges::advance(first, skip(gen), last);
+                    if(first == last)
+                        break;
+                    *next(out, dist(gen, param_t{0, n - 1})) = *first;
+                    ++first;
                 }
-            }
 
+                advance(out, n);
+            }
             return {std::move(first), std::move(out)};
         }
     } // namespace detail
@@ -106,31 +162,11 @@ namespace ranges
             {
                 // out is random-access here; calls to advance(out,n) and
                 // next(out,n) are O(1).
-                if(n > 0)
-                {
-                    for(iter_difference_t<O> i = 0; i < n; (void)++i, ++first)
-                    {
-                        if(first == last)
-                        {
-                            advance(out, i);
-                            goto done;
-                        }
-                        *next(out, i) = *first;
-                    }
-
-                    std::uniform_int_distribution<iter_difference_t<O>> dist;
-                    using param_t = typename decltype(dist)::param_type;
-                    for(auto pop_size = n; first != last; (void)++first, ++pop_size)
-                    {
-                        auto const i = dist(gen, param_t{0, pop_size});
-                        if(i < n)
-                            *next(out, i) = *first;
-                    }
-
-                    advance(out, n);
-                }
-            done:
-                return {std::move(first), std::move(out)};
+                return detail::sample_reservoir_impl(std::move(first),
+                                                     std::move(last),
+                                                     std::move(out),
+                                                     n,
+                                                     static_cast<Gen &&>(gen));
             }
         }
 
@@ -21,6 +21,7 @@
 #ifndef RANGES_V3_ALGORITHM_SET_ALGORITHM_HPP
 #define RANGES_V3_ALGORITHM_SET_ALGORITHM_HPP
 
+#include <cstddef>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -38,6 +39,7 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/gallop.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -66,13 +68,26 @@ namespace ranges
                                    P1 proj1 = P1{},
                                    P2 proj2 = P2{}) //
         {
-            for(; begin2 != end2; ++begin1)
+            // The elements of the first sequence that the second lacks are
+            // skipped, galloping if there are many in a row.
+            auto before2 = [&](auto && x) {
+                return invoke(pred, invoke(proj1, x), invoke(proj2, *begin2));
+            };
+            std::ptrdiff_t run1 = 0;
+            while(begin2 != end2)
             {
                 if(begin1 == end1 ||
                    invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
                     return false;
-                if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
+                if(before2(*begin1))
+                    detail::skip_while_(
+                        begin1, end1, before2, run1, detail::gallopable_t<I1, S1>{});
+                else
+                {
+                    ++begin1;
                     ++begin2;
+                    run1 = 0;
+                }
             }
             return true;
         }
@@ -216,19 +231,36 @@ namespace ranges
                                         P1 proj1 = P1{},
                                         P2 proj2 = P2{}) //
         {
+            // Whichever sequence is behind catches up, galloping if it has to
+            // skip many elements in a row.
+            auto before2 = [&](auto && x) {
+                return invoke(pred, invoke(proj1, x), invoke(proj2, *begin2));
+            };
+            auto before1 = [&](auto && x) {
+                return invoke(pred, invoke(proj2, x), invoke(proj1, *begin1));
+            };
+            std::ptrdiff_t run1 = 0, run2 = 0;
             while(begin1 != end1 && begin2 != end2)
             {
-                if(invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
-                    ++begin1;
+                if(before2(*begin1))
+                {
+                    detail::skip_while_(
+                        begin1, end1, before2, run1, detail::gallopable_t<I1, S1>{});
+                    run2 = 0;
+                }
+                else if(before1(*begin2))
+                {
+                    detail::skip_while_(
+                        begin2, end2, before1, run2, detail::gallopable_t<I2, S2>{});
+                    run1 = 0;
+                }
                 else
                 {
-                    if(!invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
-                    {
-                        *out = *begin1;
-                        ++out;
-                        ++begin1;
-                    }
+                    *out = *begin1;
+                    ++out;
+                    ++begin1;
                     ++begin2;
+                    run1 = run2 = 0;
                 }
             }
             return out;
@@ -294,6 +326,16 @@ namespace ranges
                                                                  P1 proj1 = P1{},
                                                                  P2 proj2 = P2{}) //
         {
+            // Runs of the first sequence that the second lacks are copied, and
+            // runs of the second that the first lacks skipped, galloping through
+            // long ones.
+            auto before2 = [&](auto && x) {
+                return invoke(pred, invoke(proj1, x), invoke(proj2, *begin2));
+            };
+            auto before1 = [&](auto && x) {
+                return invoke(pred, invoke(proj2, x), invoke(proj1, *begin1));
+            };
+            std::ptrdiff_t run1 = 0, run2 = 0;
             while(begin1 != end1)
             {
                 if(begin2 == end2)
@@ -301,17 +343,27 @@ namespace ranges
                     auto tmp = ranges::copy(begin1, end1, out);
                     return {tmp.in, tmp.out};
                 }
-                if(invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
+                if(before2(*begin1))
                 {
-                    *out = *begin1;
-                    ++out;
-                    ++begin1;
+                    detail::copy_while_(begin1,
+                                        end1,
+                                        before2,
+                                        out,
+                                        run1,
+                                        detail::gallopable_t<I1, S1>{});
+                    run2 = 0;
+                }
+                else if(before1(*begin2))
+                {
+                    detail::skip_while_(
+                        begin2, end2, before1, run2, detail::gallopable_t<I2, S2>{});
+                    run1 = 0;
                 }
                 else
                 {
-                    if(!invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
-                        ++begin1;
+                    ++begin1;
                     ++begin2;
+                    run1 = run2 = 0;
                 }
             }
             return {begin1, out};
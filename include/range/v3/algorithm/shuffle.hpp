@@ -13,31 +13,232 @@
 #ifndef RANGES_V3_ALGORITHM_SHUFFLE_HPP
 #define RANGES_V3_ALGORITHM_SHUFFLE_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
 
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/memory.hpp>
 #include <range/v3/utility/random.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/swap.hpp>
 
+#include <range/v3/detail/bounded_random.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        // Whether shuffle can take its swap positions a batch at a time from
+        // 64-bit words of the generator.
+        template<typename I, typename Gen>
+        using shuffle_batched_ =
+            meta::bool_<std::is_integral<iter_difference_t<I>>::value &&
+                        random_bits_<Gen>::value != 0>;
+
+        // Takes the last K of the first n elements one step each of Fisher-Yates
+        // further, with the K swap positions from one random word.
+        template<std::size_t K, typename I, typename Gen>
+        void shuffle_batch_(I const first, std::uint64_t & n, Gen & gen)
+        {
+            using D = iter_difference_t<I>;
+            std::uint64_t bounds[K], picks[K];
+            std::uint64_t product = 1;
+            for(std::size_t k = 0; k < K; ++k)
+                product *= bounds[k] = n - k;
+            detail::bounded_random_batch_(gen, bounds, product, picks);
+            for(std::size_t k = 0; k < K; ++k)
+                ranges::iter_swap(first + static_cast<D>(n - 1 - k),
+                                  first + static_cast<D>(picks[k]));
+            n -= K;
+        }
+
+        // Fisher-Yates from the back, with the swap positions of each batch of
+        // steps from one random word. The batches are as large as keeps the
+        // product of their bounds under 2^60, so that a word is seldom drawn
+        // again.
+        template<typename I, typename Gen>
+        void shuffle_n_(I const first, std::uint64_t n, Gen & gen)
+        {
+            using D = iter_difference_t<I>;
+            for(; n > (std::uint64_t(1) << 30); --n)
+                ranges::iter_swap(first + static_cast<D>(n - 1),
+                                  first + static_cast<D>(bounded_random_(gen, n)));
+            while(n > (std::uint64_t(1) << 20))
+                detail::shuffle_batch_<2>(first, n, gen);
+            while(n > (std::uint64_t(1) << 15))
+                detail::shuffle_batch_<3>(first, n, gen);
+            while(n > (std::uint64_t(1) << 12))
+                detail::shuffle_batch_<4>(first, n, gen);
+            while(n > (std::uint64_t(1) << 10))
+                detail::shuffle_batch_<5>(first, n, gen);
+            while(n > 6)
+                detail::shuffle_batch_<6>(first, n, gen);
+            for(; n > 1; --n)
+                ranges::iter_swap(first + static_cast<D>(n - 1),
+                                  first + static_cast<D>(bounded_random_(gen, n)));
+        }
+
+        template<typename I, typename Gen>
+        void shuffle_(I const first, I const last, Gen & gen, std::true_type)
+        {
+            detail::shuffle_n_(first, static_cast<std::uint64_t>(last - first), gen);
+        }
+        template<typename I, typename Gen>
+        void shuffle_(I const first, I const last, Gen & gen, std::false_type)
+        {
+            using D1 = iter_difference_t<I>;
+            using D2 =
+                meta::conditional_t<std::is_integral<D1>::value, D1, std::ptrdiff_t>;
+            std::uniform_int_distribution<D2> uid{};
+            using param_t = typename decltype(uid)::param_type;
+            for(auto mid = first; mid != last && ++mid != last;)
+            {
+                RANGES_ENSURE(mid - first <= PTRDIFF_MAX);
+                if(auto const i = uid(gen, param_t{0, D2(mid - first)}))
+                    ranges::iter_swap(mid - i, mid);
+            }
+        }
+
+        // Calls f with n random bucket numbers of `bits` bits, several from
+        // each word.
+        template<typename Gen, typename F>
+        void bucket_shuffle_labels_(Gen & gen, std::ptrdiff_t n, int const bits, F f)
+        {
+            int const per_word = 64 / bits;
+            std::uint64_t const mask = (std::uint64_t(1) << bits) - 1;
+            for(; n >= per_word; n -= per_word)
+            {
+                std::uint64_t word = detail::random_u64_(gen);
+                for(int k = 0; k < per_word; ++k, word >>= bits)
+                    f(static_cast<std::size_t>(word & mask));
+            }
+            std::uint64_t word = detail::random_u64_(gen);
+            for(; n > 0; --n, word >>= bits)
+                f(static_cast<std::size_t>(word & mask));
+        }
+
+        // The buckets are meant to fit in a typical L2 cache, and there are at
+        // most 2^12 of them so that the scatter does not run out of TLB entries.
+        // Sequences of less than the last level cache of a large machine are
+        // shuffled as fast by Fisher-Yates.
+        constexpr std::size_t bucket_shuffle_bytes_ = std::size_t(1) << 18;
+        constexpr int bucket_shuffle_max_bits_ = 12;
+        constexpr std::size_t bucket_shuffle_min_bytes_ = std::size_t(1) << 25;
+
+        // Whether bucket_shuffle can use a buffer: it replays the bucket numbers
+        // from a copy of the generator, and moves the elements in and out of the
+        // buffer where nothing must throw.
+        template<typename I, typename Gen, typename V = iter_value_t<I>>
+        using bucket_shuffle_buffered_ =
+            meta::bool_<shuffle_batched_<I, Gen>::value &&
+                        std::is_copy_constructible<Gen>::value &&
+                        std::is_same<iter_reference_t<I>, V &>::value &&
+                        std::is_nothrow_move_constructible<V>::value &&
+                        std::is_nothrow_move_assignable<V>::value &&
+                        std::is_nothrow_destructible<V>::value>;
+
+        // How many bits of bucket number n elements of V want, or 0 for none.
+        template<typename V>
+        int bucket_shuffle_bits_(std::ptrdiff_t n) noexcept
+        {
+            auto const bytes = static_cast<std::size_t>(n) * sizeof(V);
+            if(bytes < bucket_shuffle_min_bytes_)
+                return 0;
+            int bits = 0;
+            while(bits < bucket_shuffle_max_bits_ &&
+                  (bytes >> bits) > bucket_shuffle_bytes_)
+                ++bits;
+            return bits;
+        }
+
+        /// The method of Rao and Sandelius: each element goes to a random one of
+        /// `2^bits` buckets, and each bucket is then shuffled with Fisher-Yates.
+        /// The bucket numbers are drawn twice from the same copy of the
+        /// generator, once to count the buckets and once to move each element
+        /// to its place in the buffer, so that they need no storage. The
+        /// scatter writes to only as many places at a time as there are
+        /// buckets, and each bucket is shuffled in the cache, which spares
+        /// Fisher-Yates a cache miss for each element of a large sequence.
+        template<typename I, typename V, typename Gen>
+        void bucket_shuffle_n_(I const first, std::ptrdiff_t const n, V * const buffer,
+                               int const bits, Gen & gen)
+        {
+            std::size_t const buckets = std::size_t(1) << bits;
+            std::vector<std::ptrdiff_t> offsets(buckets + 1);
+            Gen replay = gen;
+            detail::bucket_shuffle_labels_(
+                gen, n, bits, [&](std::size_t label) { ++offsets[label + 1]; });
+            for(std::size_t b = 0; b < buckets; ++b)
+                offsets[b + 1] += offsets[b];
+            {
+                std::vector<std::ptrdiff_t> at(offsets.begin(), offsets.end() - 1);
+                I it = first;
+                detail::bucket_shuffle_labels_(replay, n, bits, [&](std::size_t label) {
+                    ::new(static_cast<void *>(buffer + at[label]++)) V(iter_move(it));
+                    ++it;
+                });
+            }
+            I out = first;
+            for(std::size_t b = 0; b < buckets; ++b)
+            {
+                V * const bucket = buffer + offsets[b];
+                std::ptrdiff_t const size = offsets[b + 1] - offsets[b];
+                detail::shuffle_n_(bucket, static_cast<std::uint64_t>(size), gen);
+                for(std::ptrdiff_t i = 0; i < size; ++i, ++out)
+                {
+                    *out = std::move(bucket[i]);
+                    bucket[i].~V();
+                }
+            }
+        }
+
+        template<typename I, typename V, typename Gen>
+        void bucket_shuffle_(I const first, I const last, V * const buffer,
+                             std::ptrdiff_t const capacity, Gen & gen, std::true_type)
+        {
+            auto const n = static_cast<std::ptrdiff_t>(last - first);
+            int const bits = detail::bucket_shuffle_bits_<V>(n);
+            if(bits == 0 || capacity < n)
+                detail::shuffle_n_(first, static_cast<std::uint64_t>(n), gen);
+            else
+                detail::bucket_shuffle_n_(first, n, buffer, bits, gen);
+        }
+        template<typename I, typename V, typename Gen>
+        void bucket_shuffle_(I const first, I const last, V *, std::ptrdiff_t, Gen & gen,
+                             std::false_type)
+        {
+            detail::shuffle_(first, last, gen, shuffle_batched_<I, Gen>{});
+        }
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-algorithms
     /// @{
     RANGES_FUNC_BEGIN(shuffle)
 
         /// \brief function template \c shuffle
+        ///
+        /// A generator whose results span all the values of a 32- or 64-bit
+        /// unsigned integer, like \c std::mt19937 or \c std::mt19937_64, gives the
+        /// swap positions of several steps at a time.
         template(typename I, typename S, typename Gen = detail::default_random_engine &)(
             /// \pre
             requires random_access_iterator<I> AND sentinel_for<S, I> AND
@@ -48,21 +249,10 @@ namespace ranges
                                S const last,
                                Gen && gen = detail::get_random_engine()) //
         {
-            auto mid = first;
-            if(mid == last)
-                return mid;
-            using D1 = iter_difference_t<I>;
-            using D2 =
-                meta::conditional_t<std::is_integral<D1>::value, D1, std::ptrdiff_t>;
-            std::uniform_int_distribution<D2> uid{};
-            using param_t = typename decltype(uid)::param_type;
-            while(++mid != last)
-            {
-                RANGES_ENSURE(mid - first <= PTRDIFF_MAX);
-                if(auto const i = uid(gen, param_t{0, D2(mid - first)}))
-                    ranges::iter_swap(mid - i, mid);
-            }
-            return mid;
+            I const end = ranges::next(first, last);
+            using G = std::remove_reference_t<Gen>;
+            detail::shuffle_(first, end, gen, detail::shuffle_batched_<I, G>{});
+            return end;
         }
 
         /// \overload
@@ -80,6 +270,104 @@ namespace ranges
 
     RANGES_FUNC_END(shuffle)
 
+    RANGES_FUNC_BEGIN(bucket_shuffle)
+
+        /// \brief function template \c bucket_shuffle
+        ///
+        /// Shuffles like \c shuffle, but in two passes that suit sequences much
+        /// larger than the cache: the elements are dealt into random buckets
+        /// the size of an L2 cache, in a buffer as large as the sequence, and
+        /// each bucket is shuffled on its own. It shuffles like \c shuffle when
+        /// the sequence is small, when no buffer can be had, when the generator
+        /// cannot be copied or does not give 32 or 64 random bits at a time, or
+        /// when moving the elements may throw.
+        template(typename I, typename S, typename Gen = detail::default_random_engine &)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+                permutable<I> AND
+                uniform_random_bit_generator<std::remove_reference_t<Gen>> AND
+                convertible_to<invoke_result_t<Gen &>, iter_difference_t<I>>)
+        I RANGES_FUNC(bucket_shuffle)(I const first,
+                                      S const last,
+                                      Gen && gen = detail::get_random_engine()) //
+        {
+            I const end = ranges::next(first, last);
+            using G = std::remove_reference_t<Gen>;
+            using V = iter_value_t<I>;
+            using buffered = detail::bucket_shuffle_buffered_<I, G>;
+            auto const n = static_cast<std::ptrdiff_t>(end - first);
+            if(!buffered::value || detail::bucket_shuffle_bits_<V>(n) == 0)
+                detail::bucket_shuffle_(first, end, static_cast<V *>(nullptr), 0, gen,
+                                        buffered{});
+            else
+            {
+                auto buf = detail::get_temporary_buffer<V>(n);
+                std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+                detail::bucket_shuffle_(first, end, buf.first, buf.second, gen,
+                                        buffered{});
+            }
+            return end;
+        }
+
+        /// \overload
+        template(typename Rng, typename Gen = detail::default_random_engine &)(
+            /// \pre
+            requires random_access_range<Rng> AND permutable<iterator_t<Rng>> AND
+                uniform_random_bit_generator<std::remove_reference_t<Gen>> AND
+                convertible_to<invoke_result_t<Gen &>,
+                               iter_difference_t<iterator_t<Rng>>>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(bucket_shuffle)(Rng && rng,
+                                    Gen && rand = detail::get_random_engine()) //
+        {
+            return (*this)(begin(rng), end(rng), static_cast<Gen &&>(rand));
+        }
+
+        /// \overload
+        /// Shuffles with the storage of `buf`, which it grows to the length of
+        /// the sequence if need be, as the buffer.
+        template(typename I, typename S, typename A,
+                 typename Gen = detail::default_random_engine &)(
+            /// \pre
+            requires random_access_iterator<I> AND sentinel_for<S, I> AND
+                permutable<I> AND
+                uniform_random_bit_generator<std::remove_reference_t<Gen>> AND
+                convertible_to<invoke_result_t<Gen &>, iter_difference_t<I>>)
+        I RANGES_FUNC(bucket_shuffle)(I const first,
+                                      S const last,
+                                      scratch_buffer<iter_value_t<I>, A> & buf,
+                                      Gen && gen = detail::get_random_engine()) //
+        {
+            I const end = ranges::next(first, last);
+            using G = std::remove_reference_t<Gen>;
+            using buffered = detail::bucket_shuffle_buffered_<I, G>;
+            auto const n = static_cast<std::ptrdiff_t>(end - first);
+            if(buffered::value &&
+               detail::bucket_shuffle_bits_<iter_value_t<I>>(n) != 0)
+                buf.reserve(n);
+            detail::bucket_shuffle_(first, end, buf.data(), buf.capacity(), gen,
+                                    buffered{});
+            return end;
+        }
+
+        /// \overload
+        template(typename Rng, typename A,
+                 typename Gen = detail::default_random_engine &)(
+            /// \pre
+            requires random_access_range<Rng> AND permutable<iterator_t<Rng>> AND
+                uniform_random_bit_generator<std::remove_reference_t<Gen>> AND
+                convertible_to<invoke_result_t<Gen &>,
+                               iter_difference_t<iterator_t<Rng>>>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(bucket_shuffle)(Rng && rng,
+                                    scratch_buffer<range_value_t<Rng>, A> & buf,
+                                    Gen && rand = detail::get_random_engine()) //
+        {
+            return (*this)(begin(rng), end(rng), buf, static_cast<Gen &&>(rand));
+        }
+
+    RANGES_FUNC_END(bucket_shuffle)
+
     namespace cpp20
     {
         using ranges::shuffle;
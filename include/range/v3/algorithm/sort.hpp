@@ -36,8 +36,14 @@
 #ifndef RANGES_V3_ALGORITHM_SORT_HPP
 #define RANGES_V3_ALGORITHM_SORT_HPP
 
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/algorithm/aux_/parallel_merge_sort.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
 #include <range/v3/algorithm/move_backward.hpp>
 #include <range/v3/algorithm/partial_sort.hpp>
@@ -51,6 +57,7 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 #include <range/v3/detail/prologue.hpp>
@@ -60,42 +67,6 @@ namespace ranges
     /// \cond
     namespace detail
     {
-        template<typename I, typename C, typename P>
-        inline I unguarded_partition(I first, I last, C & pred, P & proj)
-        {
-            I mid = first + (last - first) / 2, penultimate = ranges::prev(last);
-            auto &&x = *first, &&y = *mid, &&z = *penultimate;
-            auto &&a = invoke(proj, (decltype(x) &&)x),
-                 &&b = invoke(proj, (decltype(y) &&)y),
-                 &&c = invoke(proj, (decltype(z) &&)z);
-
-            // Find the median:
-            I pivot_pnt =
-                invoke(pred, a, b)
-                    ? (invoke(pred, b, c) ? mid
-                                          : (invoke(pred, a, c) ? penultimate : first))
-                    : (invoke(pred, a, c) ? first
-                                          : (invoke(pred, b, c) ? penultimate : mid));
-
-            // Do the partition:
-            while(true)
-            {
-                auto && v = *pivot_pnt;
-                auto && pivot = invoke(proj, (decltype(v) &&)v);
-                while(invoke(pred, invoke(proj, *first), pivot))
-                    ++first;
-                --last;
-                while(invoke(pred, pivot, invoke(proj, *last)))
-                    --last;
-                if(!(first < last))
-                    return first;
-                ranges::iter_swap(first, last);
-                pivot_pnt =
-                    pivot_pnt == first ? last : (pivot_pnt == last ? first : pivot_pnt);
-                ++first;
-            }
-        }
-
         template<typename I, typename C, typename P>
         inline void unguarded_linear_insert(I last, iter_value_t<I> val, C & pred,
                                             P & proj)
@@ -139,56 +110,413 @@ namespace ranges
                 detail::unguarded_linear_insert(i, iter_move(i), pred, proj);
         }
 
-        constexpr int introsort_threshold()
+        template<typename Size>
+        inline Size log2(Size n)
+        {
+            Size k = 0;
+            for(; n != 1; n >>= 1)
+                ++k;
+            return k;
+        }
+
+        // The pattern-defeating quicksort below follows pdqsort by Orson Peters
+        // (https://github.com/orlp/pdqsort), which is distributed under the zlib
+        // license: Copyright (c) 2021 Orson Peters <orsonpeters@gmail.com>.
+        //
+        // It is an introsort that chooses its pivot with a median-of-three or, for
+        // large partitions, Tukey's ninther; falls back to heapsort after too many
+        // unbalanced partitions, shuffling the input a little after each one; bails
+        // out to insertion sort when a partition needed no swaps; and moves runs
+        // of elements equal to the previous pivot out of the way in linear time.
+        // For arithmetic types under the default ordering, the partition step is
+        // the branchless block partition of BlockQuicksort (Edelkamp and Weiss).
+
+        constexpr int pdqsort_insertion_sort_threshold()
         {
-            return 16;
+            return 24;
+        }
+
+        constexpr int pdqsort_ninther_threshold()
+        {
+            return 128;
+        }
+
+        constexpr int pdqsort_partial_insertion_sort_limit()
+        {
+            return 8;
+        }
+
+        constexpr int pdqsort_block_size()
+        {
+            return 64;
         }
 
         template<typename I, typename C, typename P>
-        inline void final_insertion_sort(I first, I last, C & pred, P & proj)
+        inline void sort2(I a, I b, C & pred, P & proj)
         {
-            if(last - first > detail::introsort_threshold())
+            if(invoke(pred, invoke(proj, *b), invoke(proj, *a)))
+                ranges::iter_swap(a, b);
+        }
+
+        template<typename I, typename C, typename P>
+        inline void sort3(I a, I b, I c, C & pred, P & proj)
+        {
+            detail::sort2(a, b, pred, proj);
+            detail::sort2(b, c, pred, proj);
+            detail::sort2(a, b, pred, proj);
+        }
+
+        // Insertion sort that gives up, returning false, once it has moved more
+        // than pdqsort_partial_insertion_sort_limit() elements.
+        template<typename I, typename C, typename P>
+        inline bool partial_insertion_sort(I first, I last, C & pred, P & proj)
+        {
+            if(first == last)
+                return true;
+            iter_difference_t<I> moved = 0;
+            for(I cur = ranges::next(first); cur != last; ++cur)
             {
-                detail::insertion_sort(
-                    first, first + detail::introsort_threshold(), pred, proj);
-                detail::unguarded_insertion_sort(
-                    first + detail::introsort_threshold(), last, pred, proj);
+                I sift = cur, sift_1 = ranges::prev(cur);
+                if(invoke(pred, invoke(proj, *sift), invoke(proj, *sift_1)))
+                {
+                    iter_value_t<I> tmp = iter_move(sift);
+                    do
+                    {
+                        *sift = iter_move(sift_1);
+                        --sift;
+                    } while(sift != first &&
+                            invoke(pred, invoke(proj, tmp), invoke(proj, *--sift_1)));
+                    *sift = std::move(tmp);
+                    moved += cur - sift;
+                    if(moved > detail::pdqsort_partial_insertion_sort_limit())
+                        return false;
+                }
             }
+            return true;
+        }
+
+        // Partitions [first, last) around the pivot *first. Elements equal to the
+        // pivot go to the right. Returns the position of the pivot and whether the
+        // range was already partitioned. Requires that the median of three has
+        // been moved to *first, so that the scans below need no bounds checks.
+        template<typename I, typename C, typename P>
+        std::pair<I, bool> pdq_partition_right(I const begin, I const end, C & pred,
+                                               P & proj, std::false_type)
+        {
+            iter_value_t<I> pivot = iter_move(begin);
+            auto && pv = invoke(proj, pivot);
+            I first = begin, last = end;
+            while(invoke(pred, invoke(proj, *++first), pv))
+                ;
+            if(first - 1 == begin)
+                while(first < last && !invoke(pred, invoke(proj, *--last), pv))
+                    ;
             else
-                detail::insertion_sort(first, last, pred, proj);
+                while(!invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            bool const already_partitioned = !(first < last);
+            while(first < last)
+            {
+                ranges::iter_swap(first, last);
+                while(invoke(pred, invoke(proj, *++first), pv))
+                    ;
+                while(!invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            }
+            I pivot_pos = first - 1;
+            *begin = iter_move(pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
         }
 
-        template<typename Size>
-        inline Size log2(Size n)
+        // Exchanges the elements at first + offsets_l[i] and last - offsets_r[i]
+        // for i < num, with a cyclic permutation unless use_swaps is set.
+        template<typename I>
+        inline void pdq_swap_offsets(I first, I last, unsigned char const * offsets_l,
+                                     unsigned char const * offsets_r, std::size_t num,
+                                     bool use_swaps)
         {
-            Size k = 0;
-            for(; n != 1; n >>= 1)
-                ++k;
-            return k;
+            if(use_swaps)
+            {
+                // The descending distribution needs real swaps for the partition to
+                // stay linear.
+                for(std::size_t i = 0; i < num; ++i)
+                    ranges::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+            }
+            else if(num > 0)
+            {
+                I l = first + offsets_l[0], r = last - offsets_r[0];
+                iter_value_t<I> tmp = iter_move(l);
+                *l = iter_move(r);
+                for(std::size_t i = 1; i < num; ++i)
+                {
+                    l = first + offsets_l[i];
+                    *r = iter_move(l);
+                    r = last - offsets_r[i];
+                    *l = iter_move(r);
+                }
+                *r = std::move(tmp);
+            }
+        }
+
+        // Branchless variant of the above: the elements on the wrong side of the
+        // pivot are first recorded in blocks of offsets, then swapped in bulk.
+        template<typename I, typename C, typename P>
+        std::pair<I, bool> pdq_partition_right(I const begin, I const end, C & pred,
+                                               P & proj, std::true_type)
+        {
+            iter_value_t<I> pivot = iter_move(begin);
+            auto && pv = invoke(proj, pivot);
+            I first = begin, last = end;
+            while(invoke(pred, invoke(proj, *++first), pv))
+                ;
+            if(first - 1 == begin)
+                while(first < last && !invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            else
+                while(!invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            bool const already_partitioned = !(first < last);
+            if(!already_partitioned)
+            {
+                ranges::iter_swap(first, last);
+                ++first;
+
+                constexpr std::size_t block = detail::pdqsort_block_size();
+                alignas(64) unsigned char offsets_l[block];
+                alignas(64) unsigned char offsets_r[block];
+                I offsets_l_base = first, offsets_r_base = last;
+                std::size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+                while(first < last)
+                {
+                    // Decide how many of the remaining elements each side scans.
+                    auto const num_unknown = static_cast<std::size_t>(last - first);
+                    std::size_t const left_split =
+                        num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                    std::size_t const right_split =
+                        num_r == 0 ? (num_unknown - left_split) : 0;
+
+                    // Record the offsets of the elements on the wrong side.
+                    std::size_t const nl = left_split < block ? left_split : block;
+                    for(std::size_t i = 0; i < nl; ++i, ++first)
+                    {
+                        offsets_l[num_l] = static_cast<unsigned char>(i);
+                        num_l += !invoke(pred, invoke(proj, *first), pv);
+                    }
+                    std::size_t const nr = right_split < block ? right_split : block;
+                    for(std::size_t i = 0; i < nr;)
+                    {
+                        offsets_r[num_r] = static_cast<unsigned char>(++i);
+                        num_r += invoke(pred, invoke(proj, *--last), pv);
+                    }
+
+                    // Swap them pairwise and move the block boundaries.
+                    std::size_t const num = num_l < num_r ? num_l : num_r;
+                    detail::pdq_swap_offsets(offsets_l_base,
+                                             offsets_r_base,
+                                             offsets_l + start_l,
+                                             offsets_r + start_r,
+                                             num,
+                                             num_l == num_r);
+                    num_l -= num;
+                    num_r -= num;
+                    start_l += num;
+                    start_r += num;
+                    if(num_l == 0)
+                    {
+                        start_l = 0;
+                        offsets_l_base = first;
+                    }
+                    if(num_r == 0)
+                    {
+                        start_r = 0;
+                        offsets_r_base = last;
+                    }
+                }
+
+                // One side may still have misplaced elements; move them to the
+                // boundary.
+                if(num_l)
+                {
+                    while(num_l--)
+                        ranges::iter_swap(offsets_l_base + offsets_l[start_l + num_l],
+                                          --last);
+                    first = last;
+                }
+                if(num_r)
+                {
+                    while(num_r--)
+                    {
+                        ranges::iter_swap(offsets_r_base - offsets_r[start_r + num_r],
+                                          first);
+                        ++first;
+                    }
+                    last = first;
+                }
+            }
+            I pivot_pos = first - 1;
+            *begin = iter_move(pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        // Partitions [first, last) around the pivot *first, putting elements equal
+        // to the pivot on the left. Used when the pivot equals the element before
+        // the range, in which case no element of the range is less than it and the
+        // whole run of equal elements lands in place at once.
+        template<typename I, typename C, typename P>
+        I pdq_partition_left(I const begin, I const end, C & pred, P & proj)
+        {
+            iter_value_t<I> pivot = iter_move(begin);
+            auto && pv = invoke(proj, pivot);
+            I first = begin, last = end;
+            while(invoke(pred, pv, invoke(proj, *--last)))
+                ;
+            if(last + 1 == end)
+                while(first < last && !invoke(pred, pv, invoke(proj, *++first)))
+                    ;
+            else
+                while(!invoke(pred, pv, invoke(proj, *++first)))
+                    ;
+            while(first < last)
+            {
+                ranges::iter_swap(first, last);
+                while(invoke(pred, pv, invoke(proj, *--last)))
+                    ;
+                while(!invoke(pred, pv, invoke(proj, *++first)))
+                    ;
+            }
+            I pivot_pos = last;
+            *begin = iter_move(pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return pivot_pos;
         }
 
-        template<typename I, typename Size, typename C, typename P>
-        inline void introsort_loop(I first, I last, Size depth_limit, C & pred, P & proj)
+        template<typename I, typename C, typename P, typename Branchless>
+        void pdqsort_loop(I begin, I end, C & pred, P & proj, int bad_allowed,
+                          bool leftmost, Branchless branchless)
         {
-            while(last - first > detail::introsort_threshold())
+            using D = iter_difference_t<I>;
+            constexpr D insertion_threshold = detail::pdqsort_insertion_sort_threshold();
+            constexpr D ninther_threshold = detail::pdqsort_ninther_threshold();
+            while(true)
             {
-                if(depth_limit == 0)
-                    return partial_sort(
-                               first, last, last, std::ref(pred), std::ref(proj)),
-                           void();
-                I cut = detail::unguarded_partition(first, last, pred, proj);
-                detail::introsort_loop(cut, last, --depth_limit, pred, proj);
-                last = cut;
+                D const size = end - begin;
+                if(size < insertion_threshold)
+                {
+                    // If this is not the leftmost partition, the element before it
+                    // is a sentinel for the unguarded insertion sort.
+                    if(leftmost)
+                        detail::insertion_sort(begin, end, pred, proj);
+                    else
+                        detail::unguarded_insertion_sort(begin, end, pred, proj);
+                    return;
+                }
+
+                // Move the median of three, or the pseudomedian of nine, to *begin.
+                D const s2 = size / 2;
+                if(size > ninther_threshold)
+                {
+                    detail::sort3(begin, begin + s2, end - 1, pred, proj);
+                    detail::sort3(begin + 1, begin + (s2 - 1), end - 2, pred, proj);
+                    detail::sort3(begin + 2, begin + (s2 + 1), end - 3, pred, proj);
+                    detail::sort3(
+                        begin + (s2 - 1), begin + s2, begin + (s2 + 1), pred, proj);
+                    ranges::iter_swap(begin, begin + s2);
+                }
+                else
+                    detail::sort3(begin + s2, begin, end - 1, pred, proj);
+
+                // If the pivot equals the (smaller or equal) element before this
+                // partition, every element equal to it can be put in place at once:
+                // none of the remaining elements are less than it.
+                if(!leftmost &&
+                   !invoke(pred, invoke(proj, *(begin - 1)), invoke(proj, *begin)))
+                {
+                    begin = detail::pdq_partition_left(begin, end, pred, proj) + 1;
+                    continue;
+                }
+
+                auto const part =
+                    detail::pdq_partition_right(begin, end, pred, proj, branchless);
+                I const pivot_pos = part.first;
+                D const l_size = pivot_pos - begin;
+                D const r_size = end - (pivot_pos + 1);
+
+                if(l_size < size / 8 || r_size < size / 8)
+                {
+                    // Highly unbalanced: after too many of these, fall back to
+                    // heapsort to guarantee O(n log n).
+                    if(--bad_allowed == 0)
+                    {
+                        partial_sort(begin, end, end, std::ref(pred), std::ref(proj));
+                        return;
+                    }
+
+                    // Otherwise break up patterns that may have caused it.
+                    if(l_size >= insertion_threshold)
+                    {
+                        ranges::iter_swap(begin, begin + l_size / 4);
+                        ranges::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                        if(l_size > ninther_threshold)
+                        {
+                            ranges::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                            ranges::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                            ranges::iter_swap(pivot_pos - 2,
+                                              pivot_pos - (l_size / 4 + 1));
+                            ranges::iter_swap(pivot_pos - 3,
+                                              pivot_pos - (l_size / 4 + 2));
+                        }
+                    }
+                    if(r_size >= insertion_threshold)
+                    {
+                        ranges::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                        ranges::iter_swap(end - 1, end - r_size / 4);
+                        if(r_size > ninther_threshold)
+                        {
+                            ranges::iter_swap(pivot_pos + 2,
+                                              pivot_pos + (2 + r_size / 4));
+                            ranges::iter_swap(pivot_pos + 3,
+                                              pivot_pos + (3 + r_size / 4));
+                            ranges::iter_swap(end - 2, end - (1 + r_size / 4));
+                            ranges::iter_swap(end - 3, end - (2 + r_size / 4));
+                        }
+                    }
+                }
+                else if(part.second &&
+                        detail::partial_insertion_sort(begin, pivot_pos, pred, proj) &&
+                        detail::partial_insertion_sort(pivot_pos + 1, end, pred, proj))
+                {
+                    // The partition was already in order and both halves are
+                    // (nearly) sorted: we are done.
+                    return;
+                }
+
+                // Recurse into the left partition and loop on the right one.
+                detail::pdqsort_loop(
+                    begin, pivot_pos, pred, proj, bad_allowed, leftmost, branchless);
+                begin = pivot_pos + 1;
+                leftmost = false;
             }
         }
+
+        // Whether comparing two elements is cheap enough, and free of side effects,
+        // to be done unconditionally by the branchless partition.
+        template<typename I, typename C, typename P>
+        using pdqsort_branchless =
+            meta::bool_<std::is_arithmetic<iter_value_t<I>>::value &&
+                        (same_as<C, less> || same_as<C, greater>) &&
+                        same_as<P, identity>>;
     } // namespace detail
     /// \endcond
 
     /// \addtogroup group-algorithms
     /// @{
 
-    // Introsort: Quicksort to a certain depth, then Heapsort. Insertion
-    // sort below a certain threshold.
+    // Pattern-defeating quicksort: introsort that adapts to sorted, reversed and
+    // low-cardinality inputs. Heapsort bounds the worst case; insertion sort
+    // finishes small partitions.
     // TODO Forward iterators, like EoP?
 
     RANGES_FUNC_BEGIN(sort)
@@ -202,11 +530,13 @@ namespace ranges
         {
             I last = ranges::next(first, std::move(end_));
             if(first != last)
-            {
-                detail::introsort_loop(
-                    first, last, detail::log2(last - first) * 2, pred, proj);
-                detail::final_insertion_sort(first, last, pred, proj);
-            }
+                detail::pdqsort_loop(first,
+                                     last,
+                                     pred,
+                                     proj,
+                                     static_cast<int>(detail::log2(last - first)),
+                                     true,
+                                     detail::pdqsort_branchless<I, C, P>{});
             return last;
         }
 
@@ -220,6 +550,40 @@ namespace ranges
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
 
+        /// \overload
+        /// Sorts in the manner requested by the execution policy. A parallel sort
+        /// sorts one run per thread and merges the runs on the thread pool.
+        template(typename E, typename I, typename S, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sortable<I, C, P> AND
+                random_access_iterator<I> AND sentinel_for<S, I>)
+        I RANGES_FUNC(sort)(E &&, I first, S end_, C pred = C{}, P proj = P{})
+        {
+            I last = ranges::next(first, std::move(end_));
+            auto sort_run = [&](I b, I e) { (*this)(b, e, pred, proj); };
+            if(RANGES_CONSTEXPR_IF(detail::parallelizable<E, I, I>::value))
+                aux::parallel_merge_sort(first, last, sort_run, pred, proj);
+            else
+                sort_run(first, last);
+            return last;
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sortable<iterator_t<Rng>, C, P> AND
+                random_access_range<Rng>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(sort)(E && policy, Rng && rng, C pred = C{}, P proj = P{}) //
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(sort)
 
     namespace cpp20
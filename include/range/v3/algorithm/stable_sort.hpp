@@ -43,11 +43,15 @@
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
 #include <range/v3/algorithm/merge.hpp>
 #include <range/v3/algorithm/min.hpp>
+#include <range/v3/algorithm/rotate.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/move_iterators.hpp>
 #include <range/v3/iterator/operations.hpp>
@@ -56,9 +60,11 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/memory.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -187,6 +193,133 @@ namespace ranges
                                    std::ref(pred),
                                    std::ref(proj));
         }
+
+        // The number of levels of a parallel stable sort's merge tree that fork,
+        // enough to give every thread a few leaves.
+        template<typename D>
+        int parallel_stable_sort_depth(D len)
+        {
+            std::size_t const leaves =
+                detail::parallel_chunk_count(len, D(detail::parallel_grain()));
+            int depth = 0;
+            for(; (std::size_t(1) << depth) < leaves; ++depth)
+            {}
+            return depth;
+        }
+
+        // Merges the sorted runs [first, middle) and [middle, last) like
+        // merge_adaptive, which it calls once it has forked `depth` levels deep.
+        // Every level splits the merge in two the way merge_adaptive does, cutting
+        // the longer run in half and the other at the matching bound, and runs the
+        // halves on the thread pool with half of the buffer each.
+        template<typename I, typename V, typename C, typename P>
+        void parallel_merge_adaptive(I first, I middle, I last, V * buffer,
+                                     std::ptrdiff_t buffer_size, C & pred, P & proj,
+                                     int depth)
+        {
+            iter_difference_t<I> const len1 = middle - first, len2 = last - middle;
+            if(depth == 0 || len1 == 0 || len2 == 0 ||
+               len1 + len2 < 2 * detail::parallel_grain())
+                return detail::merge_adaptive(first,
+                                              middle,
+                                              last,
+                                              len1,
+                                              len2,
+                                              buffer,
+                                              buffer_size,
+                                              std::ref(pred),
+                                              std::ref(proj)),
+                       void();
+            I m1, m2;
+            if(len1 >= len2)
+            {
+                m1 = first + len1 / 2;
+                m2 = lower_bound(
+                    middle, last, invoke(proj, *m1), std::ref(pred), std::ref(proj));
+            }
+            else
+            {
+                m2 = middle + len2 / 2;
+                m1 = upper_bound(
+                    first, middle, invoke(proj, *m2), std::ref(pred), std::ref(proj));
+            }
+            I const new_middle = rotate(m1, middle, m2).begin();
+            std::ptrdiff_t const half = buffer_size / 2;
+            detail::parallel_for(2, [&](std::size_t i) {
+                if(i == 0)
+                    detail::parallel_merge_adaptive(
+                        first, m1, new_middle, buffer, half, pred, proj, depth - 1);
+                else
+                    detail::parallel_merge_adaptive(new_middle,
+                                                    m2,
+                                                    last,
+                                                    buffer + half,
+                                                    buffer_size - half,
+                                                    pred,
+                                                    proj,
+                                                    depth - 1);
+            });
+        }
+
+        // stable_sort_adaptive with the top `depth` levels of the merge tree run on
+        // the thread pool. buffer points to raw memory for at least
+        // (last - first + 1) / 2 elements.
+        template<typename I, typename V, typename C, typename P>
+        void parallel_stable_sort(I first, I last, V * buffer,
+                                  std::ptrdiff_t buffer_size, C & pred, P & proj,
+                                  int depth)
+        {
+            using D = iter_difference_t<I>;
+            D const len = last - first;
+            if(depth == 0 || len < 2 * detail::parallel_grain())
+                return detail::stable_sort_adaptive(
+                           first, last, buffer, buffer_size, pred, proj),
+                       void();
+            // An even first half needs exactly half of its length in buffer, which
+            // leaves the second half enough of the rest to sort concurrently.
+            D const len1 = len / 2 - len / 2 % 2;
+            I const middle = first + len1;
+            std::ptrdiff_t const buffer1 = static_cast<std::ptrdiff_t>(len1 / 2);
+            detail::parallel_for(2, [&](std::size_t i) {
+                if(i == 0)
+                    detail::parallel_stable_sort(
+                        first, middle, buffer, buffer1, pred, proj, depth - 1);
+                else
+                    detail::parallel_stable_sort(middle,
+                                                 last,
+                                                 buffer + buffer1,
+                                                 buffer_size - buffer1,
+                                                 pred,
+                                                 proj,
+                                                 depth - 1);
+            });
+            detail::parallel_merge_adaptive(
+                first, middle, last, buffer, buffer_size, pred, proj, depth);
+        }
+
+        // Sorts [first, last) in the buffer, which holds at least half of it.
+        template<typename I, typename V, typename C, typename P>
+        void stable_sort_buffered(I first, I last, V * buffer, std::ptrdiff_t buffer_size,
+                                  C & pred, P & proj, std::false_type)
+        {
+            if(first != last)
+                detail::stable_sort_adaptive(
+                    first, last, buffer, buffer_size, pred, proj);
+        }
+        template<typename I, typename V, typename C, typename P>
+        void stable_sort_buffered(I first, I last, V * buffer, std::ptrdiff_t buffer_size,
+                                  C & pred, P & proj, std::true_type)
+        {
+            if(first != last)
+                detail::parallel_stable_sort(
+                    first,
+                    last,
+                    buffer,
+                    buffer_size,
+                    pred,
+                    proj,
+                    detail::parallel_stable_sort_depth(last - first));
+        }
     } // namespace detail
     /// \endcond
 
@@ -224,6 +357,123 @@ namespace ranges
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
 
+        /// \overload
+        /// Sorts with the storage of `buf`, which it grows to half the length of
+        /// the sequence if need be, as scratch space. A buffer reused across calls
+        /// saves allocating one on every call.
+        template(typename I, typename S, typename A, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires sortable<I, C, P> AND random_access_iterator<I> AND
+            sentinel_for<S, I>)
+        I RANGES_FUNC(stable_sort)(I first, S end_,
+                                   scratch_buffer<iter_value_t<I>, A> & buf,
+                                   C pred = C{}, P proj = P{})
+        {
+            I last = ranges::next(first, end_);
+            buf.reserve(static_cast<std::ptrdiff_t>((last - first + 1) / 2));
+            detail::stable_sort_buffered(
+                first, last, buf.data(), buf.capacity(), pred, proj, std::false_type{});
+            return last;
+        }
+
+        /// \overload
+        template(typename Rng, typename A, typename C = less, typename P = identity)(
+            /// \pre
+            requires sortable<iterator_t<Rng>, C, P> AND random_access_range<Rng>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(stable_sort)(Rng && rng, scratch_buffer<range_value_t<Rng>, A> & buf,
+                                 C pred = C{}, P proj = P{}) //
+        {
+            return (*this)(begin(rng), end(rng), buf, std::move(pred), std::move(proj));
+        }
+
+        /// \overload
+        /// Sorts in the manner requested by the execution policy. A parallel sort
+        /// splits the sequence in halves down to a few runs per thread, sorts the
+        /// runs concurrently, and splits every merge of the merge tree in turn
+        /// into independent halves that run on the thread pool.
+        template(typename E, typename I, typename S, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sortable<I, C, P> AND
+                random_access_iterator<I> AND sentinel_for<S, I>)
+        I RANGES_FUNC(stable_sort)(E &&, I first, S end_, C pred = C{}, P proj = P{})
+        {
+            I last = ranges::next(first, end_);
+            using D = iter_difference_t<I>;
+            using V = iter_value_t<I>;
+            using parallel = detail::parallelizable<E, I, I>;
+            D const len = last - first;
+            if(!parallel::value || len < 2 * detail::parallel_grain())
+                return (*this)(first, last, std::move(pred), std::move(proj));
+            auto buf = detail::get_temporary_buffer<V>((len + 1) / 2);
+            std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+            if(buf.second < (len + 1) / 2)
+                return (*this)(first, last, std::move(pred), std::move(proj));
+            detail::stable_sort_buffered(
+                first, last, buf.first, buf.second, pred, proj, parallel{});
+            return last;
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename C = less, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sortable<iterator_t<Rng>, C, P> AND
+                random_access_range<Rng>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(stable_sort)(E && policy, Rng && rng, C pred = C{}, P proj = P{}) //
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+        /// \overload
+        /// Sorts in the manner requested by the execution policy, with the storage
+        /// of `buf` as scratch space.
+        template(typename E, typename I, typename S, typename A, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sortable<I, C, P> AND
+                random_access_iterator<I> AND sentinel_for<S, I>)
+        I RANGES_FUNC(stable_sort)(E &&, I first, S end_,
+                                   scratch_buffer<iter_value_t<I>, A> & buf,
+                                   C pred = C{}, P proj = P{})
+        {
+            I last = ranges::next(first, end_);
+            buf.reserve(static_cast<std::ptrdiff_t>((last - first + 1) / 2));
+            detail::stable_sort_buffered(first,
+                                         last,
+                                         buf.data(),
+                                         buf.capacity(),
+                                         pred,
+                                         proj,
+                                         detail::parallelizable<E, I, I>{});
+            return last;
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename A, typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sortable<iterator_t<Rng>, C, P> AND
+                random_access_range<Rng>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(stable_sort)(E && policy, Rng && rng,
+                                 scratch_buffer<range_value_t<Rng>, A> & buf,
+                                 C pred = C{}, P proj = P{}) //
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           buf,
+                           std::move(pred),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(stable_sort)
 
     namespace cpp20
@@ -13,6 +13,8 @@
 #ifndef RANGES_V3_ALGORITHM_TRANSFORM_HPP
 #define RANGES_V3_ALGORITHM_TRANSFORM_HPP
 
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include <meta/meta.hpp>
@@ -29,8 +31,10 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -43,6 +47,37 @@ namespace ranges
     template<typename I1, typename I2, typename O>
     using binary_transform_result = detail::in1_in2_out_result<I1, I2, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O, typename F, typename P>
+        unary_transform_result<I, O> transform_(I first, S last, O out, F & fun,
+                                                P & proj, std::false_type)
+        {
+            for(; first != last; ++first, ++out)
+                *out = invoke(fun, invoke(proj, *first));
+            return {first, out};
+        }
+
+        template<typename I, typename S, typename O, typename F, typename P>
+        unary_transform_result<I, O> transform_(I first, S last, O out, F & fun,
+                                                P & proj, std::true_type)
+        {
+            using D = iter_difference_t<I>;
+            D const n = last - first;
+            detail::parallel_chunked(
+                n,
+                detail::parallel_chunk_count(n, D(detail::parallel_grain())),
+                [&](std::size_t, D lo, D hi) {
+                    O o = out + static_cast<iter_difference_t<O>>(lo);
+                    for(I it = first + lo, end = first + hi; it != end; ++it, ++o)
+                        *o = invoke(fun, invoke(proj, *it));
+                });
+            return {first + n, out + static_cast<iter_difference_t<O>>(n)};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(transform)
 
         // Single-range variant
@@ -73,6 +108,47 @@ namespace ranges
                 begin(rng), end(rng), std::move(out), std::move(fun), std::move(proj));
         }
 
+        /// \overload
+        /// The elements are transformed in the manner requested by the execution
+        /// policy. Work is split across threads only when both the input and the
+        /// output are random-access.
+        template(typename E, typename I, typename S, typename O, typename F,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_iterator<I> AND
+            sentinel_for<S, I> AND weakly_incrementable<O> AND
+            copy_constructible<F> AND
+            indirectly_writable<O, indirect_result_t<F &, projected<I, P>>>)
+        unary_transform_result<I, O> //
+        RANGES_FUNC(transform)(E &&, I first, S last, O out, F fun, P proj = P{}) //
+        {
+            return detail::transform_(
+                std::move(first),
+                std::move(last),
+                std::move(out),
+                fun,
+                proj,
+                meta::bool_<detail::parallelizable<E, I, S>::value &&
+                            random_access_iterator<O>>{});
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename O, typename F, typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_range<Rng> AND
+            weakly_incrementable<O> AND copy_constructible<F> AND
+            indirectly_writable<O, indirect_result_t<F &, projected<iterator_t<Rng>, P>>>)
+        unary_transform_result<borrowed_iterator_t<Rng>, O> //
+        RANGES_FUNC(transform)(E && policy, Rng && rng, O out, F fun, P proj = P{}) //
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(out),
+                           std::move(fun),
+                           std::move(proj));
+        }
+
         // Double-range variant, 4-iterator version
         /// \overload
         template(typename I0,
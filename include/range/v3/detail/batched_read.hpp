@@ -0,0 +1,74 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_BATCHED_READ_HPP
+#define RANGES_V3_DETAIL_BATCHED_READ_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        /// Iterators over type-erased sequences pay an indirect call for every
+        /// increment and dereference. Specializing `batched_reader` for such an
+        /// iterator and sentinel lets the algorithms that walk the whole sequence
+        /// read its elements a batch at a time instead. A specialization derives
+        /// from `std::true_type` and provides:
+        /// - `buffer_type`, a trivially copyable type that stands for an element;
+        /// - `read(first, last, out, n)`, which constructs up to `n` elements of
+        ///   `[first, last)` in the storage at `out`, advances `first` past them,
+        ///   and returns how many it read, fewer than `n` only at `last`;
+        /// - `get(b)`, which returns the element `b` stands for as an
+        ///   `iter_reference_t<I>`.
+        template<typename I, typename S, typename = void>
+        struct batched_reader : std::false_type
+        {};
+
+        /// The number of elements read per batch.
+        constexpr std::size_t batched_read_size()
+        {
+            return 64;
+        }
+
+        /// Calls `fun` with every element of `[first, last)`, which `batched_reader`
+        /// reads ahead a batch at a time, and returns the end of the sequence.
+        template<typename I, typename S, typename F>
+        I batched_for_each(I first, S last, F & fun)
+        {
+            using reader = batched_reader<I, S>;
+            using B = typename reader::buffer_type;
+            static_assert(std::is_trivially_copyable<B>::value, "");
+            constexpr std::size_t size = detail::batched_read_size();
+            alignas(B) unsigned char storage[size * sizeof(B)];
+            B * const buf = reinterpret_cast<B *>(storage);
+            for(std::size_t n = size; n == size;)
+            {
+                n = reader::read(first, last, buf, size);
+                for(std::size_t i = 0; i != n; ++i)
+                    fun(reader::get(buf[i]));
+            }
+            return first;
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,133 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_BOUNDED_RANDOM_HPP
+#define RANGES_V3_DETAIL_BOUNDED_RANDOM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/invoke.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // How many uniform bits each call of a generator gives: 32 or 64 when
+        // its results span [0, 2^32) or [0, 2^64), else 0. The bounds count,
+        // not the width of the result type: std::mt19937 gives 32 bits in an
+        // unsigned long, which has 64 on LP64.
+        template<typename Gen, typename R = invoke_result_t<Gen &>,
+                 std::uint64_t Max = static_cast<std::uint64_t>(Gen::max())>
+        using random_bits_ = std::integral_constant<
+            int, !(std::is_unsigned<R>::value && Gen::min() == 0 && Gen::max() == Max)
+                     ? 0
+                     : Max == 0xffffffffu       ? 32
+                     : Max == ~std::uint64_t(0) ? 64
+                                                : 0>;
+
+        template<typename Gen>
+        std::uint64_t random_u64_(Gen & gen, std::integral_constant<int, 64>)
+        {
+            return static_cast<std::uint64_t>(gen());
+        }
+        template<typename Gen>
+        std::uint64_t random_u64_(Gen & gen, std::integral_constant<int, 32>)
+        {
+            auto const hi = static_cast<std::uint64_t>(gen());
+            return hi << 32 | static_cast<std::uint64_t>(gen());
+        }
+
+        // 64 uniform bits from a generator with a random_bits_ of 32 or 64.
+        template<typename Gen>
+        std::uint64_t random_u64_(Gen & gen)
+        {
+            return detail::random_u64_(gen, random_bits_<Gen>{});
+        }
+
+        // The high word of a * b, with the low one in lo.
+        inline std::uint64_t mul_u64_(std::uint64_t a, std::uint64_t b,
+                                      std::uint64_t & lo) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            __extension__ using u128 = unsigned __int128;
+            u128 const p = static_cast<u128>(a) * b;
+            lo = static_cast<std::uint64_t>(p);
+            return static_cast<std::uint64_t>(p >> 64);
+#else
+            std::uint64_t const a0 = a & 0xffffffffu, a1 = a >> 32;
+            std::uint64_t const b0 = b & 0xffffffffu, b1 = b >> 32;
+            std::uint64_t const p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+            std::uint64_t const mid =
+                (p00 >> 32) + (p01 & 0xffffffffu) + (p10 & 0xffffffffu);
+            lo = a * b;
+            return a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+        }
+
+        /// A uniform integer in `[0, s)`, for `s > 0`, by Lemire's method ("Fast
+        /// Random Integer Generation in an Interval", 2019): the high word of
+        /// `s` times a random 64-bit word, rejecting the few words that would
+        /// make some results more likely than others. Working out which those
+        /// are takes a division, but only when the low word falls below `s`,
+        /// which it almost never does.
+        template<typename Gen>
+        std::uint64_t bounded_random_(Gen & gen, std::uint64_t s)
+        {
+            std::uint64_t lo;
+            std::uint64_t hi = detail::mul_u64_(detail::random_u64_(gen), s, lo);
+            if(lo < s)
+            {
+                std::uint64_t const threshold = (0 - s) % s;
+                while(lo < threshold)
+                    hi = detail::mul_u64_(detail::random_u64_(gen), s, lo);
+            }
+            return hi;
+        }
+
+        /// `K` independent uniform integers, `out[k]` in `[0, bounds[k])`, from
+        /// one random word when the product of the bounds, `product`, fits in
+        /// it (Brackett-Rozinsky and Lemire, "Batched Ranged Random Integer
+        /// Generation", 2024). Each bound in turn takes the high word of its
+        /// product with what is left of the word. As with one bound, a division
+        /// is needed only when what is left at the end falls below `product`.
+        template<std::size_t K, typename Gen>
+        void bounded_random_batch_(Gen & gen, std::uint64_t const (&bounds)[K],
+                                   std::uint64_t product, std::uint64_t (&out)[K])
+        {
+            std::uint64_t lo = detail::random_u64_(gen);
+            for(std::size_t k = 0; k < K; ++k)
+                out[k] = detail::mul_u64_(lo, bounds[k], lo);
+            if(lo < product)
+            {
+                std::uint64_t const threshold = (0 - product) % product;
+                while(lo < threshold)
+                {
+                    lo = detail::random_u64_(gen);
+                    for(std::size_t k = 0; k < K; ++k)
+                        out[k] = detail::mul_u64_(lo, bounds[k], lo);
+                }
+            }
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
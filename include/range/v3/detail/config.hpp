@@ -84,6 +84,16 @@ namespace ranges
 #endif // NDEBUG
 #endif // RANGES_EXPECT
 
+// Hints that the memory at ADDR will be read soon. ADDR need not be the
+// address of an object; nothing is read from it.
+#ifndef RANGES_PREFETCH
+#if defined(__clang__) || defined(__GNUC__)
+#define RANGES_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#else
+#define RANGES_PREFETCH(ADDR) static_cast<void>(ADDR)
+#endif
+#endif // RANGES_PREFETCH
+
 #ifndef RANGES_ENSURE_MSG
 #if defined(NDEBUG)
 #define RANGES_ENSURE_MSG(COND, MSG)                             \
@@ -215,6 +225,7 @@ namespace ranges
 #define RANGES_DIAGNOSTIC_IGNORE_MULTIPLE_ASSIGNMENT_OPERATORS \
     RANGES_DIAGNOSTIC_IGNORE(4522)
 #define RANGES_DIAGNOSTIC_IGNORE_VOID_PTR_DEREFERENCE
+#define RANGES_DIAGNOSTIC_IGNORE_ARRAY_BOUNDS
 #define RANGES_DIAGNOSTIC_KEYWORD_MACRO
 #define RANGES_DIAGNOSTIC_SUGGEST_OVERRIDE
 
@@ -335,6 +346,7 @@ namespace ranges
 #define RANGES_DIAGNOSTIC_IGNORE_MULTIPLE_ASSIGNMENT_OPERATORS
 #define RANGES_DIAGNOSTIC_IGNORE_VOID_PTR_DEREFERENCE \
     RANGES_DIAGNOSTIC_IGNORE("-Wvoid-ptr-dereference")
+#define RANGES_DIAGNOSTIC_IGNORE_ARRAY_BOUNDS RANGES_DIAGNOSTIC_IGNORE("-Warray-bounds")
 #define RANGES_DIAGNOSTIC_KEYWORD_MACRO RANGES_DIAGNOSTIC_IGNORE("-Wkeyword-macro")
 #define RANGES_DIAGNOSTIC_SUGGEST_OVERRIDE RANGES_DIAGNOSTIC_IGNORE("-Wsuggest-override")
 
@@ -388,6 +400,7 @@ namespace ranges
 #define RANGES_DIAGNOSTIC_IGNORE_TRUNCATION
 #define RANGES_DIAGNOSTIC_IGNORE_MULTIPLE_ASSIGNMENT_OPERATORS
 #define RANGES_DIAGNOSTIC_IGNORE_VOID_PTR_DEREFERENCE
+#define RANGES_DIAGNOSTIC_IGNORE_ARRAY_BOUNDS
 #define RANGES_DIAGNOSTIC_KEYWORD_MACRO
 #define RANGES_DIAGNOSTIC_SUGGEST_OVERRIDE
 #endif
@@ -692,6 +705,20 @@ namespace ranges
 #endif
 #endif // RANGES_CXX_ALIGNED_NEW
 
+// Detect a way to ask whether we are in a constant evaluation, even in C++14 mode.
+#ifndef RANGES_IS_CONSTANT_EVALUATED
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define RANGES_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(RANGES_IS_CONSTANT_EVALUATED) &&                        \
+    ((defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || \
+     (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define RANGES_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif // RANGES_IS_CONSTANT_EVALUATED
+
 #if defined(__clang__)
 #define RANGES_IS_SAME(...) __is_same(__VA_ARGS__)
 #elif defined(__GNUC__) && __GNUC__ >= 6
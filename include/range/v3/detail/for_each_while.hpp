@@ -0,0 +1,111 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_FOR_EACH_WHILE_HPP
+#define RANGES_V3_DETAIL_FOR_EACH_WHILE_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/iterator/basic_iterator.hpp>
+
+#include <range/v3/detail/range_access.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        /// The iterators of a view whose cursor provides `for_each_while(last, sink)`
+        /// are pushable: the view can hand its elements to a sink in a loop of its
+        /// own, instead of being asked for them one `next()` and `read()` at a time.
+        /// Pipelines of adaptors push the elements of their base through sinks that
+        /// filter or transform them, so that the whole pipeline runs as one loop.
+        template<typename I, typename S>
+        struct pushable_ : std::false_type
+        {};
+        template<typename Cur, typename S>
+        struct pushable_<basic_iterator<Cur>, S>
+          : meta::bool_<has_cursor_for_each_while<Cur, uncvref_t<segments_last_t<S>>>>
+        {};
+
+        template<typename I, typename S>
+        using pushable_t = meta::bool_<pushable_<I, S>::value>;
+
+        /// How the algorithms that know about segments and pushable views walk
+        /// `[first, last)`: element by element (`std::false_type`), a segment at a
+        /// time (`std::true_type`), or by pushing the elements into a sink.
+        struct push_tag
+        {};
+
+        template<typename I, typename S>
+        using iteration_t = meta::if_<pushable_t<I, S>, push_tag, segmented_t<I, S>>;
+
+        /// Whether `for_each_while_` can walk `[first, last)` any faster than an
+        /// iterator loop.
+        template<typename I, typename S>
+        using internally_iterable_t =
+            meta::bool_<pushable_t<I, S>::value || segmented_t<I, S>::value>;
+
+        template<typename I, typename S, typename F>
+        I for_each_while_(I first, S last, F & sink);
+
+        template<typename I, typename S, typename F>
+        I for_each_while_(I first, S last, F & sink, std::false_type)
+        {
+            for(; first != last; ++first)
+                if(!sink(*first))
+                    break;
+            return first;
+        }
+
+        template<typename I, typename S, typename F>
+        I for_each_while_(I first, S last, F & sink, std::true_type)
+        {
+            return detail::segmented_visit(
+                std::move(first), std::move(last), [&](auto lfirst, auto llast) {
+                    return detail::for_each_while_(
+                        std::move(lfirst), std::move(llast), sink);
+                });
+        }
+
+        template<typename I, typename S, typename F>
+        I for_each_while_(I first, S last, F & sink, push_tag)
+        {
+            range_access::for_each_while(
+                range_access::pos(first), detail::segments_last_(last), sink);
+            return first;
+        }
+
+        /// Calls `sink(*it)` for the elements of `[first, last)` in order until it
+        /// returns `false`, and returns the position of the element for which it
+        /// did, or `last`'s position. Pushable views push their elements, and
+        /// segmented sequences are walked a segment at a time.
+        template<typename I, typename S, typename F>
+        I for_each_while_(I first, S last, F & sink)
+        {
+            return detail::for_each_while_(
+                std::move(first), std::move(last), sink, iteration_t<I, S>{});
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
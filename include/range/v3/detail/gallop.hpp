@@ -0,0 +1,129 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_GALLOP_HPP
+#define RANGES_V3_DETAIL_GALLOP_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        /// The merge-like loops of the set algorithms step through whichever
+        /// input is behind one element at a time. When one input keeps falling
+        /// behind, as when a short sequence meets a long one, a random-access
+        /// input gallops instead: it probes 1, 2, 4, ... elements ahead and
+        /// binary searches the last gap, so that skipping `k` elements takes
+        /// `O(log k)` comparisons rather than `k`.
+        template<typename I, typename S>
+        using gallopable_t =
+            meta::bool_<random_access_iterator<I> && sized_sentinel_for<S, I>>;
+
+        // How many consecutive steps an input takes before it starts galloping,
+        // and how far a gallop has to get to keep going.
+        constexpr std::ptrdiff_t gallop_min_ = 8;
+
+        // The first position in [it, last) whose element is not `before`, given
+        // that *it is.
+        template<typename I, typename S, typename F>
+        I gallop_(I it, S const & last, F & before)
+        {
+            using D = iter_difference_t<I>;
+            D const n = last - it;
+            D lo = 1, hi = 1;
+            for(; hi < n && before(it[hi]); hi *= 2)
+                lo = hi + 1;
+            if(hi > n)
+                hi = n;
+            while(lo < hi)
+            {
+                D const mid = lo + (hi - lo) / 2;
+                if(before(it[mid]))
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return it + lo;
+        }
+
+        // Steps `it` past the elements that are `before`, given that *it is one.
+        // `run` counts the steps this input has taken since the other one last
+        // moved.
+        template<typename I, typename S, typename F>
+        void skip_while_(I & it, S const &, F &, std::ptrdiff_t &, std::false_type)
+        {
+            ++it;
+        }
+        template<typename I, typename S, typename F>
+        void skip_while_(I & it, S const & last, F & before, std::ptrdiff_t & run,
+                         std::true_type)
+        {
+            if(++run < detail::gallop_min_)
+                ++it;
+            else
+            {
+                I const next = detail::gallop_(it, last, before);
+                if(next - it < detail::gallop_min_)
+                    run = 0;
+                it = next;
+            }
+        }
+
+        // Like skip_while_, but copies the elements it steps past to `out`.
+        template<typename I, typename S, typename F, typename O>
+        void copy_while_(I & it, S const &, F &, O & out, std::ptrdiff_t &,
+                         std::false_type)
+        {
+            *out = *it;
+            ++out;
+            ++it;
+        }
+        template<typename I, typename S, typename F, typename O>
+        void copy_while_(I & it, S const & last, F & before, O & out,
+                         std::ptrdiff_t & run, std::true_type)
+        {
+            if(++run < detail::gallop_min_)
+            {
+                *out = *it;
+                ++out;
+                ++it;
+            }
+            else
+            {
+                I const next = detail::gallop_(it, last, before);
+                if(next - it < detail::gallop_min_)
+                    run = 0;
+                out = ranges::copy(it, next, std::move(out)).out;
+                it = next;
+            }
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
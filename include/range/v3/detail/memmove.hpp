@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_MEMMOVE_HPP
+#define RANGES_V3_DETAIL_MEMMOVE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // clang-format off
+        template(typename I, typename O, typename From)(
+        concept (memmovable_)(I, O, From),
+            same_as<iter_value_t<I>, iter_value_t<O>> AND
+            same_as<iter_reference_t<O>, iter_value_t<O> &> AND
+            (!std::is_volatile<std::remove_reference_t<From>>::value) AND
+            detail::is_trivially_copyable_v<iter_value_t<O>> AND
+            detail::is_trivially_assignable_v<iter_value_t<O> &, From>
+        );
+
+        /// \c memmove_copyable<I, O> holds when `*o = *i` may be implemented by
+        /// copying the bytes of a contiguous sequence.
+        template<typename I, typename O>
+        CPP_concept memmove_copyable =
+            contiguous_iterator<I> && contiguous_iterator<O> &&
+            CPP_concept_ref(detail::memmovable_, I, O, iter_reference_t<I>);
+
+        /// \c memmove_movable<I, O> holds when `*o = iter_move(i)` may be implemented
+        /// by copying the bytes of a contiguous sequence.
+        template<typename I, typename O>
+        CPP_concept memmove_movable =
+            contiguous_iterator<I> && contiguous_iterator<O> &&
+            CPP_concept_ref(detail::memmovable_, I, O, iter_rvalue_reference_t<I>);
+        // clang-format on
+
+        /// Copies the `n` elements starting at `first` to the range starting at
+        /// `out`, which may overlap. Returns the end of the output range.
+        template<typename I, typename O>
+        O memmove_n(I first, iter_difference_t<I> n, O out) noexcept
+        {
+            RANGES_EXPECT(0 <= n);
+            if(n != 0)
+                std::memmove(std::addressof(*out),
+                             std::addressof(*first),
+                             static_cast<std::size_t>(n) * sizeof(iter_value_t<I>));
+            return out + static_cast<iter_difference_t<O>>(n);
+        }
+
+        /// Copies the `n` elements starting at `first` to the range ending at
+        /// `out`, which may overlap. Returns the beginning of the output range.
+        template<typename I, typename O>
+        O memmove_backward_n(I first, iter_difference_t<I> n, O out) noexcept
+        {
+            RANGES_EXPECT(0 <= n);
+            out -= static_cast<iter_difference_t<O>>(n);
+            if(n != 0)
+                std::memmove(std::addressof(*out),
+                             std::addressof(*first),
+                             static_cast<std::size_t>(n) * sizeof(iter_value_t<I>));
+            return out;
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
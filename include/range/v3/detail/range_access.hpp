@@ -148,6 +148,17 @@ namespace ranges
         (
             return pos.distance_to(other)
         )
+        template<typename Cur, typename S, typename F>
+        static constexpr auto CPP_auto_fun(segments)(Cur &pos, S const &last, F &f)
+        (
+            return pos.segments(last, f)
+        )
+        template<typename Cur, typename S, typename F>
+        static constexpr auto CPP_auto_fun(for_each_while)(Cur &pos, S const &last,
+                                                          F &sink)
+        (
+            return pos.for_each_while(last, sink)
+        )
 
     private:
         template<typename Cur>
@@ -302,6 +313,46 @@ namespace ranges
             sentinel_for_cursor<S, C> &&
             CPP_requires_ref(detail::sized_sentinel_for_cursor_, S, C);
 
+        // The function object with which has_cursor_segments probes a cursor.
+        struct segment_probe_fn
+        {
+            template<typename I, typename S>
+            I operator()(I first, S) const;
+        };
+
+        template<typename C, typename S>
+        CPP_requires(has_cursor_segments_,
+            requires(C & c, S const & s, segment_probe_fn & f) //
+            (
+                range_access::segments(c, s, f)
+            ));
+        /// A cursor can provide `segments(last, f)`, which walks it to `last` a
+        /// segment at a time as `segmented_iterator_traits::segments` does.
+        template<typename C, typename S>
+        CPP_concept has_cursor_segments =
+            CPP_requires_ref(detail::has_cursor_segments_, C, S);
+
+        // The sink with which has_cursor_for_each_while probes a cursor.
+        struct for_each_while_probe_fn
+        {
+            template<typename T>
+            bool operator()(T &&) const;
+        };
+
+        template<typename C, typename S>
+        CPP_requires(has_cursor_for_each_while_,
+            requires(C & c, S const & s, for_each_while_probe_fn & sink) //
+            (
+                range_access::for_each_while(c, s, sink)
+            ));
+        /// A cursor can provide `for_each_while(last, sink)`, which calls
+        /// `sink(read())` and steps to the next element for as long as `sink` returns
+        /// `true` and the cursor is not at `last`. It leaves the cursor at the element
+        /// for which `sink` returned `false`, or at `last`.
+        template<typename C, typename S>
+        CPP_concept has_cursor_for_each_while =
+            CPP_requires_ref(detail::has_cursor_for_each_while_, C, S);
+
         template<typename T, typename U>
         CPP_concept output_cursor =
             writable_cursor<T, U> && cursor<T>;
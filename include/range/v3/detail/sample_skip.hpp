@@ -0,0 +1,208 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_SAMPLE_SKIP_HPP
+#define RANGES_V3_DETAIL_SAMPLE_SKIP_HPP
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // A uniform random number in (0, 1], so that its logarithm is finite.
+        template<typename Gen>
+        double sample_uniform_(Gen & gen)
+        {
+            return 1.0 - std::uniform_real_distribution<double>{}(gen);
+        }
+
+        /// Sequential sampling picks `n` of `N` elements in order, each with
+        /// probability `n / N`. Rather than drawing a random number for each
+        /// element, Vitter's Method D ("An Efficient Algorithm for Sequential
+        /// Random Sampling", 1987) draws how many elements to skip before the
+        /// next one it picks, from the distribution of that gap, in constant
+        /// expected time. Picking `n` elements then takes `O(n)` random numbers
+        /// rather than `O(N)`. When `n` is a sizeable part of `N`, Method A,
+        /// which draws one number per pick but steps through the gap, is faster.
+        ///
+        /// The state carried from one skip to the next assumes that each call
+        /// follows a pick, with `N` less by the skip and one, and `n` by one.
+        template<typename D>
+        struct sample_skip_
+        {
+        private:
+            // Vitter's V', which is reused from one pick to the next; negative
+            // when it must be drawn afresh.
+            double vprime_ = -1.0;
+
+            template<typename Gen>
+            static D method_a_(D N, D n, Gen & gen)
+            {
+                double top = static_cast<double>(N - n);
+                double Nreal = static_cast<double>(N);
+                double const v = detail::sample_uniform_(gen);
+                D s = 0;
+                for(double quot = top / Nreal; quot > v; quot = quot * top / Nreal)
+                {
+                    ++s;
+                    top -= 1.0;
+                    Nreal -= 1.0;
+                }
+                return s;
+            }
+
+            template<typename Gen>
+            D method_d_(D N, D n, Gen & gen)
+            {
+                double const Nreal = static_cast<double>(N);
+                double const nreal = static_cast<double>(n);
+                double const ninv = 1.0 / nreal, nmin1inv = 1.0 / (nreal - 1.0);
+                D const qu1 = N - n + 1;
+                double const qu1real = static_cast<double>(qu1);
+                if(vprime_ < 0.0)
+                    vprime_ = std::exp(std::log(detail::sample_uniform_(gen)) * ninv);
+                while(true)
+                {
+                    // A candidate gap from a distribution that bounds the true
+                    // one, and the squeeze and rejection tests of it.
+                    double x;
+                    D s;
+                    while(true)
+                    {
+                        x = Nreal * (1.0 - vprime_);
+                        s = static_cast<D>(x);
+                        if(s < qu1)
+                            break;
+                        vprime_ =
+                            std::exp(std::log(detail::sample_uniform_(gen)) * ninv);
+                    }
+                    double const u = detail::sample_uniform_(gen);
+                    double const sreal = static_cast<double>(s);
+                    double const y1 =
+                        std::exp(std::log(u * Nreal / qu1real) * nmin1inv);
+                    vprime_ = y1 * (1.0 - x / Nreal) * (qu1real / (qu1real - sreal));
+                    if(vprime_ <= 1.0)
+                        return s;
+
+                    double y2 = 1.0, top = Nreal - 1.0, bottom;
+                    D limit;
+                    if(n - 1 > s)
+                    {
+                        bottom = Nreal - nreal;
+                        limit = N - s;
+                    }
+                    else
+                    {
+                        bottom = Nreal - sreal - 1.0;
+                        limit = qu1;
+                    }
+                    for(D t = N - 1; t >= limit; --t)
+                    {
+                        y2 = y2 * top / bottom;
+                        top -= 1.0;
+                        bottom -= 1.0;
+                    }
+                    if(Nreal / (Nreal - x) >= y1 * std::exp(std::log(y2) * nmin1inv))
+                    {
+                        vprime_ =
+                            std::exp(std::log(detail::sample_uniform_(gen)) * nmin1inv);
+                        return s;
+                    }
+                    vprime_ = std::exp(std::log(detail::sample_uniform_(gen)) * ninv);
+                }
+            }
+
+        public:
+            // How many of the `N` elements still to go come before the next of
+            // the `n` to pick, for `0 < n <= N`.
+            template<typename Gen>
+            D operator()(D N, D n, Gen & gen)
+            {
+                RANGES_EXPECT(0 < n && n <= N);
+                if(n == 1)
+                {
+                    vprime_ = -1.0;
+                    return std::uniform_int_distribution<D>{0, N - 1}(gen);
+                }
+                // Vitter's threshold: Method D pays when n < N / 13.
+                if(N / 13 <= n)
+                {
+                    vprime_ = -1.0;
+                    return method_a_(N, n, gen);
+                }
+                return method_d_(N, n, gen);
+            }
+        };
+
+        /// Li's Algorithm L ("Reservoir-Sampling Algorithms of Time Complexity
+        /// O(n(1 + log(N/n)))", 1994) keeps a uniform sample of `n` of the
+        /// elements seen so far. Once the reservoir is full, the number of
+        /// elements that go by before the next one replaces a random member of
+        /// it follows a geometric distribution, whose parameter shrinks with each
+        /// replacement; it is drawn directly, so that a stream of `N` elements
+        /// takes `O(n log(N / n))` random numbers rather than `O(N)`.
+        template<typename D>
+        struct reservoir_skip_
+        {
+        private:
+            double ninv_;
+            double w_;
+
+            template<typename Gen>
+            static double beta_(double a, double b, Gen & gen)
+            {
+                double const x = std::gamma_distribution<double>{a}(gen);
+                return x / (x + std::gamma_distribution<double>{b}(gen));
+            }
+
+        public:
+            // Picks up after `seen` elements have gone through a reservoir of
+            // `n`, by whatever means, with the state they leave: the largest of
+            // `n` keys that are the least of `seen` uniform ones, which has the
+            // distribution Beta(n, seen - n + 1).
+            template<typename N, typename Gen>
+            reservoir_skip_(N n, N seen, Gen & gen)
+              : ninv_(1.0 / static_cast<double>(n))
+              , w_(seen == n ? std::exp(std::log(detail::sample_uniform_(gen)) * ninv_)
+                             : reservoir_skip_::beta_(static_cast<double>(n),
+                                                      static_cast<double>(seen - n + 1),
+                                                      gen))
+            {}
+
+            // How many elements to pass over before the next one that goes into
+            // the reservoir, which may be more than any range holds.
+            template<typename Gen>
+            D operator()(Gen & gen)
+            {
+                double const skip = std::floor(std::log(detail::sample_uniform_(gen)) /
+                                               std::log1p(-w_));
+                w_ *= std::exp(std::log(detail::sample_uniform_(gen)) * ninv_);
+                constexpr D max = (std::numeric_limits<D>::max)();
+                // Also catches the NaN of a w_ that has underflowed to 0.
+                return skip < static_cast<double>(max) ? static_cast<D>(skip) : max;
+            }
+        };
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_SEGMENTED_HPP
+#define RANGES_V3_DETAIL_SEGMENTED_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#if defined(__GLIBCXX__)
+#include <deque>
+#endif
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        /// A segmented sequence, such as a joined range of ranges, is a sequence of
+        /// segments, each of which can be walked with iterators that are cheaper
+        /// than those of the whole sequence. Specializing
+        /// `segmented_iterator_traits` for an iterator and sentinel lets the
+        /// algorithms that walk the whole sequence run a tight loop over each
+        /// segment in turn. A specialization derives from `std::true_type` and
+        /// provides `segments(first, last, f)`, which calls `f(lfirst, llast)` for
+        /// the non-empty segments of `[first, last)` in order. `f` returns a
+        /// position in `[lfirst, llast]`: if it is not `llast`, `segments` stops
+        /// there and leaves `first` at the element it denotes; otherwise it goes
+        /// on to the next segment, and leaves `first` equal to `last` at the end.
+        /// Different segments may have different types of iterators.
+        template<typename I, typename S, typename = void>
+        struct segmented_iterator_traits : std::false_type
+        {};
+
+        template<typename I, typename S>
+        using segmented_t = meta::bool_<segmented_iterator_traits<I, S>::value>;
+
+        /// Calls `f(lfirst, llast)` for the segments of `[first, last)` as
+        /// `segmented_iterator_traits<I, S>::segments` does, and returns the
+        /// position at which it stopped.
+        template<typename I, typename S, typename F>
+        I segmented_visit(I first, S last, F f)
+        {
+            segmented_iterator_traits<I, S>::segments(first, last, f);
+            return first;
+        }
+
+#if defined(__GLIBCXX__)
+        // A std::deque is a sequence of fixed-size blocks. This depends on the
+        // internals of libstdc++: its deque iterator is std::_Deque_iterator,
+        // whose _M_cur and _M_last point into the current block and whose
+        // _M_node points at the block's entry in the map. Other standard
+        // libraries do not expose their blocks, so their deques are walked one
+        // element at a time. The static_assert below catches a change in that
+        // layout rather than letting the walk go wrong.
+        template<typename T, typename R, typename P>
+        struct segmented_iterator_traits<std::_Deque_iterator<T, R, P>,
+                                         std::_Deque_iterator<T, R, P>,
+                                         meta::if_c<std::is_pointer<P>::value>>
+          : std::true_type
+        {
+            using iterator = std::_Deque_iterator<T, R, P>;
+            static_assert(
+                std::is_convertible<decltype(iterator::_M_cur), P>::value &&
+                    std::is_convertible<decltype(iterator::_M_last), P>::value &&
+                    std::is_pointer<decltype(iterator::_M_node)>::value,
+                "The layout of libstdc++'s std::deque iterators has changed; "
+                "range-v3 cannot walk their blocks.");
+
+            template<typename F>
+            static void segments(iterator & first, iterator const & last, F & f)
+            {
+                for(; first._M_node != last._M_node;)
+                {
+                    P const lfirst = first._M_cur;
+                    P const llast = first._M_last;
+                    P const pos = f(lfirst, llast);
+                    first += pos - lfirst;
+                    if(pos != llast)
+                        return;
+                }
+                if(first._M_cur != last._M_cur)
+                {
+                    P const lfirst = first._M_cur;
+                    first += f(lfirst, P(last._M_cur)) - lfirst;
+                }
+            }
+        };
+#endif
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,347 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_SIMD_HPP
+#define RANGES_V3_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+// Pick the widest instruction set the translation unit is compiled for. Define
+// RANGES_NO_SIMD to always use the portable kernels.
+#if !defined(RANGES_NO_SIMD) && !defined(RANGES_SIMD_AVX2) && !defined(RANGES_SIMD_SSE2)
+#if defined(__AVX2__)
+#define RANGES_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RANGES_SIMD_SSE2 1
+#endif
+#endif
+
+#if defined(RANGES_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(RANGES_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        /// Element types for which `==` is bitwise equality.
+        template<typename T>
+        using simd_bitwise = meta::bool_<std::is_integral<T>::value
+#if defined(__cpp_lib_byte) && __cpp_lib_byte >= 201603L
+                                         || RANGES_IS_SAME(T, std::byte)
+#endif
+                                         >;
+
+        /// Element types for which `==` is either bitwise equality or the lane-wise
+        /// comparison of the vector unit (`float` and `double`).
+        template<typename T>
+        using simd_comparable = meta::bool_<simd_bitwise<T>::value ||
+                                            RANGES_IS_SAME(T, float) ||
+                                            RANGES_IS_SAME(T, double)>;
+
+        // clang-format off
+        template(typename I, typename S)(
+        concept (vectorizable_iterator_)(I, S),
+            sized_sentinel_for<S, I> AND
+            simd_comparable<iter_value_t<I>>::value
+        );
+
+        /// \c vectorizable_iterator<I, S> holds when `[I, S)` denotes a contiguous
+        /// array of elements that the kernels below can compare directly.
+        template<typename I, typename S = I>
+        CPP_concept vectorizable_iterator =
+            contiguous_iterator<I> &&
+            CPP_concept_ref(detail::vectorizable_iterator_, I, S);
+
+        template(typename I0, typename S0, typename I1, typename S1)(
+        concept (vectorizable_pair_)(I0, S0, I1, S1),
+            same_as<iter_value_t<I0>, iter_value_t<I1>>
+        );
+
+        /// \c vectorizable_pair holds when two sequences can be compared element-wise
+        /// by the kernels below.
+        template<typename I0, typename S0, typename I1, typename S1 = I1>
+        CPP_concept vectorizable_pair =
+            vectorizable_iterator<I0, S0> && vectorizable_iterator<I1, S1> &&
+            CPP_concept_ref(detail::vectorizable_pair_, I0, S0, I1, S1);
+        // clang-format on
+
+        inline int countr_zero32(std::uint32_t m) noexcept
+        {
+            RANGES_EXPECT(m != 0);
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctz(m);
+#elif defined(_MSC_VER)
+            unsigned long i;
+            _BitScanForward(&i, m);
+            return static_cast<int>(i);
+#else
+            int i = 0;
+            for(; !(m & 1u); m >>= 1)
+                ++i;
+            return i;
+#endif
+        }
+
+        inline int popcount32(std::uint32_t m) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcount(m);
+#else
+            m = m - ((m >> 1) & 0x55555555u);
+            m = (m & 0x33333333u) + ((m >> 2) & 0x33333333u);
+            return static_cast<int>((((m + (m >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#endif
+        }
+
+#if defined(RANGES_SIMD_AVX2) || defined(RANGES_SIMD_SSE2)
+        /// Collapses a mask with one bit per byte into a mask with one bit per
+        /// `sizeof(T)`-byte element, set where every byte of the element was set. The
+        /// bit for element `i` ends up at position `i * sizeof(T)`.
+        template<typename T>
+        constexpr std::uint32_t simd_element_mask(std::uint32_t m) noexcept
+        {
+            constexpr std::uint32_t strides[] = {
+                0u, 0xFFFFFFFFu, 0x55555555u, 0u, 0x11111111u, 0u, 0u, 0u, 0x01010101u};
+            std::uint32_t r = m;
+            for(std::size_t i = 1; i < sizeof(T); ++i)
+                r &= m >> i;
+            return r & strides[sizeof(T)];
+        }
+
+#if defined(RANGES_SIMD_AVX2)
+        struct simd_ops
+        {
+            static constexpr std::ptrdiff_t bytes = 32;
+            static constexpr std::uint32_t all = 0xFFFFFFFFu;
+
+            // One bit per byte, set where the elements at `a` and `b` compare equal.
+            template<typename T>
+            static std::uint32_t eq(T const * a, T const * b) noexcept
+            {
+                __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a));
+                __m256i const y = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b));
+                return static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+            }
+            static std::uint32_t eq(float const * a, float const * b) noexcept
+            {
+                __m256 const r = _mm256_cmp_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b),
+                                               _CMP_EQ_OQ);
+                return static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_castps_si256(r)));
+            }
+            static std::uint32_t eq(double const * a, double const * b) noexcept
+            {
+                __m256d const r = _mm256_cmp_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b),
+                                                _CMP_EQ_OQ);
+                return static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_castpd_si256(r)));
+            }
+        };
+#else
+        struct simd_ops
+        {
+            static constexpr std::ptrdiff_t bytes = 16;
+            static constexpr std::uint32_t all = 0xFFFFu;
+
+            // One bit per byte, set where the elements at `a` and `b` compare equal.
+            template<typename T>
+            static std::uint32_t eq(T const * a, T const * b) noexcept
+            {
+                __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a));
+                __m128i const y = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+            }
+            static std::uint32_t eq(float const * a, float const * b) noexcept
+            {
+                __m128 const r = _mm_cmpeq_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_castps_si128(r)));
+            }
+            static std::uint32_t eq(double const * a, double const * b) noexcept
+            {
+                __m128d const r = _mm_cmpeq_pd(_mm_loadu_pd(a), _mm_loadu_pd(b));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_castpd_si128(r)));
+            }
+        };
+#endif
+
+        template<typename T>
+        struct simd_splat
+        {
+            static constexpr std::ptrdiff_t size =
+                simd_ops::bytes / static_cast<std::ptrdiff_t>(sizeof(T));
+            T values[size];
+            explicit simd_splat(T value) noexcept
+            {
+                for(auto & t : values)
+                    t = value;
+            }
+        };
+#endif // RANGES_SIMD_AVX2 || RANGES_SIMD_SSE2
+
+        /// Returns the index of the first element of `[first, first + n)` that is
+        /// equal to `value`, or `n`.
+        template<typename T>
+        std::ptrdiff_t simd_find(T const * first, std::ptrdiff_t n, T value) noexcept
+        {
+            std::ptrdiff_t i = 0;
+            if(RANGES_CONSTEXPR_IF(sizeof(T) == 1 && simd_bitwise<T>::value))
+            {
+                // The C library's memchr is already vectorized and dispatches on
+                // the capabilities of the host at run time.
+                unsigned char byte;
+                std::memcpy(&byte, &value, 1);
+                auto const p = std::memchr(first, byte, static_cast<std::size_t>(n));
+                return p ? static_cast<unsigned char const *>(p) -
+                               reinterpret_cast<unsigned char const *>(first)
+                         : n;
+            }
+#if defined(RANGES_SIMD_AVX2) || defined(RANGES_SIMD_SSE2)
+            simd_splat<T> const splat{value};
+            for(; i + splat.size <= n; i += splat.size)
+                if(auto m = simd_element_mask<T>(simd_ops::eq(first + i, splat.values)))
+                    return i + countr_zero32(m) / static_cast<int>(sizeof(T));
+#endif
+            for(; i != n; ++i)
+                if(first[i] == value)
+                    break;
+            return i;
+        }
+
+        /// Returns the number of elements of `[first, first + n)` that are equal to
+        /// `value`.
+        template<typename T>
+        std::ptrdiff_t simd_count(T const * first, std::ptrdiff_t n, T value) noexcept
+        {
+            std::ptrdiff_t i = 0, c = 0;
+#if defined(RANGES_SIMD_AVX2) || defined(RANGES_SIMD_SSE2)
+            simd_splat<T> const splat{value};
+            for(; i + splat.size <= n; i += splat.size)
+                c += popcount32(simd_element_mask<T>(simd_ops::eq(first + i, splat.values)));
+#endif
+            for(; i != n; ++i)
+                c += first[i] == value;
+            return c;
+        }
+
+        // The vector loop only loads whole blocks inside the range, but when it
+        // is inlined over a tiny object of known size, such as the single_view
+        // pattern of a split_view, GCC warns about the loads it fails to prove
+        // dead.
+        RANGES_DIAGNOSTIC_PUSH
+        RANGES_DIAGNOSTIC_IGNORE_ARRAY_BOUNDS
+
+        /// Returns the index of the first position at which `[a, a + n)` and
+        /// `[b, b + n)` differ, or `n`.
+        template<typename T>
+        std::ptrdiff_t simd_mismatch(T const * a, T const * b, std::ptrdiff_t n) noexcept
+        {
+            std::ptrdiff_t i = 0;
+#if defined(RANGES_SIMD_AVX2) || defined(RANGES_SIMD_SSE2)
+            constexpr std::ptrdiff_t lanes =
+                simd_ops::bytes / static_cast<std::ptrdiff_t>(sizeof(T));
+            constexpr std::uint32_t lanes_mask =
+                simd_element_mask<T>(0xFFFFFFFFu) & simd_ops::all;
+            for(; i + lanes <= n; i += lanes)
+            {
+                auto const m = simd_element_mask<T>(simd_ops::eq(a + i, b + i));
+                if(m != lanes_mask)
+                    return i + countr_zero32(~m & lanes_mask) / static_cast<int>(sizeof(T));
+            }
+#endif
+            for(; i != n; ++i)
+                if(!(a[i] == b[i]))
+                    break;
+            return i;
+        }
+
+        RANGES_DIAGNOSTIC_POP
+
+        /// Returns whether `[a, a + n)` and `[b, b + n)` are element-wise equal.
+        template<typename T>
+        bool simd_equal(T const * a, T const * b, std::ptrdiff_t n) noexcept
+        {
+            if(RANGES_CONSTEXPR_IF(simd_bitwise<T>::value))
+                return n == 0 ||
+                       std::memcmp(a, b, static_cast<std::size_t>(n) * sizeof(T)) == 0;
+            return detail::simd_mismatch(a, b, n) == n;
+        }
+
+        /// Returns the index of the first occurrence of `[pat, pat + m)` in
+        /// `[first, first + n)`, or `n`. Meant for short patterns: it finds the
+        /// candidates for the first element with simd_find and compares the rest.
+        template<typename T>
+        std::ptrdiff_t simd_search(T const * first, std::ptrdiff_t n, T const * pat,
+                                   std::ptrdiff_t m) noexcept
+        {
+            RANGES_EXPECT(0 < m);
+            std::ptrdiff_t const last = n - m + 1;
+            for(std::ptrdiff_t i = 0; i < last; ++i)
+            {
+                i += detail::simd_find(first + i, last - i, pat[0]);
+                if(i == last)
+                    break;
+                if(detail::simd_equal(first + i + 1, pat + 1, m - 1))
+                    return i;
+            }
+            return n;
+        }
+
+        /// Returns whether `[a, a + n0)` lexicographically precedes `[b, b + n1)`.
+        /// Integral elements only: `<` on floating point is not a total order.
+        template<typename T>
+        bool simd_lexicographical_compare(T const * a, std::ptrdiff_t n0, T const * b,
+                                          std::ptrdiff_t n1) noexcept
+        {
+            static_assert(std::is_integral<T>::value, "");
+            std::ptrdiff_t const n = n0 < n1 ? n0 : n1;
+            if(RANGES_CONSTEXPR_IF(sizeof(T) == 1 && std::is_unsigned<T>::value))
+            {
+                if(n != 0)
+                    if(int const r = std::memcmp(a, b, static_cast<std::size_t>(n)))
+                        return r < 0;
+                return n0 < n1;
+            }
+            std::ptrdiff_t const i = detail::simd_mismatch(a, b, n);
+            return i == n ? n0 < n1 : a[i] < b[i];
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
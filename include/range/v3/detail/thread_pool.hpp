@@ -0,0 +1,304 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_THREAD_POOL_HPP
+#define RANGES_V3_DETAIL_THREAD_POOL_HPP
+
+#include <cstddef>
+
+#ifndef RANGES_NO_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+// The number of threads, including the calling one, that run the tasks of the
+// parallel algorithms. Zero means one per hardware thread.
+#ifndef RANGES_PARALLEL_THREADS
+#define RANGES_PARALLEL_THREADS 0
+#endif
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+#ifndef RANGES_NO_THREADS
+        /// A process-wide pool of worker threads that run the tasks of parallel
+        /// algorithms. Every worker owns a task queue; it pops its own tasks from
+        /// the back and, when it runs dry, steals from the front of the others'.
+        /// A thread waiting for its tasks to finish runs queued tasks meanwhile,
+        /// which keeps nested parallel algorithms from deadlocking.
+        struct thread_pool
+        {
+        private:
+            struct task
+            {
+                void (*run)(void *, std::size_t);
+                void * fun;
+                std::size_t index;
+                std::atomic<std::size_t> * pending;
+            };
+            struct task_queue
+            {
+                std::mutex mtx;
+                std::deque<task> tasks;
+            };
+
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+            std::vector<std::unique_ptr<task_queue>> queues_;
+            std::vector<std::thread> workers_;
+            std::mutex sleep_mtx_;
+            std::condition_variable sleep_cv_;
+            std::atomic<std::size_t> queued_{0};
+            std::atomic<std::size_t> next_queue_{0};
+            bool stop_ = false;
+
+            // The index of the worker running on this thread, or npos.
+            static std::size_t & self() noexcept
+            {
+#if RANGES_CXX_THREAD_LOCAL >= RANGES_CXX_THREAD_LOCAL_11
+                static thread_local std::size_t index = npos;
+                return index;
+#else
+                static std::size_t index = npos;
+                return index;
+#endif
+            }
+
+            thread_pool()
+            {
+                std::size_t const threads = RANGES_PARALLEL_THREADS > 0
+                                                ? RANGES_PARALLEL_THREADS
+                                                : std::thread::hardware_concurrency();
+                std::size_t const n = threads > 1 ? threads - 1 : 0;
+                for(std::size_t i = 0; i < n; ++i)
+                    queues_.emplace_back(new task_queue);
+                for(std::size_t i = 0; i < n; ++i)
+                    workers_.emplace_back([this, i] { work(i); });
+            }
+
+            static void execute(task const & t) noexcept
+            {
+                t.run(t.fun, t.index);
+                t.pending->fetch_sub(1, std::memory_order_release);
+            }
+
+            bool try_pop(std::size_t me, task & t)
+            {
+                std::size_t const n = queues_.size();
+                if(me != npos)
+                {
+                    task_queue & q = *queues_[me];
+                    std::lock_guard<std::mutex> lock(q.mtx);
+                    if(!q.tasks.empty())
+                    {
+                        t = q.tasks.back();
+                        q.tasks.pop_back();
+                        queued_.fetch_sub(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+                std::size_t const start = me == npos ? 0 : me + 1;
+                for(std::size_t k = 0; k < n; ++k)
+                {
+                    task_queue & q = *queues_[(start + k) % n];
+                    std::lock_guard<std::mutex> lock(q.mtx);
+                    if(!q.tasks.empty())
+                    {
+                        t = q.tasks.front();
+                        q.tasks.pop_front();
+                        queued_.fetch_sub(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void work(std::size_t me)
+            {
+                self() = me;
+                while(true)
+                {
+                    task t;
+                    if(try_pop(me, t))
+                    {
+                        thread_pool::execute(t);
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(sleep_mtx_);
+                    sleep_cv_.wait(lock, [this] {
+                        return stop_ || queued_.load(std::memory_order_relaxed) != 0;
+                    });
+                    if(stop_ && queued_.load(std::memory_order_relaxed) == 0)
+                        return;
+                }
+            }
+
+        public:
+            thread_pool(thread_pool const &) = delete;
+            thread_pool & operator=(thread_pool const &) = delete;
+
+            ~thread_pool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(sleep_mtx_);
+                    stop_ = true;
+                }
+                sleep_cv_.notify_all();
+                for(std::thread & w : workers_)
+                    w.join();
+            }
+
+            static thread_pool & instance()
+            {
+                static thread_pool pool;
+                return pool;
+            }
+
+            /// The number of threads that run tasks: the workers and the caller.
+            std::size_t concurrency() const noexcept
+            {
+                return workers_.size() + 1;
+            }
+
+            /// Calls `fun(i)` for every `i` in `[0, n)`, in parallel, and returns
+            /// when all calls have returned. An exception escaping `fun` calls
+            /// `std::terminate`, as with the standard parallel algorithms.
+            template<typename F>
+            void fork_join(std::size_t n, F & fun)
+            {
+                if(n == 0)
+                    return;
+                if(n == 1 || workers_.empty())
+                {
+                    for(std::size_t i = 0; i < n; ++i)
+                        fun(i);
+                    return;
+                }
+
+                std::atomic<std::size_t> pending{n};
+                auto run = [](void * f, std::size_t i) noexcept {
+                    (*static_cast<F *>(f))(i);
+                };
+                std::size_t const me = self();
+                std::size_t const nqueues = queues_.size();
+                if(me != npos)
+                {
+                    // Keep the tasks local; idle workers will steal them.
+                    task_queue & q = *queues_[me];
+                    std::lock_guard<std::mutex> lock(q.mtx);
+                    for(std::size_t i = n - 1; i != 0; --i)
+                        q.tasks.push_back(task{run, std::addressof(fun), i, &pending});
+                }
+                else
+                {
+                    std::size_t const first =
+                        next_queue_.fetch_add(1, std::memory_order_relaxed);
+                    for(std::size_t i = 1; i < n; ++i)
+                    {
+                        task_queue & q = *queues_[(first + i) % nqueues];
+                        std::lock_guard<std::mutex> lock(q.mtx);
+                        q.tasks.push_back(task{run, std::addressof(fun), i, &pending});
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> lock(sleep_mtx_);
+                    queued_.fetch_add(n - 1, std::memory_order_relaxed);
+                }
+                sleep_cv_.notify_all();
+
+                thread_pool::execute(task{run, std::addressof(fun), 0, &pending});
+                while(pending.load(std::memory_order_acquire) != 0)
+                {
+                    task t;
+                    if(try_pop(me, t))
+                        thread_pool::execute(t);
+                    else
+                        std::this_thread::yield();
+                }
+            }
+        };
+
+        inline std::size_t parallel_concurrency()
+        {
+            return thread_pool::instance().concurrency();
+        }
+
+        template<typename F>
+        void parallel_for(std::size_t n, F fun)
+        {
+            thread_pool::instance().fork_join(n, fun);
+        }
+#else  // RANGES_NO_THREADS
+        inline std::size_t parallel_concurrency()
+        {
+            return 1;
+        }
+
+        template<typename F>
+        void parallel_for(std::size_t n, F fun)
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                fun(i);
+        }
+#endif // RANGES_NO_THREADS
+
+        /// The number of chunks in which to split `n` elements so that every chunk
+        /// holds at least about `grain` of them and there are a few chunks per
+        /// thread to balance the load.
+        template<typename D>
+        std::size_t parallel_chunk_count(D n, D grain)
+        {
+            RANGES_EXPECT(0 <= n && 0 < grain);
+            std::size_t const max_chunks = detail::parallel_concurrency() * 4;
+            std::size_t const chunks = static_cast<std::size_t>(n / grain);
+            return chunks == 0 ? 1 : chunks < max_chunks ? chunks : max_chunks;
+        }
+
+        /// The offset of the start of chunk `i` when `n` elements are split into
+        /// `chunks` contiguous chunks of nearly equal size.
+        template<typename D>
+        D parallel_chunk_begin(D n, std::size_t chunks, std::size_t i)
+        {
+            D const c = static_cast<D>(chunks), k = static_cast<D>(i);
+            D const rem = n % c;
+            return (n / c) * k + (k < rem ? k : rem);
+        }
+
+        /// Splits `[0, n)` into `chunks` contiguous chunks and calls
+        /// `fun(i, begin, end)` for the `i`th of them, in parallel.
+        template<typename D, typename F>
+        void parallel_chunked(D n, std::size_t chunks, F fun)
+        {
+            detail::parallel_for(chunks, [n, chunks, &fun](std::size_t i) {
+                fun(i,
+                    detail::parallel_chunk_begin(n, chunks, i),
+                    detail::parallel_chunk_begin(n, chunks, i + 1));
+            });
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_FUNCTIONAL_INDIRECT_HPP
 #define RANGES_V3_FUNCTIONAL_INDIRECT_HPP
 
+#include <type_traits>
 #include <utility>
 
 #include <concepts/concepts.hpp>
@@ -80,6 +81,37 @@ namespace ranges
         // clang-format on
     };
 
+    /// \cond
+    namespace detail
+    {
+        template<typename Fn>
+        struct is_indirected_ : std::false_type
+        {};
+        template<typename Fn>
+        struct is_indirected_<indirected<Fn>> : std::true_type
+        {};
+
+        // Stands in for an iterator to an element that has already been read, so
+        // that an indirected function can be applied to the element itself.
+        template<typename Ref>
+        struct element_ptr_
+        {
+            Ref && ref_;
+
+            Ref && operator*() const noexcept
+            {
+                return static_cast<Ref &&>(ref_);
+            }
+        };
+
+        template<typename Ref>
+        element_ptr_<Ref> element_ptr(Ref && ref) noexcept
+        {
+            return {static_cast<Ref &&>(ref)};
+        }
+    } // namespace detail
+    /// \endcond
+
     struct indirect_fn
     {
         template<typename Fn>
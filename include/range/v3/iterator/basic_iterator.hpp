@@ -32,6 +32,7 @@
 #include <range/v3/utility/semiregular_box.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/segmented.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 RANGES_DIAGNOSTIC_PUSH
@@ -1061,6 +1062,36 @@ namespace ranges
 
         template<typename Cur>
         using std_iterator_traits = std_iterator_traits_<Cur, (bool)readable_cursor<Cur>>;
+
+        template<typename Cur>
+        Cur const & segments_last_(basic_iterator<Cur> const & last) noexcept
+        {
+            return range_access::pos(last);
+        }
+        template<typename S>
+        S const & segments_last_(S const & last) noexcept
+        {
+            return last;
+        }
+
+        template<typename S>
+        using segments_last_t =
+            decltype(detail::segments_last_(std::declval<S const &>()));
+
+        // The iterators of views whose cursors know their segments.
+        template<typename Cur, typename S>
+        struct segmented_iterator_traits<
+            basic_iterator<Cur>, S,
+            meta::if_c<has_cursor_segments<Cur, uncvref_t<segments_last_t<S>>>>>
+          : std::true_type
+        {
+            template<typename F>
+            static void segments(basic_iterator<Cur> & first, S const & last, F & f)
+            {
+                range_access::segments(
+                    range_access::pos(first), detail::segments_last_(last), f);
+            }
+        };
     } // namespace detail
     /// \endcond
 } // namespace ranges
@@ -13,6 +13,11 @@
 #ifndef RANGES_V3_NUMERIC_ACCUMULATE_HPP
 #define RANGES_V3_NUMERIC_ACCUMULATE_HPP
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <meta/meta.hpp>
 
 #include <range/v3/functional/arithmetic.hpp>
@@ -23,14 +28,119 @@
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-numerics
     /// @{
+    /// \cond
+    namespace detail
+    {
+        // clang-format off
+        template(typename I, typename T, typename Op, typename P)(
+        concept (parallel_accumulable_)(I, T, Op, P),
+            associative_op_<Op>::value AND
+            constructible_from<T, iter_reference_t<projected<I, P>>> AND
+            assignable_from<T &, invoke_result_t<Op &, T &, T &>>
+        );
+        /// \c parallel_accumulable holds when the elements can be folded in
+        /// separate chunks whose partial results are then combined with \c Op.
+        template<typename I, typename T, typename Op, typename P>
+        CPP_concept parallel_accumulable =
+            invocable<Op &, T &, T &> &&
+            CPP_concept_ref(detail::parallel_accumulable_, I, T, Op, P);
+        // clang-format on
+
+        // Folds the elements into init and returns the end of the input.
+        template<typename I, typename S, typename T, typename Op, typename P>
+        I accumulate_segmented_(I first, S last, T & init, Op & op, P & proj,
+                                std::false_type)
+        {
+            // A local accumulator cannot alias the elements, so the compiler is
+            // free to keep it in a register and vectorize the loop.
+            T acc = std::move(init);
+            for(; first != last; ++first)
+                acc = invoke(op, acc, invoke(proj, *first));
+            init = std::move(acc);
+            return first;
+        }
+
+        template<typename I, typename S, typename T, typename Op, typename P>
+        I accumulate_segmented_(I first, S last, T & init, Op & op, P & proj,
+                                push_tag)
+        {
+            T acc = std::move(init);
+            auto fold = [&](auto && ref) {
+                acc = invoke(op, acc, invoke(proj, static_cast<decltype(ref)>(ref)));
+                return true;
+            };
+            first = detail::for_each_while_(std::move(first), std::move(last), fold);
+            init = std::move(acc);
+            return first;
+        }
+
+        template<typename I, typename S, typename T, typename Op, typename P>
+        I accumulate_segmented_(I first, S last, T & init, Op & op, P & proj,
+                                std::true_type)
+        {
+            return detail::segmented_visit(
+                std::move(first), std::move(last), [&](auto lfirst, auto llast) {
+                    using LI = decltype(lfirst);
+                    using LS = decltype(llast);
+                    return detail::accumulate_segmented_(std::move(lfirst),
+                                                         std::move(llast),
+                                                         init,
+                                                         op,
+                                                         proj,
+                                                         detail::iteration_t<LI, LS>{});
+                });
+        }
+
+        template<typename I, typename S, typename T, typename Op, typename P>
+        T accumulate_(I first, S last, T init, Op & op, P & proj, std::false_type)
+        {
+            detail::accumulate_segmented_(std::move(first),
+                                          std::move(last),
+                                          init,
+                                          op,
+                                          proj,
+                                          detail::iteration_t<I, S>{});
+            return init;
+        }
+
+        template<typename I, typename S, typename T, typename Op, typename P>
+        T accumulate_(I first, S last, T init, Op & op, P & proj, std::true_type)
+        {
+            using D = iter_difference_t<I>;
+            D const n = last - first;
+            std::size_t const chunks =
+                detail::parallel_chunk_count(n, D(detail::parallel_grain()));
+            std::vector<optional<T>> partial(chunks);
+            detail::parallel_chunked(n, chunks, [&](std::size_t i, D lo, D hi) {
+                if(lo == hi)
+                    return;
+                I it = first + lo;
+                T acc(invoke(proj, *it));
+                for(I end = first + hi; ++it != end;)
+                    acc = invoke(op, acc, invoke(proj, *it));
+                partial[i].emplace(std::move(acc));
+            });
+            for(optional<T> & p : partial)
+                if(p)
+                    init = invoke(op, init, *p);
+            return init;
+        }
+    } // namespace detail
+    /// \endcond
+
     struct accumulate_fn
     {
         template(typename I, typename S, typename T, typename Op = plus,
@@ -42,8 +152,12 @@ namespace ranges
         T operator()(I first, S last, T init, Op op = Op{},
                         P proj = P{}) const
         {
-            for(; first != last; ++first)
-                init = invoke(op, init, invoke(proj, *first));
+            detail::accumulate_segmented_(std::move(first),
+                                          std::move(last),
+                                          init,
+                                          op,
+                                          proj,
+                                          detail::iteration_t<I, S>{});
             return init;
         }
 
@@ -58,6 +172,49 @@ namespace ranges
             return (*this)(
                 begin(rng), end(rng), std::move(init), std::move(op), std::move(proj));
         }
+
+        /// \overload
+        /// Folds the elements in the manner requested by the execution policy. A
+        /// parallel fold combines the partial results of contiguous chunks of
+        /// the input in order with \c op. Only folds with an operation that is
+        /// known to be associative, such as \c plus, \c multiplies or
+        /// \c std::plus, are split this way; the others run sequentially.
+        template(typename E, typename I, typename S, typename T, typename Op = plus,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sentinel_for<S, I> AND
+                input_iterator<I> AND
+                indirectly_binary_invocable_<Op, T *, projected<I, P>> AND
+                assignable_from<T &, indirect_result_t<Op &, T *, projected<I, P>>>)
+        T operator()(E &&, I first, S last, T init, Op op = Op{}, P proj = P{}) const
+        {
+            return detail::accumulate_(
+                std::move(first),
+                std::move(last),
+                std::move(init),
+                op,
+                proj,
+                meta::bool_<detail::parallelizable<E, I, S>::value &&
+                            detail::parallel_accumulable<I, T, Op, P>>{});
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename T, typename Op = plus,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND input_range<Rng> AND
+                indirectly_binary_invocable_<Op, T *, projected<iterator_t<Rng>, P>> AND
+                assignable_from<
+                    T &, indirect_result_t<Op &, T *, projected<iterator_t<Rng>, P>>>)
+        T operator()(E && policy, Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(init),
+                           std::move(op),
+                           std::move(proj));
+        }
     };
 
     RANGES_INLINE_VARIABLE(accumulate_fn, accumulate)
@@ -14,6 +14,11 @@
 #ifndef RANGES_V3_NUMERIC_PARTIAL_SUM_HPP
 #define RANGES_V3_NUMERIC_PARTIAL_SUM_HPP
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <meta/meta.hpp>
 
 #include <range/v3/algorithm/result_types.hpp>
@@ -28,8 +33,11 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/thread_pool.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -87,6 +95,90 @@ namespace ranges
     template<typename I, typename O>
     using partial_sum_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O, typename BOp, typename P>
+        partial_sum_result<I, O> partial_sum_(I first, S last, O result, BOp & bop,
+                                              P & proj, std::false_type)
+        {
+            using X = projected<projected<I, detail::as_value_type_t<I>>, P>;
+            coerce<iter_value_t<I>> val_i;
+            coerce<iter_value_t<X>> val_x;
+            if(first != last)
+            {
+                auto && cur1 = val_i(*first);
+                iter_value_t<X> t(invoke(proj, cur1));
+                *result = t;
+                for(++first, ++result; first != last; ++first, ++result)
+                {
+                    auto && cur2 = val_i(*first);
+                    t = val_x(invoke(bop, t, invoke(proj, cur2)));
+                    *result = t;
+                }
+            }
+            return {first, result};
+        }
+
+        // A parallel inclusive scan: the first pass reduces every chunk but the
+        // last, the chunk totals are then scanned sequentially, and a second
+        // pass scans every chunk starting from the total of the preceding ones.
+        template<typename I, typename S, typename O, typename BOp, typename P>
+        partial_sum_result<I, O> partial_sum_(I first, S last, O result, BOp & bop,
+                                              P & proj, std::true_type)
+        {
+            using D = iter_difference_t<I>;
+            using X = projected<projected<I, detail::as_value_type_t<I>>, P>;
+            using V = iter_value_t<X>;
+            D const n = last - first;
+            std::size_t const chunks =
+                detail::parallel_chunk_count(n, D(detail::parallel_grain()));
+            if(chunks < 2)
+                return detail::partial_sum_(
+                    first, last, std::move(result), bop, proj, std::false_type{});
+
+            coerce<iter_value_t<I>> val_i;
+            coerce<V> val_x;
+            auto scan = [&](D lo, D hi, V t, O * out) {
+                I it = first + lo;
+                for(D k = lo; k != hi; ++k, ++it)
+                {
+                    auto && cur = val_i(*it);
+                    t = val_x(invoke(bop, t, invoke(proj, cur)));
+                    if(out)
+                        *(*out + static_cast<iter_difference_t<O>>(k)) = t;
+                }
+                return t;
+            };
+
+            std::vector<optional<V>> totals(chunks);
+            detail::parallel_for(chunks - 1, [&](std::size_t i) {
+                D const lo = detail::parallel_chunk_begin(n, chunks, i);
+                D const hi = detail::parallel_chunk_begin(n, chunks, i + 1);
+                auto && cur = val_i(*(first + lo));
+                totals[i].emplace(scan(lo + 1, hi, V(invoke(proj, cur)), nullptr));
+            });
+            for(std::size_t i = 1; i < chunks - 1; ++i)
+                totals[i].emplace(val_x(invoke(bop, *totals[i - 1], *totals[i])));
+
+            detail::parallel_for(chunks, [&](std::size_t i) {
+                D const lo = detail::parallel_chunk_begin(n, chunks, i);
+                D const hi = detail::parallel_chunk_begin(n, chunks, i + 1);
+                if(i == 0)
+                {
+                    auto && cur = val_i(*first);
+                    V t(invoke(proj, cur));
+                    *result = t;
+                    scan(1, hi, std::move(t), &result);
+                }
+                else
+                    scan(lo, hi, *totals[i - 1], &result);
+            });
+            return {first + n, result + static_cast<iter_difference_t<O>>(n)};
+        }
+    } // namespace detail
+    /// \endcond
+
     struct partial_sum_fn
     {
         template(typename I, typename S1, typename O, typename S2, typename BOp = plus,
@@ -163,6 +255,47 @@ namespace ranges
                            std::move(bop),
                            std::move(proj));
         }
+
+        /// \overload
+        /// Computes the inclusive scan in the manner requested by the execution
+        /// policy. A parallel scan regroups the applications of \c bop, so work is
+        /// split across threads only when \c bop is known to be associative, like
+        /// \c plus, and both the input and the output are random-access.
+        template(typename E, typename I, typename S, typename O, typename BOp = plus,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<E> AND sentinel_for<S, I> AND
+                partial_sum_constraints<I, O, BOp, P>)
+        partial_sum_result<I, O> //
+        operator()(E &&, I first, S last, O result, BOp bop = BOp{}, P proj = P{}) const
+        {
+            return detail::partial_sum_(
+                std::move(first),
+                std::move(last),
+                std::move(result),
+                bop,
+                proj,
+                meta::bool_<detail::parallelizable<E, I, S>::value &&
+                            detail::associative_op_<BOp>::value &&
+                            random_access_iterator<O>>{});
+        }
+
+        /// \overload
+        template(typename E, typename Rng, typename O, typename BOp = plus,
+                 typename P = identity, typename I = iterator_t<Rng>)(
+            /// \pre
+            requires execution_policy<E> AND range<Rng> AND
+                partial_sum_constraints<I, O, BOp, P>)
+        partial_sum_result<borrowed_iterator_t<Rng>, O> //
+        operator()(E && policy, Rng && rng, O result, BOp bop = BOp{}, P proj = P{}) const
+        {
+            return (*this)(static_cast<E &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(result),
+                           std::move(bop),
+                           std::move(proj));
+        }
     };
 
     RANGES_INLINE_VARIABLE(partial_sum_fn, partial_sum)
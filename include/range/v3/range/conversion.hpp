@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_RANGE_CONVERSION_HPP
 #define RANGES_V3_RANGE_CONVERSION_HPP
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include <meta/meta.hpp>
@@ -24,9 +26,12 @@
 #include <range/v3/functional/pipeable.hpp>
 #include <range/v3/iterator/common_iterator.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/batched_read.hpp>
+#include <range/v3/detail/for_each_while.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -42,6 +47,13 @@ namespace ranges
             template<typename MetaFn, typename Fn>
             struct closure;
 
+            template<typename MetaFn, typename Alloc>
+            struct alloc_fn;
+
+            // Stands for the allocator of a conversion that was not given one.
+            struct no_alloc
+            {};
+
             template<typename MetaFn, typename Rng>
             using container_t = meta::invoke<MetaFn, Rng>;
 
@@ -252,11 +264,84 @@ namespace ranges
             move_constructible<Cont> && //
             CPP_concept_ref(detail::convertible_to_cont_cont_impl_, Rng, Cont);
 
-        template<typename C, typename I, typename R>
+        template(typename Rng, typename Cont, typename Alloc)(
+        concept (convertible_to_cont_with_alloc_)(Rng, Cont, Alloc),
+            constructible_from<range_value_t<Cont>, range_reference_t<Rng>> AND
+            constructible_from<Cont, Alloc const &> AND
+            constructible_from<
+                Cont,
+                range_cpp17_iterator_t<Rng>,
+                range_cpp17_iterator_t<Rng>,
+                Alloc const &>
+        );
+        // A container of the elements of Rng made with an Alloc.
+        template<typename Rng, typename Cont, typename Alloc>
+        CPP_concept convertible_to_cont_with_alloc = //
+            range_and_not_view<Cont> && //
+            move_constructible<Cont> && //
+            CPP_concept_ref(detail::convertible_to_cont_with_alloc_, Rng, Cont, Alloc);
+
+        template(typename Rng, typename Cont, typename Alloc)(
+        concept (convertible_to_cont_cont_with_alloc_)(Rng, Cont, Alloc),
+            range_and_not_view<range_value_t<Cont>> AND
+            constructible_from<Cont, Alloc const &> AND
+            (invocable<
+                to_container::fn<meta::id<range_value_t<Cont>>>,
+                range_reference_t<Rng>,
+                Alloc const &> ||
+             invocable<
+                to_container::fn<meta::id<range_value_t<Cont>>>,
+                range_reference_t<Rng>>)
+        );
+        // A container of containers, made from the ranges of Rng, with an Alloc.
+        template<typename Rng, typename Cont, typename Alloc>
+        CPP_concept convertible_to_cont_cont_with_alloc = //
+            range_and_not_view<Cont> && //
+            move_constructible<Cont> && //
+            (!convertible_to_cont_with_alloc<Rng, Cont, Alloc>) && //
+            CPP_concept_ref(
+                detail::convertible_to_cont_cont_with_alloc_, Rng, Cont, Alloc);
+
+        // A container made with an allocator need not be default constructible
+        // to reserve room.
+        template<typename C, typename Alloc>
+        CPP_concept to_container_reservable = //
+            reservable<C> || //
+            (!same_as<Alloc, to_container::no_alloc> && sized_range<C> && //
+             CPP_requires_ref(ranges::reservable_, C));
+
+        template<typename C, typename I, typename R,
+                 typename Alloc = to_container::no_alloc>
         CPP_concept to_container_reserve = //
-            reservable_with_assign<C, I> && //
+            to_container_reservable<C, Alloc> && //
+            input_iterator<I> && //
+            CPP_requires_ref(ranges::reservable_with_assign_, C, I) && //
             sized_range<R>;
 
+        template<typename C, typename Ref>
+        CPP_requires(to_container_push_back_,
+            requires(C & c, Ref && ref) //
+            (
+                c.push_back(static_cast<Ref &&>(ref))
+            ));
+        // Ranges whose elements are read a batch at a time, or that walk
+        // themselves, are appended to the container instead of handed to its
+        // constructor as iterators.
+        template<typename C, typename R>
+        CPP_concept to_container_batched = //
+            (batched_reader<iterator_t<R>, sentinel_t<R>>::value ||
+             internally_iterable_t<iterator_t<R>, sentinel_t<R>>::value) && //
+            CPP_requires_ref(detail::to_container_push_back_, C, range_reference_t<R>);
+        // Ranges that do not know their size but can bound it are appended to a
+        // container in one pass, with room reserved for as many elements as
+        // they are sure to have.
+        template<typename C, typename R, typename Alloc = to_container::no_alloc>
+        CPP_concept to_container_hinted = //
+            (!sized_range<R>) && //
+            to_container_reservable<C, Alloc> && //
+            size_hinted_<R> && //
+            CPP_requires_ref(detail::to_container_push_back_, C, range_reference_t<R>);
+
         template<typename MetaFn, typename Rng>
         using container_t = meta::invoke<MetaFn, Rng>;
         // clang-format on
@@ -285,6 +370,20 @@ namespace ranges
                 return static_cast<Fn &&>(fn)(static_cast<Rng &&>(rng));
             }
 
+            // Closures with an allocator convert to containers that need not
+            // be constructible without one.
+            template(typename Rng, typename MetaFn, typename Fn)(
+                /// \pre
+                requires input_range<Rng> AND
+                    (!convertible_to_cont<Rng, container_t<MetaFn, Rng>>) AND
+                    (!convertible_to_cont_cont<Rng, container_t<MetaFn, Rng>>) AND
+                    invocable<Fn, Rng>)
+            friend constexpr auto
+            operator|(Rng && rng, to_container::closure<MetaFn, Fn> fn)
+            {
+                return static_cast<Fn &&>(fn)(static_cast<Rng &&>(rng));
+            }
+
             template<typename MetaFn, typename Fn, typename Pipeable>
             friend constexpr auto operator|(to_container::closure<MetaFn, Fn> sh,
                                             Pipeable pipe)
@@ -313,23 +412,129 @@ namespace ranges
         struct to_container::fn
         {
         private:
-            template<typename Cont, typename I, typename Rng>
-            static Cont impl(Rng && rng, std::false_type)
+            struct hinted_tag
+            {};
+
+            template<typename Cont>
+            static Cont make(no_alloc)
             {
-                return Cont(I{ranges::begin(rng)}, I{ranges::end(rng)});
+                return Cont();
             }
-            template<typename Cont, typename I, typename Rng>
-            static auto impl(Rng && rng, std::true_type)
+            template<typename Cont, typename Alloc>
+            static Cont make(Alloc const & alloc)
+            {
+                return Cont(alloc);
+            }
+            template<typename Cont, typename I>
+            static Cont make(I first, I last, no_alloc)
+            {
+                return Cont(std::move(first), std::move(last));
+            }
+            template<typename Cont, typename I, typename Alloc>
+            static Cont make(I first, I last, Alloc const & alloc)
+            {
+                return Cont(std::move(first), std::move(last), alloc);
+            }
+
+            template<typename Cont, typename Rng>
+            static void reserve(Cont &, Rng &, std::false_type)
+            {}
+            template<typename Cont, typename Rng>
+            static void reserve(Cont & c, Rng & rng, hinted_tag)
+            {
+                auto const n = detail::size_hint_reserve_(ranges::size_hint(rng));
+                using size_type = decltype(c.max_size());
+                c.reserve(static_cast<size_type>(
+                    n < static_cast<std::size_t>(c.max_size()) ? n : c.max_size()));
+            }
+            template<typename Cont, typename Rng>
+            static void reserve(Cont & c, Rng & rng, std::true_type)
             {
-                Cont c;
                 auto const rng_size = ranges::size(rng);
                 using size_type = decltype(c.max_size());
                 using C = common_type_t<range_size_t<Rng>, size_type>;
                 RANGES_EXPECT(static_cast<C>(rng_size) <= static_cast<C>(c.max_size()));
                 c.reserve(static_cast<size_type>(rng_size));
+            }
+
+            template<typename Cont, typename I, typename Rng, typename Alloc>
+            static Cont impl(Rng && rng, Alloc const & alloc, std::false_type)
+            {
+                return fn::make<Cont>(I{ranges::begin(rng)}, I{ranges::end(rng)}, alloc);
+            }
+            template<typename Cont, typename I, typename Rng, typename Alloc>
+            static Cont impl(Rng && rng, Alloc const & alloc, std::true_type)
+            {
+                Cont c = fn::make<Cont>(alloc);
+                fn::reserve(c, rng, std::true_type{});
                 c.assign(I{ranges::begin(rng)}, I{ranges::end(rng)});
                 return c;
             }
+            template<typename Cont, typename I, typename Rng, typename Alloc,
+                     typename Reserve>
+            static Cont impl(Rng && rng, Alloc const & alloc, Reserve, std::false_type)
+            {
+                return impl<Cont, I>(static_cast<Rng &&>(rng), alloc, Reserve{});
+            }
+            template<typename Cont, typename Rng>
+            static void append(Cont & c, Rng & rng, std::true_type)
+            {
+                using R = range_reference_t<Rng>;
+                auto push_back = [&c](R && ref) { c.push_back(static_cast<R &&>(ref)); };
+                detail::batched_for_each(ranges::begin(rng), ranges::end(rng), push_back);
+            }
+            template<typename Cont, typename Rng>
+            static void append(Cont & c, Rng & rng, std::false_type)
+            {
+                using R = range_reference_t<Rng>;
+                // The segments of a sequence may have references of their own.
+                auto push_back = [&c](auto && ref) {
+                    c.push_back(static_cast<R>(static_cast<decltype(ref)>(ref)));
+                    return true;
+                };
+                detail::for_each_while_(ranges::begin(rng), ranges::end(rng), push_back);
+            }
+            template<typename Cont, typename I, typename Rng, typename Alloc,
+                     typename Reserve>
+            static Cont impl(Rng && rng, Alloc const & alloc, Reserve, std::true_type)
+            {
+                Cont c = fn::make<Cont>(alloc);
+                fn::reserve(c, rng, Reserve{});
+                using batched_t =
+                    meta::bool_<batched_reader<iterator_t<Rng>, sentinel_t<Rng>>::value>;
+                fn::append(c, rng, batched_t{});
+                return c;
+            }
+
+            template<typename Rng, typename Alloc>
+            static container_t<MetaFn, Rng> convert(Rng && rng, Alloc const & alloc)
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using cont_t = container_t<MetaFn, Rng>;
+                using iter_t = range_cpp17_iterator_t<Rng>;
+                using use_hint_t =
+                    meta::bool_<(bool)to_container_hinted<cont_t, Rng, Alloc>>;
+                using use_reserve_t = meta::if_<
+                    use_hint_t, hinted_tag,
+                    meta::bool_<(bool)to_container_reserve<cont_t, iter_t, Rng, Alloc>>>;
+                using use_batch_t =
+                    meta::bool_<use_hint_t::value ||
+                                (bool)to_container_batched<cont_t, Rng>>;
+                return impl<cont_t, iter_t>(
+                    static_cast<Rng &&>(rng), alloc, use_reserve_t{}, use_batch_t{});
+            }
+
+            template<typename Inner, typename Ref, typename Alloc>
+            static Inner convert_inner(Ref && ref, Alloc const & alloc, std::true_type)
+            {
+                return fn<meta::id<Inner>>{}(static_cast<Ref &&>(ref), alloc);
+            }
+            template<typename Inner, typename Ref, typename Alloc>
+            static Inner convert_inner(Ref && ref, Alloc const &, std::false_type)
+            {
+                return fn<meta::id<Inner>>{}(static_cast<Ref &&>(ref));
+            }
 
         public:
             template(typename Rng)(
@@ -338,13 +543,7 @@ namespace ranges
                     convertible_to_cont<Rng, container_t<MetaFn, Rng>>)
             container_t<MetaFn, Rng> operator()(Rng && rng) const
             {
-                static_assert(!is_infinite<Rng>::value,
-                              "Attempt to convert an infinite range to a container.");
-                using cont_t = container_t<MetaFn, Rng>;
-                using iter_t = range_cpp17_iterator_t<Rng>;
-                using use_reserve_t =
-                    meta::bool_<(bool)to_container_reserve<cont_t, iter_t, Rng>>;
-                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), use_reserve_t{});
+                return fn::convert(static_cast<Rng &&>(rng), no_alloc{});
             }
             template(typename Rng)(
                 /// \pre
@@ -359,7 +558,57 @@ namespace ranges
                 using iter_t = to_container_iterator<Rng, cont_t>;
                 using use_reserve_t =
                     meta::bool_<(bool)to_container_reserve<cont_t, iter_t, Rng>>;
-                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), use_reserve_t{});
+                return impl<cont_t, iter_t>(
+                    static_cast<Rng &&>(rng), no_alloc{}, use_reserve_t{});
+            }
+
+            template(typename Rng, typename Alloc)(
+                /// \pre
+                requires input_range<Rng> AND
+                    convertible_to_cont_with_alloc<Rng, container_t<MetaFn, Rng>, Alloc>)
+            container_t<MetaFn, Rng> operator()(Rng && rng, Alloc const & alloc) const
+            {
+                return fn::convert(static_cast<Rng &&>(rng), alloc);
+            }
+            // The inner containers are made with the allocator too, if they use
+            // one it converts to, so that a memory resource reaches every level.
+            template(typename Rng, typename Alloc)(
+                /// \pre
+                requires input_range<Rng> AND
+                    convertible_to_cont_cont_with_alloc<Rng, container_t<MetaFn, Rng>,
+                                                        Alloc>)
+            container_t<MetaFn, Rng> operator()(Rng && rng, Alloc const & alloc) const
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using cont_t = container_t<MetaFn, Rng>;
+                using inner_t = range_value_t<cont_t>;
+                using use_alloc_t =
+                    meta::bool_<std::uses_allocator<inner_t, Alloc>::value>;
+                using use_reserve_t = meta::bool_<
+                    to_container_reservable<cont_t, Alloc> && sized_range<Rng>>;
+                cont_t c = fn::make<cont_t>(alloc);
+                fn::reserve(c, rng, use_reserve_t{});
+                auto first = ranges::begin(rng);
+                auto const last = ranges::end(rng);
+                for(; first != last; ++first)
+                    c.insert(ranges::end(c),
+                             fn::convert_inner<inner_t>(*first, alloc, use_alloc_t{}));
+                return c;
+            }
+        };
+
+        template<typename MetaFn, typename Alloc>
+        struct to_container::alloc_fn
+        {
+            Alloc alloc_;
+
+            template(typename Rng)(
+                /// \pre
+                requires invocable<fn<MetaFn> const &, Rng, Alloc const &>)
+            container_t<MetaFn, Rng> operator()(Rng && rng) const
+            {
+                return fn<MetaFn>{}(static_cast<Rng &&>(rng), alloc_);
             }
         };
 
@@ -454,6 +703,59 @@ namespace ranges
             return detail::to_container_fn<meta::id<Cont>>{}(static_cast<Rng &&>(rng));
         }
 
+        /// \brief For initializing a container of the specified type with the
+        /// elements of a range, and an allocator that the container, and any
+        /// containers in it that use an allocator it converts to, are made with.
+        /// The allocator can be a `std::pmr::memory_resource *` for a
+        /// `std::pmr` container.
+        template(template<typename...> class ContT, typename Alloc)(
+            /// \pre
+            requires (!range<Alloc>))
+        auto to(Alloc const & alloc)
+            -> detail::to_container_closure<
+                detail::from_range<ContT>,
+                detail::to_container::alloc_fn<detail::from_range<ContT>, Alloc>>
+        {
+            using meta_fn_t = detail::from_range<ContT>;
+            using fn_t = detail::to_container::alloc_fn<meta_fn_t, Alloc>;
+            return detail::to_container_closure<meta_fn_t, fn_t>{fn_t{alloc}};
+        }
+
+        /// \overload
+        template(template<typename...> class ContT, typename Rng, typename Alloc)(
+            /// \pre
+            requires range<Rng> AND
+                invocable<detail::to_container::fn<detail::from_range<ContT>>, Rng,
+                          Alloc const &>)
+        auto to(Rng && rng, Alloc const & alloc) -> ContT<range_value_t<Rng>>
+        {
+            return detail::to_container::fn<detail::from_range<ContT>>{}(
+                static_cast<Rng &&>(rng), alloc);
+        }
+
+        /// \overload
+        template(typename Cont, typename Alloc)(
+            /// \pre
+            requires (!range<Alloc>))
+        auto to(Alloc const & alloc)
+            -> detail::to_container_closure<
+                meta::id<Cont>, detail::to_container::alloc_fn<meta::id<Cont>, Alloc>>
+        {
+            using fn_t = detail::to_container::alloc_fn<meta::id<Cont>, Alloc>;
+            return detail::to_container_closure<meta::id<Cont>, fn_t>{fn_t{alloc}};
+        }
+
+        /// \overload
+        template(typename Cont, typename Rng, typename Alloc)(
+            /// \pre
+            requires range<Rng> AND
+                invocable<detail::to_container::fn<meta::id<Cont>>, Rng, Alloc const &>)
+        auto to(Rng && rng, Alloc const & alloc) -> Cont
+        {
+            return detail::to_container::fn<meta::id<Cont>>{}(static_cast<Rng &&>(rng),
+                                                              alloc);
+        }
+
         /// \cond
         // Slightly odd initializer_list overloads, undocumented for now.
         template(template<typename...> class ContT, typename T)(
@@ -0,0 +1,189 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_RANGE_SIZE_HINT_HPP
+#define RANGES_V3_RANGE_SIZE_HINT_HPP
+
+#include <cstddef>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-range
+    /// @{
+
+    /// What `ranges::size_hint` knows of the size of a range: that it has at
+    /// least `lower` elements and, unless `upper` is `std::size_t(-1)`, at most
+    /// `upper`.
+    struct size_hint_t
+    {
+        std::size_t lower = 0;
+        std::size_t upper = static_cast<std::size_t>(-1);
+
+        constexpr bool bounded() const noexcept
+        {
+            return upper != static_cast<std::size_t>(-1);
+        }
+        constexpr bool exact() const noexcept
+        {
+            return bounded() && lower == upper;
+        }
+    };
+    /// @}
+
+    /// \cond
+    namespace detail
+    {
+        // The hint of the first n elements of a range with the hint h.
+        constexpr size_hint_t size_hint_take_(size_hint_t h, std::size_t n) noexcept
+        {
+            return {h.lower < n ? h.lower : n, h.upper < n ? h.upper : n};
+        }
+        // The hint of a range that has at most the elements of one with the
+        // hint h, like a filter of it.
+        constexpr size_hint_t size_hint_at_most_(size_hint_t h) noexcept
+        {
+            return {0, h.upper};
+        }
+    } // namespace detail
+
+    namespace _size_hint_
+    {
+        template<typename T>
+        void size_hint(T &&) = delete;
+
+        // clang-format off
+        template<typename T>
+        CPP_requires(has_member_size_hint_,
+            requires(T && t) //
+            (
+                size_hint_t{((T &&) t).size_hint()}
+            ));
+        template<typename T>
+        CPP_concept has_member_size_hint =
+            CPP_requires_ref(_size_hint_::has_member_size_hint_, T);
+
+        template<typename T>
+        CPP_requires(has_non_member_size_hint_,
+            requires(T && t) //
+            (
+                size_hint_t{size_hint((T &&) t)}
+            ));
+        template<typename T>
+        CPP_concept has_non_member_size_hint =
+            CPP_requires_ref(_size_hint_::has_non_member_size_hint_, T);
+        // clang-format on
+
+        struct fn
+        {
+            template(typename R)(
+                /// \pre
+                requires sized_range<R>)
+            constexpr size_hint_t operator()(R && r) const
+            {
+                auto const n = static_cast<std::size_t>(ranges::size(r));
+                return {n, n};
+            }
+
+            template(typename R)(
+                /// \pre
+                requires (!sized_range<R>) AND has_member_size_hint<R>)
+            constexpr size_hint_t operator()(R && r) const
+            {
+                return ((R &&) r).size_hint();
+            }
+
+            template(typename R)(
+                /// \pre
+                requires (!sized_range<R>) AND (!has_member_size_hint<R>) AND
+                    has_non_member_size_hint<R>)
+            constexpr size_hint_t operator()(R && r) const
+            {
+                return size_hint((R &&) r);
+            }
+        };
+    } // namespace _size_hint_
+    /// \endcond
+
+    /// \ingroup group-range
+    /// \return For a given expression `E` of type `T`, `ranges::size_hint(E)` is
+    /// the `size_hint_t` of:
+    ///   * `{ranges::size(E), ranges::size(E)}` if `T` models `sized_range`.
+    ///   * Otherwise, `E.size_hint()` if it is a valid expression.
+    ///   * Otherwise, `size_hint(E)` if it is a valid expression with overload
+    ///     resolution performed in a context that includes the declaration:
+    ///     \code
+    ///     template<class T> void size_hint(T&&) = delete;
+    ///     \endcode
+    ///   * Otherwise, `ranges::size_hint(E)` is ill-formed.
+    ///
+    /// The views that cannot know their size, like `views::filter`, give what
+    /// bounds they can, so that `ranges::to` and the actions that append ranges
+    /// to containers can reserve room for the elements before copying them.
+    RANGES_DEFINE_CPO(_size_hint_::fn, size_hint)
+
+    /// \cond
+    namespace detail
+    {
+        // clang-format off
+        template<typename R>
+        CPP_concept size_hinted_ = invocable<_size_hint_::fn const &, R &>;
+        // clang-format on
+
+        template(typename R)(
+            /// \pre
+            requires size_hinted_<R>)
+        constexpr size_hint_t size_hint_or_none_(R & r)
+        {
+            return ranges::size_hint(r);
+        }
+        template(typename R)(
+            /// \pre
+            requires (!size_hinted_<R>) AND is_infinite<R>::value)
+        constexpr size_hint_t size_hint_or_none_(R &)
+        {
+            return {static_cast<std::size_t>(-1), static_cast<std::size_t>(-1)};
+        }
+        template(typename R)(
+            /// \pre
+            requires (!size_hinted_<R>) AND (!is_infinite<R>::value))
+        constexpr size_hint_t size_hint_or_none_(R &)
+        {
+            return {};
+        }
+
+        // How many elements to reserve room for from a hint: the lower bound.
+        // An upper bound only says "at most": views::take(n) over an istream
+        // or a filter that keeps few elements has one far above the count of
+        // its elements, and reserving it would allocate for nothing.
+        constexpr std::size_t size_hint_reserve_(size_hint_t h) noexcept
+        {
+            return h.lower;
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
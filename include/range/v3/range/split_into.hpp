@@ -0,0 +1,119 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_RANGE_SPLIT_INTO_HPP
+#define RANGES_V3_RANGE_SPLIT_INTO_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/subrange.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace _split_into_
+    {
+        // clang-format off
+        template<typename T>
+        CPP_requires(has_member_split_into_,
+            requires(T & t) //
+            (
+                t.split_into(std::size_t{1})
+            ));
+        template<typename T>
+        CPP_concept has_member_split_into =
+            CPP_requires_ref(_split_into_::has_member_split_into_, T);
+        // clang-format on
+
+        struct fn
+        {
+            // Views that cannot jump to an element in constant time, but can find
+            // where the pieces start faster than by walking them, say how.
+            template(typename R)(
+                /// \pre
+                requires borrowed_range<R> AND has_member_split_into<R>)
+            auto operator()(R && rng, std::size_t n) const //
+                -> decltype(rng.split_into(n))
+            {
+                return rng.split_into(n);
+            }
+
+            template(typename R)(
+                /// \pre
+                requires borrowed_range<R> AND (!has_member_split_into<R>) AND
+                    random_access_range<R> AND sized_range<R>)
+            std::vector<subrange<iterator_t<R>>> operator()(R && rng,
+                                                            std::size_t n) const
+            {
+                RANGES_EXPECT(0 < n);
+                using D = range_difference_t<R>;
+                auto const count = static_cast<D>(n);
+                auto const size = static_cast<D>(ranges::size(rng));
+                auto const q = size / count, r = size % count;
+                std::vector<subrange<iterator_t<R>>> parts;
+                parts.reserve(n);
+                auto first = ranges::begin(rng);
+                for(D i = 0; i < count; ++i)
+                {
+                    auto last = first + (i < r ? q + 1 : q);
+                    parts.emplace_back(first, last);
+                    first = last;
+                }
+                return parts;
+            }
+        };
+    } // namespace _split_into_
+    /// \endcond
+
+    /// \ingroup group-range
+    /// Divides a range into \c n subranges whose sizes differ by at most one, in
+    /// order, which may be walked independently of each other (for instance, on
+    /// different threads). Random-access sized ranges are split by iterator
+    /// arithmetic; other views provide a member \c split_into(n), as \c join_view
+    /// over sized inner ranges does.
+    /// \pre `0 < n`
+    RANGES_DEFINE_CPO(_split_into_::fn, split_into)
+
+    /// \addtogroup group-range
+    /// @{
+
+    // clang-format off
+    template<typename T>
+    CPP_requires(splittable_range_,
+        requires(T && t) //
+        (
+            ranges::split_into((T &&) t, std::size_t{1})
+        ));
+    /// A range that \c split_into can divide into independent pieces.
+    template<typename T>
+    CPP_concept splittable_range =
+        range<T> && CPP_requires_ref(ranges::splittable_range_, T);
+    // clang-format on
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
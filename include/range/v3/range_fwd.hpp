@@ -297,6 +297,18 @@ namespace ranges
         struct priority_tag<0>
         {};
 
+        /// Returns `true` when called during constant evaluation, or when there is
+        /// no way to tell. Used to keep non-`constexpr` fast paths out of constant
+        /// expressions.
+        constexpr bool is_constant_evaluated() noexcept
+        {
+#ifdef RANGES_IS_CONSTANT_EVALUATED
+            return RANGES_IS_CONSTANT_EVALUATED();
+#else
+            return true;
+#endif
+        }
+
 #if defined(__clang__) && !defined(_LIBCPP_VERSION)
         template<typename T, typename... Args>
         RANGES_INLINE_VAR constexpr bool is_trivially_constructible_v =
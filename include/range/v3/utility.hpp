@@ -20,6 +20,7 @@
 #include <range/v3/utility/common_type.hpp>
 #include <range/v3/utility/compressed_pair.hpp>
 #include <range/v3/utility/copy.hpp>
+#include <range/v3/utility/eytzinger_index.hpp>
 #include <range/v3/utility/get.hpp>
 #include <range/v3/utility/in_place.hpp>
 #include <range/v3/utility/memory.hpp>
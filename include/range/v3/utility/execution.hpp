@@ -0,0 +1,137 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_EXECUTION_HPP
+#define RANGES_V3_UTILITY_EXECUTION_HPP
+
+#include <functional>
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/arithmetic.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+    namespace execution
+    {
+        /// Requests that an algorithm run sequentially on the calling thread.
+        struct sequenced_policy
+        {};
+
+        /// Permits an algorithm to split its work across the threads of the
+        /// library's thread pool. Element access functions must not race.
+        struct parallel_policy
+        {};
+
+        /// Like \c parallel_policy, and additionally permits the calls made by one
+        /// thread to be interleaved.
+        struct parallel_unsequenced_policy
+        {};
+
+        RANGES_INLINE_VARIABLE(sequenced_policy, seq)
+        RANGES_INLINE_VARIABLE(parallel_policy, par)
+        RANGES_INLINE_VARIABLE(parallel_unsequenced_policy, par_unseq)
+    } // namespace execution
+
+    template<typename T>
+    struct is_execution_policy : std::false_type
+    {};
+
+    template<>
+    struct is_execution_policy<execution::sequenced_policy> : std::true_type
+    {};
+
+    template<>
+    struct is_execution_policy<execution::parallel_policy> : std::true_type
+    {};
+
+    template<>
+    struct is_execution_policy<execution::parallel_unsequenced_policy> : std::true_type
+    {};
+
+    // clang-format off
+    /// \concept execution_policy
+    /// The \c execution_policy concept
+    template<typename T>
+    CPP_concept execution_policy = is_execution_policy<uncvref_t<T>>::value;
+    // clang-format on
+
+    /// \cond
+    namespace detail
+    {
+        /// Whether an algorithm called with policy `E` over `[I, S)` runs on the
+        /// thread pool. Only random-access sequences with a known size are split;
+        /// everything else runs sequentially.
+        template<typename E, typename I, typename S>
+        using parallelizable =
+            meta::bool_<!RANGES_IS_SAME(uncvref_t<E>, execution::sequenced_policy) &&
+                        random_access_iterator<I> && sized_sentinel_for<S, I>>;
+
+        // The operations that are known to be associative, and to combine two
+        // partial results the way they combine a result and an element. Only
+        // these may be regrouped by a parallel fold or scan: any other may be
+        // like `minus`, or treat its operands differently, as in
+        // `[](long long a, int i) { return a + i * i; }`.
+        template<typename Op>
+        struct associative_op_ : std::false_type
+        {};
+        template<>
+        struct associative_op_<plus> : std::true_type
+        {};
+        template<>
+        struct associative_op_<multiplies> : std::true_type
+        {};
+        template<>
+        struct associative_op_<bitwise_or> : std::true_type
+        {};
+        template<typename T>
+        struct associative_op_<std::plus<T>> : std::true_type
+        {};
+        template<typename T>
+        struct associative_op_<std::multiplies<T>> : std::true_type
+        {};
+        template<typename T>
+        struct associative_op_<std::bit_and<T>> : std::true_type
+        {};
+        template<typename T>
+        struct associative_op_<std::bit_or<T>> : std::true_type
+        {};
+        template<typename T>
+        struct associative_op_<std::bit_xor<T>> : std::true_type
+        {};
+
+        /// The number of elements below which a parallel algorithm does not bother
+        /// splitting its work.
+        constexpr std::ptrdiff_t parallel_grain()
+        {
+            return 1 << 12;
+        }
+    } // namespace detail
+    /// \endcond
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
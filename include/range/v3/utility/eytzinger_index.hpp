@@ -0,0 +1,327 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_EYTZINGER_INDEX_HPP
+#define RANGES_V3_UTILITY_EYTZINGER_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/basic_iterator.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/view/subrange.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // The slots of an Eytzinger layout are numbered from 1 in breadth-first
+        // order: the children of slot `k` are `2k` and `2k + 1`. These walk the
+        // implicit tree of `n` slots in order; slot 0 is past the end.
+        inline std::size_t eytzinger_first_(std::size_t n) noexcept
+        {
+            if(n == 0)
+                return 0;
+            std::size_t k = 1;
+            while(2 * k <= n)
+                k *= 2;
+            return k;
+        }
+        inline std::size_t eytzinger_last_(std::size_t n) noexcept
+        {
+            std::size_t k = n == 0 ? 0 : 1;
+            while(2 * k + 1 <= n)
+                k = 2 * k + 1;
+            return k;
+        }
+        inline std::size_t eytzinger_next_(std::size_t k, std::size_t n) noexcept
+        {
+            if(2 * k + 1 <= n)
+            {
+                k = 2 * k + 1;
+                while(2 * k <= n)
+                    k *= 2;
+                return k;
+            }
+            // Climb past the right turns, and then once more.
+            while(k & 1u)
+                k >>= 1;
+            return k >> 1;
+        }
+        inline std::size_t eytzinger_prev_(std::size_t k, std::size_t n) noexcept
+        {
+            if(k == 0)
+                return detail::eytzinger_last_(n);
+            if(2 * k <= n)
+            {
+                k = 2 * k;
+                while(2 * k + 1 <= n)
+                    k = 2 * k + 1;
+                return k;
+            }
+            while(k != 0 && !(k & 1u))
+                k >>= 1;
+            return k >> 1;
+        }
+
+        // How many elements of type T fill a cache line, rounded down to a power
+        // of two. The descendants of slot `k` that are that many levels down sit
+        // side by side, starting at slot `k * eytzinger_block_<T>()`.
+        template<typename T>
+        constexpr std::size_t eytzinger_block_() noexcept
+        {
+            std::size_t b = 1;
+            while(b * 2 * sizeof(T) <= 64)
+                b *= 2;
+            return b;
+        }
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-utility
+    /// @{
+
+    /// An immutable copy of a sorted sequence, laid out for fast repeated
+    /// searches. The elements are stored in breadth-first ("Eytzinger") order
+    /// of the implicit balanced search tree over them, so the first levels of
+    /// every search share a few cache lines and the search can prefetch the
+    /// levels it will visit next. The searches take the comparison and
+    /// projection of `ranges::lower_bound` and have no data-dependent branches.
+    ///
+    /// An `eytzinger_index` is a bidirectional range that visits its elements
+    /// in sorted order, so `ranges::to` gets the sorted sequence back. It can
+    /// itself be made with `ranges::to<eytzinger_index>()`.
+    template<typename T, typename Alloc = std::allocator<T>>
+    struct eytzinger_index
+    {
+    private:
+        // Slot k lives at tree_[k - 1].
+        std::vector<T, Alloc> tree_;
+
+        struct cursor
+        {
+        private:
+            T const * tree_ = nullptr;
+            std::size_t n_ = 0;
+            std::size_t k_ = 0;
+
+        public:
+            cursor() = default;
+            cursor(T const * tree, std::size_t n, std::size_t k) noexcept
+              : tree_(tree)
+              , n_(n)
+              , k_(k)
+            {}
+            T const & read() const
+            {
+                RANGES_EXPECT(k_ != 0);
+                return tree_[k_ - 1];
+            }
+            void next()
+            {
+                k_ = detail::eytzinger_next_(k_, n_);
+            }
+            void prev()
+            {
+                k_ = detail::eytzinger_prev_(k_, n_);
+            }
+            bool equal(cursor const & that) const
+            {
+                return k_ == that.k_;
+            }
+        };
+
+        static std::vector<std::size_t> ranks_(std::size_t n)
+        {
+            // The rank in sorted order of each slot.
+            std::vector<std::size_t> ranks(n);
+            std::size_t k = detail::eytzinger_first_(n);
+            for(std::size_t r = 0; r < n; ++r, k = detail::eytzinger_next_(k, n))
+                ranks[k - 1] = r;
+            return ranks;
+        }
+        template<typename I, typename S>
+        void build_(I first, S last, std::true_type)
+        {
+            auto const n = static_cast<std::size_t>(last - first);
+            tree_.reserve(n);
+            for(std::size_t r : eytzinger_index::ranks_(n))
+                tree_.emplace_back(first[static_cast<iter_difference_t<I>>(r)]);
+        }
+        template<typename I, typename S>
+        void build_(I first, S last, std::false_type)
+        {
+            std::vector<T, Alloc> sorted(tree_.get_allocator());
+            for(; first != last; ++first)
+                sorted.emplace_back(*first);
+            tree_.reserve(sorted.size());
+            for(std::size_t r : eytzinger_index::ranks_(sorted.size()))
+                tree_.push_back(std::move(sorted[r]));
+        }
+
+        // The slot of the first element for which `right` is false, or 0. Each
+        // step goes to the right child if `right` holds and to the left one if
+        // not; the search ends below a leaf, and undoing the right turns and
+        // the last left turn leads back to the answer.
+        template<typename F>
+        std::size_t descend_(F right) const
+        {
+            constexpr std::size_t block = detail::eytzinger_block_<T>();
+            T const * const tree = tree_.data();
+            std::size_t const n = tree_.size();
+            std::size_t k = 1;
+            while(k <= n)
+            {
+                // The address is only a hint; it may be past the end.
+                std::uintptr_t const ahead = reinterpret_cast<std::uintptr_t>(tree) +
+                                             (k * block - 1) * sizeof(T);
+                RANGES_PREFETCH(reinterpret_cast<void const *>(ahead));
+                k = 2 * k + static_cast<std::size_t>(right(tree[k - 1]));
+            }
+            while(k & 1u)
+                k >>= 1;
+            return k >> 1;
+        }
+
+        basic_iterator<cursor> at_(std::size_t k) const noexcept
+        {
+            return basic_iterator<cursor>{cursor{tree_.data(), tree_.size(), k}};
+        }
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = basic_iterator<cursor>;
+        using const_iterator = iterator;
+
+        eytzinger_index() = default;
+        explicit eytzinger_index(Alloc const & alloc)
+          : tree_(alloc)
+        {}
+
+        /// \pre `[first, last)` is sorted.
+        template(typename I, typename S)(
+            /// \pre
+            requires input_iterator<I> AND sentinel_for<S, I> AND
+                constructible_from<T, iter_reference_t<I>>)
+        eytzinger_index(I first, S last, Alloc const & alloc = Alloc())
+          : tree_(alloc)
+        {
+            using random_access_t =
+                meta::bool_<random_access_iterator<I> && sized_sentinel_for<S, I>>;
+            build_(std::move(first), std::move(last), random_access_t{});
+        }
+
+        /// \pre `rng` is sorted.
+        template(typename Rng)(
+            /// \pre
+            requires input_range<Rng> AND
+                (!same_as<detail::decay_t<Rng>, eytzinger_index>) AND
+                constructible_from<T, range_reference_t<Rng>>)
+        explicit eytzinger_index(Rng && rng, Alloc const & alloc = Alloc())
+          : eytzinger_index(ranges::begin(rng), ranges::end(rng), alloc)
+        {}
+
+        iterator begin() const noexcept
+        {
+            return at_(detail::eytzinger_first_(tree_.size()));
+        }
+        iterator end() const noexcept
+        {
+            return at_(0);
+        }
+        size_type size() const noexcept
+        {
+            return tree_.size();
+        }
+        bool empty() const noexcept
+        {
+            return tree_.empty();
+        }
+        allocator_type get_allocator() const
+        {
+            return tree_.get_allocator();
+        }
+
+        /// The first element that is not less than `val`, like
+        /// `ranges::lower_bound`.
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        iterator lower_bound(V const & val, C pred = C{}, P proj = P{}) const
+        {
+            return at_(descend_([&](T const & t) -> bool {
+                return invoke(pred, invoke(proj, t), val);
+            }));
+        }
+
+        /// The first element that is greater than `val`, like
+        /// `ranges::upper_bound`.
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        iterator upper_bound(V const & val, C pred = C{}, P proj = P{}) const
+        {
+            return at_(descend_([&](T const & t) -> bool {
+                return !invoke(pred, val, invoke(proj, t));
+            }));
+        }
+
+        /// The elements equivalent to `val`, like `ranges::equal_range`.
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        subrange<iterator> equal_range(V const & val, C pred = C{}, P proj = P{}) const
+        {
+            return {lower_bound(val, pred, proj), upper_bound(val, pred, proj)};
+        }
+
+        /// Whether an element is equivalent to `val`, like
+        /// `ranges::binary_search`.
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        bool contains(V const & val, C pred = C{}, P proj = P{}) const
+        {
+            std::size_t const k = descend_([&](T const & t) -> bool {
+                return invoke(pred, invoke(proj, t), val);
+            });
+            return k != 0 && !invoke(pred, val, invoke(proj, tree_[k - 1]));
+        }
+    };
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
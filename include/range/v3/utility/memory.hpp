@@ -32,6 +32,7 @@
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/utility/polymorphic_cast.hpp>
+#include <range/v3/utility/swap.hpp>
 
 #include <range/v3/detail/prologue.hpp>
 
@@ -46,8 +47,10 @@ namespace ranges
             if(n > PTRDIFF_MAX / sizeof(T))
                 n = PTRDIFF_MAX / sizeof(T);
 
+            // Ask for less and less until the allocation succeeds, and report the
+            // size that was allocated.
             void * ptr = nullptr;
-            for(; ptr == nullptr && n > 0; n /= 2)
+            for(; n > 0; n /= 2)
             {
 #if RANGES_CXX_ALIGNED_NEW < RANGES_CXX_ALIGNED_NEW_17
                 static_assert(alignof(T) <= alignof(std::max_align_t),
@@ -59,6 +62,8 @@ namespace ranges
                 else
 #endif // RANGES_CXX_ALIGNED_NEW
                 ptr = ::operator new(sizeof(T) * n, std::nothrow);
+                if(ptr != nullptr)
+                    break;
             }
 
             return {static_cast<T *>(ptr), static_cast<std::ptrdiff_t>(n)};
@@ -254,6 +259,91 @@ namespace ranges
     {
         return raw_buffer<Val>(val);
     }
+
+    /// Uninitialized storage for `T`s that an algorithm can borrow as scratch
+    /// space instead of getting a temporary buffer on every call. It grows on
+    /// demand and keeps its storage until it is destroyed, so reusing one across
+    /// calls allocates only when a call needs more than any earlier one. `Alloc`
+    /// provides the storage; `std::pmr::polymorphic_allocator<T>` draws it from a
+    /// memory resource.
+    template<typename T, typename Alloc = std::allocator<T>>
+    struct scratch_buffer
+    {
+    private:
+        using traits_t = std::allocator_traits<Alloc>;
+        CPP_assert(same_as<T, typename traits_t::value_type>);
+
+        RANGES_NO_UNIQUE_ADDRESS Alloc alloc_;
+        T * data_ = nullptr;
+        std::ptrdiff_t capacity_ = 0;
+
+        void release() noexcept
+        {
+            if(data_ != nullptr)
+                traits_t::deallocate(
+                    alloc_, data_, static_cast<std::size_t>(capacity_));
+            data_ = nullptr;
+            capacity_ = 0;
+        }
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+
+        scratch_buffer() = default;
+        explicit scratch_buffer(Alloc const & alloc)
+          : alloc_(alloc)
+        {}
+        explicit scratch_buffer(std::ptrdiff_t n, Alloc const & alloc = Alloc())
+          : alloc_(alloc)
+        {
+            reserve(n);
+        }
+        scratch_buffer(scratch_buffer && that) noexcept
+          : alloc_(std::move(that.alloc_))
+          , data_(ranges::exchange(that.data_, nullptr))
+          , capacity_(ranges::exchange(that.capacity_, 0))
+        {}
+        scratch_buffer(scratch_buffer const &) = delete;
+        scratch_buffer & operator=(scratch_buffer const &) = delete;
+        ~scratch_buffer()
+        {
+            release();
+        }
+
+        /// Makes room for at least `n` elements. Any storage it replaces is
+        /// freed, not copied: the buffer never holds live objects between calls.
+        void reserve(std::ptrdiff_t n)
+        {
+            RANGES_EXPECT(n >= 0);
+            if(n <= capacity_)
+                return;
+            // Grow geometrically so that slowly growing requests do not
+            // reallocate every time.
+            std::ptrdiff_t const grown = capacity_ + capacity_ / 2;
+            n = n < grown ? grown : n;
+            release();
+            data_ = traits_t::allocate(alloc_, static_cast<std::size_t>(n));
+            capacity_ = n;
+        }
+        /// Frees the storage.
+        void clear() noexcept
+        {
+            release();
+        }
+        T * data() const noexcept
+        {
+            return data_;
+        }
+        std::ptrdiff_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+        Alloc get_allocator() const
+        {
+            return alloc_;
+        }
+    };
     /// @}
 } // namespace ranges
 
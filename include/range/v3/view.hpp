@@ -51,9 +51,13 @@
 #include <range/v3/view/istream.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/linear_distribute.hpp>
+#include <range/v3/view/lines.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/memoize.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/partial_sum.hpp>
+#include <range/v3/view/priority.hpp>
+#include <range/v3/view/random.hpp>
 #include <range/v3/view/ref.hpp>
 #include <range/v3/view/remove.hpp>
 #include <range/v3/view/remove_if.hpp>
@@ -28,6 +28,7 @@
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/facade.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -449,6 +450,61 @@ namespace ranges
         {
             return iter_move_(42);
         }
+        // An adaptor can push the elements up to a position or a sentinel of the base
+        // range into a sink with a for_each_while(it, last, sink) member. The adaptor
+        // of a sentinel can do the same when the cursor's adaptor is adaptor_base,
+        // which passes the elements of a pushable base range straight through.
+        template<typename A, typename L, typename F>
+        static auto adapt_for_each_while_(A & adapt, BaseIter & it, L const & last,
+                                          F & sink, int)
+            -> decltype(adapt.for_each_while(it, last, sink))
+        {
+            return adapt.for_each_while(it, last, sink);
+        }
+        template(typename A, typename L, typename F)(
+            /// \pre
+            requires same_as<A, adaptor_base> AND
+                detail::internally_iterable_t<BaseIter, L>::value)
+        static void adapt_for_each_while_(A &, BaseIter & it, L const & last, F & sink,
+                                          long)
+        {
+            it = detail::for_each_while_(std::move(it), last, sink);
+        }
+        template<typename S, typename A, typename F, typename Ad = Adapt>
+        auto for_each_while_(adaptor_sentinel<S, A> const & last, F & sink, int)
+            -> meta::if_c<same_as<Ad, adaptor_base>,
+                          decltype(last.data_.second().for_each_while(
+                              std::declval<BaseIter &>(), last.data_.first(), sink))>
+        {
+            last.data_.second().for_each_while(this->data_.first(), last.data_.first(),
+                                               sink);
+        }
+        template(typename S, typename A, typename F)(
+            /// \pre
+            requires same_as<A, adaptor_base>)
+        auto for_each_while_(adaptor_sentinel<S, A> const & last, F & sink, long)
+            -> decltype(adaptor_cursor::adapt_for_each_while_(
+                std::declval<Adapt &>(), std::declval<BaseIter &>(), last.data_.first(),
+                sink, 42))
+        {
+            adaptor_cursor::adapt_for_each_while_(
+                this->data_.second(), this->data_.first(), last.data_.first(), sink, 42);
+        }
+        template<typename F, typename C = adaptor_cursor>
+        auto for_each_while(adaptor_cursor const & last, F & sink)
+            -> decltype(C::adapt_for_each_while_(std::declval<Adapt &>(),
+                                                 std::declval<BaseIter &>(),
+                                                 last.data_.first(), sink, 42))
+        {
+            adaptor_cursor::adapt_for_each_while_(
+                this->data_.second(), this->data_.first(), last.data_.first(), sink, 42);
+        }
+        template<typename S, typename A, typename F>
+        auto for_each_while(adaptor_sentinel<S, A> const & last, F & sink)
+            -> decltype(std::declval<adaptor_cursor &>().for_each_while_(last, sink, 42))
+        {
+            this->for_each_while_(last, sink, 42);
+        }
 
     public:
         adaptor_cursor() = default;
@@ -15,6 +15,9 @@
 #ifndef RANGES_V3_VIEW_ANY_VIEW_HPP
 #define RANGES_V3_VIEW_ANY_VIEW_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include <type_traits>
 #include <typeinfo>
 #include <utility>
@@ -30,12 +33,23 @@
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/facade.hpp>
 
+#include <range/v3/detail/batched_read.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 RANGES_DIAGNOSTIC_PUSH
 RANGES_DIAGNOSTIC_IGNORE_INCONSISTENT_OVERRIDE
 RANGES_DIAGNOSTIC_SUGGEST_OVERRIDE
 
+// The number of bytes of inline storage in an any_view and in each of its iterators.
+// The type-erased range or iterator lives there, without a heap allocation, if it
+// fits and can be moved without throwing. Zero puts every one on the heap.
+#ifndef RANGES_ANY_VIEW_BUFFER_SIZE
+#define RANGES_ANY_VIEW_BUFFER_SIZE (6 * sizeof(void *))
+#endif
+#ifndef RANGES_ANY_CURSOR_BUFFER_SIZE
+#define RANGES_ANY_CURSOR_BUFFER_SIZE (4 * sizeof(void *))
+#endif
+
 namespace ranges
 {
     /// \brief An enum that denotes the supported subset of range concepts supported by a
@@ -151,9 +165,174 @@ namespace ranges
             cloneable() = default;
             cloneable(cloneable const &) = delete;
             cloneable & operator=(cloneable const &) = delete;
-            virtual std::unique_ptr<cloneable> clone() const = 0;
+            // Copies *this into the `size` bytes at `buf` if it fits there, and onto
+            // the heap otherwise.
+            virtual cloneable * clone(void * buf, std::size_t size) const = 0;
+            // Moves *this, which lives in a buffer, into the same-sized one at `buf`.
+            virtual cloneable * move(void * buf) noexcept = 0;
         };
 
+        template<typename T>
+        constexpr bool fits_small_buffer(std::size_t size) noexcept
+        {
+            return sizeof(T) <= size && alignof(T) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible<T>::value;
+        }
+
+        /// Creates a `T` in the `size` bytes at `buf` if it fits there, and on the
+        /// heap otherwise.
+        template<typename T, typename... Args>
+        T * make_small(void * buf, std::size_t size, Args &&... args)
+        {
+            if(detail::fits_small_buffer<T>(size))
+                return ::new(buf) T(static_cast<Args &&>(args)...);
+            return new T(static_cast<Args &&>(args)...);
+        }
+
+        /// An owning pointer to a `cloneable<Base>` that keeps small objects in
+        /// `Size` bytes of inline storage and the others on the heap. Copies clone
+        /// the object.
+        template<typename Base, std::size_t Size>
+        struct cloneable_ptr
+        {
+        private:
+            static constexpr std::size_t buffer_size = Size == 0 ? 1 : Size;
+
+            cloneable<Base> * ptr_ = nullptr;
+            alignas(std::max_align_t) unsigned char buf_[buffer_size];
+
+            bool is_small() const noexcept
+            {
+                return reinterpret_cast<std::uintptr_t>(ptr_) -
+                           reinterpret_cast<std::uintptr_t>(+buf_) <
+                       buffer_size;
+            }
+            void steal(cloneable_ptr & that) noexcept
+            {
+                if(!that.ptr_)
+                    return;
+                if(that.is_small())
+                {
+                    ptr_ = that.ptr_->move(buf_);
+                    that.reset();
+                }
+                else
+                {
+                    ptr_ = that.ptr_;
+                    that.ptr_ = nullptr;
+                }
+            }
+
+        public:
+            cloneable_ptr() = default;
+            cloneable_ptr(cloneable_ptr && that) noexcept
+            {
+                steal(that);
+            }
+            cloneable_ptr(cloneable_ptr const & that)
+              : ptr_{that.ptr_ ? that.ptr_->clone(buf_, Size) : nullptr}
+            {}
+            ~cloneable_ptr()
+            {
+                reset();
+            }
+            cloneable_ptr & operator=(cloneable_ptr && that) noexcept
+            {
+                if(this != &that)
+                {
+                    reset();
+                    steal(that);
+                }
+                return *this;
+            }
+            cloneable_ptr & operator=(cloneable_ptr const & that)
+            {
+                return *this = cloneable_ptr{that};
+            }
+            template<typename T, typename... Args>
+            void emplace(Args &&... args)
+            {
+                reset();
+                ptr_ = detail::make_small<T>(buf_, Size, static_cast<Args &&>(args)...);
+            }
+            void reset() noexcept
+            {
+                if(!ptr_)
+                    return;
+                if(is_small())
+                    ptr_->~cloneable();
+                else
+                    delete ptr_;
+                ptr_ = nullptr;
+            }
+            cloneable<Base> * get() const noexcept
+            {
+                return ptr_;
+            }
+            cloneable<Base> & operator*() const noexcept
+            {
+                RANGES_EXPECT(ptr_);
+                return *ptr_;
+            }
+            cloneable<Base> * operator->() const noexcept
+            {
+                RANGES_EXPECT(ptr_);
+                return ptr_;
+            }
+            explicit operator bool() const noexcept
+            {
+                return ptr_ != nullptr;
+            }
+        };
+
+        // What a batched read of an any_view stores for an element: its address if
+        // the reference type is a reference, and a copy otherwise.
+        template<typename Ref>
+        using any_batch_t = meta::if_c<std::is_reference<Ref>::value,
+                                       meta::_t<std::remove_reference<Ref>> *, Ref>;
+
+        // Whether an any_view's elements are read a batch at a time by the
+        // algorithms that walk the whole range. Copies must be cheap.
+        template<typename Ref>
+        using any_batchable =
+            meta::bool_<std::is_reference<Ref>::value ||
+                        (std::is_trivially_copyable<Ref>::value &&
+                         sizeof(Ref) <= 4 * sizeof(void *))>;
+
+        template<typename Ref>
+        any_batch_t<Ref> any_batch_element(Ref ref, std::true_type) noexcept
+        {
+            return detail::addressof(ref);
+        }
+        template<typename Ref>
+        any_batch_t<Ref> any_batch_element(Ref ref, std::false_type)
+        {
+            return ref;
+        }
+
+        template<typename Ref>
+        Ref any_batch_get(any_batch_t<Ref> & elem, std::true_type) noexcept
+        {
+            return static_cast<Ref>(*elem);
+        }
+        template<typename Ref>
+        Ref any_batch_get(any_batch_t<Ref> & elem, std::false_type)
+        {
+            return elem;
+        }
+
+        // Reads up to `n` elements of `[it, last)` into `out`.
+        template<typename Ref, typename I, typename S>
+        std::size_t any_read_n(I & it, S const & last, any_batch_t<Ref> * out,
+                               std::size_t n)
+        {
+            std::size_t i = 0;
+            for(; i != n && it != last; ++i, ++it)
+                ::new(static_cast<void *>(out + i)) any_batch_t<Ref>(
+                    detail::any_batch_element<Ref>(*it, std::is_reference<Ref>{}));
+            return i;
+        }
+
         // clang-format off
         template(typename Rng, typename Ref)(
         concept (any_compatible_range_)(Rng, Ref),
@@ -173,7 +352,7 @@ namespace ranges
 
         public:
             any_view_sentinel_impl() = default;
-            any_view_sentinel_impl(Rng & rng)
+            any_view_sentinel_impl(Rng & rng) noexcept(noexcept(box_t(ranges::end(rng))))
               : box_t(ranges::end(rng))
             {}
             void init(Rng & rng) noexcept
@@ -209,6 +388,7 @@ namespace ranges
             virtual bool done() = 0;
             virtual Ref read() const = 0;
             virtual void next() = 0;
+            virtual std::size_t read_n(any_batch_t<Ref> * out, std::size_t n) = 0;
         };
         template<typename Ref>
         struct any_input_view_interface<Ref, true> : any_input_view_interface<Ref, false>
@@ -233,6 +413,10 @@ namespace ranges
             {
                 view_->next();
             }
+            std::size_t read_n(any_batch_t<Ref> * out, std::size_t n)
+            {
+                return view_ ? view_->read_n(out, n) : 0;
+            }
             bool equal(any_input_cursor const &) const noexcept
             {
                 return true;
@@ -280,6 +464,11 @@ namespace ranges
             {
                 ++current_;
             }
+            virtual std::size_t read_n(any_batch_t<Ref> * out, std::size_t n) override
+            {
+                return detail::any_read_n<Ref>(
+                    current_, sentinel_box_t::get(rng_), out, n);
+            }
             std::size_t size() // override-ish
             {
                 return static_cast<std::size_t>(ranges::size(rng_));
@@ -334,6 +523,14 @@ namespace ranges
             any_cursor_impl(I it)
               : it_{std::move(it)}
             {}
+            any_cursor_impl(any_cursor_impl && that) noexcept(
+                std::is_nothrow_move_constructible<I>::value)
+              : it_{std::move(that.it_)}
+            {}
+            I & base() noexcept
+            {
+                return it_;
+            }
 
         private:
             using Forward =
@@ -358,10 +555,14 @@ namespace ranges
             {
                 ++it_;
             }
-            std::unique_ptr<any_cloneable_cursor_interface<Ref, Cat>> clone()
-                const override
+            any_cloneable_cursor_interface<Ref, Cat> * clone(
+                void * buf, std::size_t size) const override
             {
-                return detail::make_unique<any_cursor_impl>(it_);
+                return detail::make_small<any_cursor_impl>(buf, size, it_);
+            }
+            any_cloneable_cursor_interface<Ref, Cat> * move(void * buf) noexcept override
+            {
+                return ::new(buf) any_cursor_impl(std::move(*this));
             }
             void prev() // override (sometimes; it's complicated)
             {
@@ -408,7 +609,8 @@ namespace ranges
         private:
             CPP_assert((Cat & category::forward) == category::forward);
 
-            std::unique_ptr<any_cloneable_cursor_interface<Ref, Cat>> ptr_;
+            cloneable_ptr<any_cursor_interface<Ref, Cat>, RANGES_ANY_CURSOR_BUFFER_SIZE>
+                ptr_;
 
             template<typename Rng>
             using impl_t = any_cursor_impl<iterator_t<Rng>, Ref, Cat>;
@@ -421,17 +623,8 @@ namespace ranges
                     forward_range<Rng> AND
                     any_compatible_range<Rng, Ref>)
             explicit any_cursor(Rng && rng)
-              : ptr_{detail::make_unique<impl_t<Rng>>(begin(rng))}
-            {}
-            any_cursor(any_cursor &&) = default;
-            any_cursor(any_cursor const & that)
-              : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
-            {}
-            any_cursor & operator=(any_cursor &&) = default;
-            any_cursor & operator=(any_cursor const & that)
             {
-                ptr_ = (that.ptr_ ? that.ptr_->clone() : nullptr);
-                return *this;
+                ptr_.template emplace<impl_t<Rng>>(begin(rng));
             }
             Ref read() const
             {
@@ -453,6 +646,9 @@ namespace ranges
                 RANGES_EXPECT(ptr_);
                 ptr_->next();
             }
+            // Reads up to `n` elements into `out` with one indirect call.
+            std::size_t read_n(any_sentinel const & last, any_batch_t<Ref> * out,
+                               std::size_t n);
             CPP_member
             auto prev() //
                 -> CPP_ret(void)(
@@ -490,6 +686,8 @@ namespace ranges
 
             virtual ~any_view_interface() = default;
             virtual any_cursor<Ref, Cat> begin_cursor() = 0;
+            virtual std::size_t read_n(any_cursor_interface<Ref, Cat> & cur,
+                                       any_batch_t<Ref> * out, std::size_t n) = 0;
         };
         template<typename Ref, category Cat>
         struct any_view_interface<Ref, Cat, true> : any_view_interface<Ref, Cat, false>
@@ -497,6 +695,17 @@ namespace ranges
             virtual std::size_t size() = 0;
         };
 
+        template<typename Ref, category Cat>
+        std::size_t any_cursor<Ref, Cat>::read_n(any_sentinel const & last,
+                                                 any_batch_t<Ref> * out, std::size_t n)
+        {
+            RANGES_EXPECT(!ptr_ == !last.view_);
+            if(!ptr_)
+                return 0;
+            auto & view = static_cast<any_view_interface<Ref, Cat> &>(*last.view_);
+            return view.read_n(*ptr_, out, n);
+        }
+
         template<typename Ref, category Cat>
         using any_cloneable_view_interface = cloneable<any_view_interface<Ref, Cat>>;
 
@@ -517,6 +726,12 @@ namespace ranges
               , sentinel_box_t{range_box_t::get()}
             // NB: initialization order dependence
             {}
+            any_view_impl(any_view_impl && that) noexcept(
+                std::is_nothrow_move_constructible<Rng>::value &&
+                noexcept(any_view_sentinel_impl<Rng>(std::declval<Rng &>())))
+              : range_box_t{std::move(that.range_box_t::get())}
+              , sentinel_box_t{range_box_t::get()}
+            {}
 
         private:
             using range_box_t = box<Rng, any_view_impl>;
@@ -531,15 +746,66 @@ namespace ranges
                 auto & it = it_.get<iterator_t<Rng> const>();
                 return it == sentinel_box_t::get(range_box_t::get());
             }
-            std::unique_ptr<any_cloneable_view_interface<Ref, Cat>> clone() const override
+            std::size_t read_n(any_cursor_interface<Ref, Cat> & cur,
+                               any_batch_t<Ref> * out, std::size_t n) override
+            {
+                using cursor_t = any_cursor_impl<iterator_t<Rng>, Ref, Cat>;
+                auto & it = polymorphic_downcast<cursor_t &>(cur).base();
+                return detail::any_read_n<Ref>(
+                    it, sentinel_box_t::get(range_box_t::get()), out, n);
+            }
+            any_cloneable_view_interface<Ref, Cat> * clone(
+                void * buf, std::size_t size) const override
             {
-                return detail::make_unique<any_view_impl>(range_box_t::get());
+                return detail::make_small<any_view_impl>(buf, size, range_box_t::get());
+            }
+            any_cloneable_view_interface<Ref, Cat> * move(void * buf) noexcept override
+            {
+                return ::new(buf) any_view_impl(std::move(*this));
             }
             std::size_t size() // override-ish
             {
                 return static_cast<std::size_t>(ranges::size(range_box_t::get()));
             }
         };
+
+        template<typename Ref, category Cat>
+        struct batched_reader<basic_iterator<any_cursor<Ref, Cat>>, any_sentinel,
+                              enable_if_t<any_batchable<Ref>::value>> : std::true_type
+        {
+            using buffer_type = any_batch_t<Ref>;
+            static std::size_t read(basic_iterator<any_cursor<Ref, Cat>> & first,
+                                    any_sentinel const & last, buffer_type * out,
+                                    std::size_t n)
+            {
+                return range_access::pos(first).read_n(last, out, n);
+            }
+            static Ref get(buffer_type & elem)
+            {
+                return detail::any_batch_get<Ref>(elem, std::is_reference<Ref>{});
+            }
+        };
+
+        // Input iterators may hand out references into themselves, so only
+        // copies are read ahead.
+        template<typename Ref>
+        struct batched_reader<
+            basic_iterator<any_input_cursor<Ref>>, default_sentinel_t,
+            enable_if_t<!std::is_reference<Ref>::value && any_batchable<Ref>::value>>
+          : std::true_type
+        {
+            using buffer_type = any_batch_t<Ref>;
+            static std::size_t read(basic_iterator<any_input_cursor<Ref>> & first,
+                                    default_sentinel_t, buffer_type * out,
+                                    std::size_t n)
+            {
+                return range_access::pos(first).read_n(out, n);
+            }
+            static Ref get(buffer_type & elem)
+            {
+                return elem;
+            }
+        };
     } // namespace detail
     /// \endcond
 
@@ -564,16 +830,6 @@ namespace ranges
           : any_view(static_cast<Rng &&>(rng),
                      meta::bool_<(get_categories<Rng>() & Cat) == Cat>{})
         {}
-        any_view(any_view &&) = default;
-        any_view(any_view const & that)
-          : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
-        {}
-        any_view & operator=(any_view &&) = default;
-        any_view & operator=(any_view const & that)
-        {
-            ptr_ = (that.ptr_ ? that.ptr_->clone() : nullptr);
-            return *this;
-        }
 
         CPP_member
         auto size() //
@@ -589,8 +845,9 @@ namespace ranges
         using impl_t = detail::any_view_impl<views::all_t<Rng>, Ref, Cat>;
         template<typename Rng>
         any_view(Rng && rng, std::true_type)
-          : ptr_{detail::make_unique<impl_t<Rng>>(views::all(static_cast<Rng &&>(rng)))}
-        {}
+        {
+            ptr_.template emplace<impl_t<Rng>>(views::all(static_cast<Rng &&>(rng)));
+        }
         template<typename Rng>
         any_view(Rng &&, std::false_type)
         {
@@ -605,10 +862,12 @@ namespace ranges
         }
         detail::any_sentinel end_cursor() noexcept
         {
-            return detail::any_sentinel{*ptr_};
+            return ptr_ ? detail::any_sentinel{*ptr_} : detail::any_sentinel{};
         }
 
-        std::unique_ptr<detail::any_cloneable_view_interface<Ref, Cat>> ptr_;
+        detail::cloneable_ptr<detail::any_view_interface<Ref, Cat>,
+                              RANGES_ANY_VIEW_BUFFER_SIZE>
+            ptr_;
     };
 
     // input and not forward
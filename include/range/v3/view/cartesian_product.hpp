@@ -154,6 +154,10 @@ namespace ranges
             constify_if<cartesian_product_view> * view_;
             std::tuple<iterator_t<constify_if<Views>>...> its_;
 
+            void next_(meta::size_t<0>)
+            {
+                RANGES_EXPECT(false);
+            }
             void next_(meta::size_t<1>)
             {
                 auto & v = std::get<0>(view_->views_);
@@ -286,6 +290,27 @@ namespace ranges
                     at_end || bool(std::get<N - 1>(its_) ==
                                    ranges::end(std::get<N - 1>(view_->views_))));
             }
+            // Pushes the elements of the row of the last view that the cursor is in,
+            // up to row_end, into sink.
+            template<typename S, typename F>
+            bool push_row_(S const & row_end, F & sink)
+            {
+                auto & i = std::get<sizeof...(Views) - 1>(its_);
+                for(; i != row_end; ++i)
+                    if(!sink(read()))
+                        return false;
+                return true;
+            }
+            // Steps from the end of a row of the last view to the start of the next.
+            void next_row_()
+            {
+                constexpr std::size_t n = sizeof...(Views);
+                if(RANGES_CONSTEXPR_IF(n != 1))
+                {
+                    std::get<n - 1>(its_) = ranges::begin(std::get<n - 1>(view_->views_));
+                    next_(meta::size_t<n - 1>{});
+                }
+            }
             cursor(end_tag, constify_if<cartesian_product_view> * view,
                    std::true_type) // common_with
               : cursor(begin_tag{}, view)
@@ -345,6 +370,32 @@ namespace ranges
             {
                 return equal_(that, meta::size_t<sizeof...(Views)>{});
             }
+            // Only the iterator into the last view moves for most elements, so the
+            // elements are pushed a row of the last view at a time.
+            template<typename F>
+            void for_each_while(default_sentinel_t, F & sink)
+            {
+                auto & v = std::get<sizeof...(Views) - 1>(view_->views_);
+                while(!equal(default_sentinel) && push_row_(ranges::end(v), sink))
+                    next_row_();
+            }
+            template<typename F>
+            void for_each_while(cursor const & last, F & sink)
+            {
+                constexpr std::size_t n = sizeof...(Views);
+                auto & v = std::get<n - 1>(view_->views_);
+                while(!equal(last))
+                {
+                    if(equal_(last, meta::size_t<n - 1>{}))
+                    {
+                        push_row_(std::get<n - 1>(last.its_), sink);
+                        return;
+                    }
+                    if(!push_row_(ranges::end(v), sink))
+                        return;
+                    next_row_();
+                }
+            }
             CPP_member
             auto prev() -> CPP_ret(void)(
                 /// \pre
@@ -128,6 +128,47 @@ namespace ranges
             {
                 RANGES_EXPECT(its_.index() == cranges - 1);
             }
+            template<std::size_t N>
+            static bool ends_in_(meta::size_t<N>, cursor const & last)
+            {
+                return last.its_.index() == N;
+            }
+            template<std::size_t N>
+            static bool ends_in_(meta::size_t<N>, sentinel<IsConst> const &)
+            {
+                return false;
+            }
+            template<std::size_t N>
+            iterator_t<constify_if<meta::at_c<meta::list<Rngs...>, N>>> segment_end_(
+                meta::size_t<N>, cursor const & last) const
+            {
+                return last.its_.index() == N ? ranges::get<N>(last.its_)
+                                              : end(std::get<N>(rng_->rngs_));
+            }
+            template<std::size_t N>
+            sentinel_t<constify_if<meta::at_c<meta::list<Rngs...>, N>>> segment_end_(
+                meta::size_t<N>, sentinel<IsConst> const &) const
+            {
+                return end(std::get<N>(rng_->rngs_));
+            }
+            template<typename Last, typename F>
+            void segments_(meta::size_t<cranges>, Last const &, F &)
+            {}
+            template<std::size_t N, typename Last, typename F>
+            void segments_(meta::size_t<N>, Last const & last, F & f)
+            {
+                if(its_.index() == N)
+                {
+                    auto & it = ranges::get<N>(its_);
+                    auto const seg_end = this->segment_end_(meta::size_t<N>{}, last);
+                    if(it != seg_end)
+                        it = f(std::move(it), seg_end);
+                    if(it != seg_end || cursor::ends_in_(meta::size_t<N>{}, last))
+                        return;
+                    this->satisfy(meta::size_t<N>{});
+                }
+                this->segments_(meta::size_t<N + 1>{}, last, f);
+            }
             struct next_fun
             {
                 cursor * pos;
@@ -280,6 +321,17 @@ namespace ranges
               : rng_(that.rng_)
               , its_(std::move(that.its_))
             {}
+            // The concatenated ranges are the segments of a concat_view.
+            template<typename F>
+            void segments(cursor const & last, F & f)
+            {
+                this->segments_(meta::size_t<0>{}, last, f);
+            }
+            template<typename F>
+            void segments(sentinel<IsConst> const & last, F & f)
+            {
+                this->segments_(meta::size_t<0>{}, last, f);
+            }
             reference read() const
             {
                 // Kind of a dumb implementation. Surely there's a better way.
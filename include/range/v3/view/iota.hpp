@@ -383,6 +383,26 @@ namespace ranges
             {
                 return that.from_ == from_;
             }
+            // Counting up to the bound in a loop of its own keeps the values in a
+            // register when the view is pushed through a pipeline.
+            template<typename F>
+            void for_each_while(sentinel const & last, F & sink)
+            {
+                for(; from_ != last.to_ && sink(read()); ++from_)
+                {}
+            }
+            template<typename F>
+            void for_each_while(cursor const & last, F & sink)
+            {
+                for(; from_ != last.from_ && sink(read()); ++from_)
+                {}
+            }
+            template<typename F>
+            void for_each_while(unreachable_sentinel_t, F & sink)
+            {
+                for(; sink(read()); ++from_)
+                {}
+            }
             CPP_member
             auto prev() //
                 -> CPP_ret(void)(
@@ -14,8 +14,11 @@
 #ifndef RANGES_V3_VIEW_JOIN_HPP
 #define RANGES_V3_VIEW_JOIN_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <meta/meta.hpp>
 
@@ -25,6 +28,7 @@
 #include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/range_for.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -32,6 +36,7 @@
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/facade.hpp>
 #include <range/v3/view/single.hpp>
+#include <range/v3/view/subrange.hpp>
 #include <range/v3/view/view.hpp>
 
 #include <range/v3/detail/prologue.hpp>
@@ -124,7 +129,31 @@ namespace ranges
         CPP_concept has_arrow_ =
             input_iterator<I> &&
             (std::is_pointer<I>::value || CPP_requires_ref(detail::has_member_arrow_, I));
+
+        // A join over these can be split without walking the elements.
+        template<typename Outer>
+        CPP_concept join_splittable_ =
+            forward_range<Outer> &&
+            std::is_reference<range_reference_t<Outer>>::value &&
+            forward_range<range_reference_t<Outer>> &&
+            sized_range<range_reference_t<Outer>>;
         // clang-format on
+
+        // The size of a join of outer, with `joiner` elements between the inner
+        // ranges.
+        template<typename Outer>
+        size_hint_t join_size_hint_(Outer & outer, std::size_t joiner = 0)
+        {
+            std::size_t n = 0, count = 0;
+            RANGES_FOR(auto && inner, outer)
+            {
+                n += static_cast<std::size_t>(ranges::size(inner));
+                ++count;
+            }
+            if(count != 0)
+                n += joiner * (count - 1);
+            return {n, n};
+        }
     } // namespace detail
     /// \endcond
 
@@ -169,6 +198,21 @@ namespace ranges
                 n += ranges::size(inner);
             return n;
         }
+        // The exact size, from a walk over the outer range, where that does not
+        // make the inner ranges again.
+        CPP_auto_member
+        auto CPP_fun(size_hint)()(
+            /// \pre
+            requires detail::join_splittable_<Rng>)
+        {
+            return detail::join_size_hint_(outer_);
+        }
+        CPP_auto_member
+        auto CPP_fun(size_hint)()(const //
+            requires detail::join_splittable_<Rng const>)
+        {
+            return detail::join_size_hint_(outer_);
+        }
         // // ericniebler/stl2#605
         constexpr Rng base() const
         {
@@ -204,6 +248,20 @@ namespace ranges
                 if(RANGES_CONSTEXPR_IF(ref_is_glvalue::value))
                     inner_it_ = iterator_t<CInner>();
             }
+            // Walks the rest of the current inner range with f, and moves on to
+            // the next one if f reached its end.
+            template<typename F>
+            bool segment_(F & f)
+            {
+                auto && inner = rng_->get_inner_(outer_it_);
+                auto const last = ranges::end(inner);
+                inner_it_ = f(std::move(inner_it_), last);
+                if(inner_it_ != last)
+                    return false;
+                ++outer_it_;
+                satisfy();
+                return true;
+            }
 
         public:
             using single_pass = meta::bool_<single_pass_iterator_<iterator_t<COuter>> ||
@@ -217,6 +275,12 @@ namespace ranges
             {
                 satisfy();
             }
+            constexpr cursor(Parent * rng, iterator_t<COuter> outer_it,
+                             iterator_t<CInner> inner_it)
+              : rng_{rng}
+              , outer_it_(std::move(outer_it))
+              , inner_it_(std::move(inner_it))
+            {}
             template(bool Other)(
                 /// \pre
                 requires Const AND CPP_NOT(Other) AND
@@ -250,6 +314,22 @@ namespace ranges
             {
                 return outer_it_ == that.outer_it_ && inner_it_ == that.inner_it_;
             }
+            // The inner ranges are the segments of a joined range.
+            template<typename F>
+            void segments(default_sentinel_t, F & f)
+            {
+                while(outer_it_ != ranges::end(rng_->outer_) && segment_(f))
+                    ;
+            }
+            template<typename F>
+            void segments(cursor const & last, F & f)
+            {
+                while(outer_it_ != last.outer_it_)
+                    if(!segment_(f))
+                        return;
+                if(outer_it_ != ranges::end(rng_->outer_))
+                    inner_it_ = f(std::move(inner_it_), last.inner_it_);
+            }
             constexpr void next()
             {
                 auto && inner_rng = rng_->get_inner_(outer_it_);
@@ -289,6 +369,49 @@ namespace ranges
         {
             return simple_view<Rng>() && std::is_reference<range_reference_t<Rng>>::value;
         }
+        template<bool Const>
+        static std::vector<subrange<basic_iterator<cursor<Const>>,
+                                    basic_iterator<cursor<Const>>, subrange_kind::sized>>
+        split_(meta::const_if_c<Const, join_view> * self, std::size_t n)
+        {
+            RANGES_EXPECT(0 < n);
+            using I = basic_iterator<cursor<Const>>;
+            using CInner = range_reference_t<meta::const_if_c<Const, Rng>>;
+            using D = range_difference_t<CInner>;
+            std::size_t size = 0;
+            RANGES_FOR(auto && inner, self->outer_)
+                size += static_cast<std::size_t>(ranges::size(inner));
+            auto const q = size / n, r = size % n;
+            // Piece k starts this many elements in.
+            auto const start = [=](std::size_t k) { return q * k + (std::min)(k, r); };
+
+            std::vector<subrange<I, I, subrange_kind::sized>> parts;
+            parts.reserve(n);
+            I first{cursor<Const>{self, ranges::begin}};
+            std::size_t k = 1, seen = 0;
+            auto const push = [&](I last) {
+                parts.emplace_back(first, last, start(k) - start(k - 1));
+                first = std::move(last);
+                ++k;
+            };
+            auto outer_it = ranges::begin(self->outer_);
+            for(; outer_it != ranges::end(self->outer_); ++outer_it)
+            {
+                auto && inner = *outer_it;
+                auto const inner_size = static_cast<std::size_t>(ranges::size(inner));
+                while(k < n && start(k) < seen + inner_size)
+                {
+                    auto const offset = static_cast<D>(start(k) - seen);
+                    push(I{cursor<Const>{
+                        self, outer_it, ranges::next(ranges::begin(inner), offset)}});
+                }
+                seen += inner_size;
+            }
+            I const last{cursor<Const>{self, std::move(outer_it), iterator_t<CInner>{}}};
+            while(k <= n)
+                push(last);
+            return parts;
+        }
         struct end_cursor_fn
         {
             constexpr auto operator()(join_view * this_, std::true_type) const
@@ -349,6 +472,26 @@ namespace ranges
                             common_range<CRng> && common_range<range_reference_t<CRng>>>;
             return cend_cursor_fn{}(this, cond{});
         }
+
+    public:
+        /// Splits the joined range into \c n pieces whose sizes differ by at most
+        /// one (see \c ranges::split_into). Each piece starts in the inner range
+        /// found by adding up the sizes of those before it.
+        template(bool Const = use_const_always())(
+            /// \pre
+            requires detail::join_splittable_<meta::const_if_c<Const, Rng>>)
+        auto split_into(std::size_t n)
+        {
+            return split_<Const>(this, n);
+        }
+        /// \overload
+        template(bool Const = true)(
+            /// \pre
+            requires Const AND detail::join_splittable_<meta::const_if_c<Const, Rng>>)
+        auto split_into(std::size_t n) const
+        {
+            return split_<Const>(this, n);
+        }
     };
 
     // Join a range of ranges, inserting a range of values between them.
@@ -391,6 +534,15 @@ namespace ranges
                             ? 0
                             : ranges::size(val_) * (range_cardinality<Rng>::value - 1));
         }
+        // The exact size, as for join_view, so that converting the view to a
+        // container, like a std::string, allocates once.
+        CPP_auto_member
+        auto CPP_fun(size_hint)()(
+            /// \pre
+            requires detail::join_splittable_<Rng> && sized_range<ValRng>)
+        {
+            return detail::join_size_hint_(outer_, ranges::size(val_));
+        }
 
     private:
         friend range_access;
@@ -431,6 +583,13 @@ namespace ranges
                     }
                 }
             }
+            template<typename It, typename R, typename F>
+            static bool segment_(It & it, R & rng, F & f)
+            {
+                auto const last = ranges::end(rng);
+                it = f(std::move(it), last);
+                return it == last;
+            }
 
         public:
             using value_type = common_type_t<range_value_t<Inner>, range_value_t<ValRng>>;
@@ -457,6 +616,20 @@ namespace ranges
             {
                 return outer_it_ == ranges::end(rng_->outer_);
             }
+            // The inner ranges and the copies of the delimiter between them are the
+            // segments of a joined range.
+            template<typename F>
+            void segments(default_sentinel_t, F & f)
+            {
+                while(outer_it_ != ranges::end(rng_->outer_))
+                {
+                    if(cur_.index() == 0
+                           ? !cursor::segment_(ranges::get<0>(cur_), rng_->val_, f)
+                           : !cursor::segment_(ranges::get<1>(cur_), rng_->inner_, f))
+                        return;
+                    satisfy();
+                }
+            }
             void next()
             {
                 // visit(cur_, [](auto& it){ ++it; });
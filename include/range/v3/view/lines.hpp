@@ -0,0 +1,204 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_LINES_HPP
+#define RANGES_V3_VIEW_LINES_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/c_str.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/subrange.hpp>
+#include <range/v3/view/view.hpp>
+
+#include <range/v3/detail/simd.hpp>
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+#if defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L
+        template<typename Char>
+        std::basic_string_view<Char> make_line_view(Char const * first,
+                                                    Char const * last) noexcept
+        {
+            return {first, static_cast<std::size_t>(last - first)};
+        }
+#else
+        template<typename Char>
+        subrange<Char const *> make_line_view(Char const * first,
+                                              Char const * last) noexcept
+        {
+            return {first, last};
+        }
+#endif
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-views
+    /// @{
+
+    /// The lines of a contiguous range of characters, as views of the characters
+    /// between the line breaks: `std::basic_string_view`s where the library has
+    /// them, `subrange`s of pointers otherwise. A line ends at `\n` or at `\r\n`,
+    /// neither of which is part of it, and the text after the last line break is
+    /// a line unless it is empty, as with `std::getline`. The line breaks are
+    /// found with `memchr` or a vector loop.
+    template<typename Rng>
+    struct lines_view : view_facade<lines_view<Rng>, finite>
+    {
+    private:
+        friend range_access;
+        using Char = meta::_t<std::remove_cv<range_value_t<Rng>>>;
+        Rng rng_;
+
+        struct cursor
+        {
+        private:
+            Char const * cur_ = nullptr;
+            Char const * eol_ = nullptr;
+            Char const * last_ = nullptr;
+
+            void find_eol()
+            {
+                eol_ = cur_ + detail::simd_find(cur_, last_ - cur_, Char('\n'));
+            }
+
+        public:
+            cursor() = default;
+            cursor(Char const * first, Char const * last)
+              : cur_(first)
+              , eol_(first)
+              , last_(last)
+            {
+                if(cur_ != last_)
+                    find_eol();
+            }
+            auto read() const noexcept
+            {
+                Char const * end = eol_;
+                if(end != last_ && end != cur_ && end[-1] == Char('\r'))
+                    --end;
+                return detail::make_line_view(cur_, end);
+            }
+            void next()
+            {
+                RANGES_EXPECT(cur_ != last_);
+                cur_ = eol_ == last_ ? last_ : eol_ + 1;
+                if(cur_ != last_)
+                    find_eol();
+            }
+            bool equal(cursor const & that) const
+            {
+                return cur_ == that.cur_;
+            }
+        };
+
+        template<typename R>
+        static Char const * first_(R & rng)
+        {
+            return ranges::data(rng);
+        }
+        template<typename R>
+        static Char const * last_(R & rng)
+        {
+            return ranges::data(rng) + ranges::size(rng);
+        }
+
+        cursor begin_cursor()
+        {
+            return {first_(rng_), last_(rng_)};
+        }
+        cursor end_cursor()
+        {
+            return {last_(rng_), last_(rng_)};
+        }
+        template(bool Const = true)(
+            /// \pre
+            requires Const AND contiguous_range<meta::const_if_c<Const, Rng>> AND
+                sized_range<meta::const_if_c<Const, Rng>>)
+        cursor begin_cursor() const
+        {
+            return {first_(rng_), last_(rng_)};
+        }
+        template(bool Const = true)(
+            /// \pre
+            requires Const AND contiguous_range<meta::const_if_c<Const, Rng>> AND
+                sized_range<meta::const_if_c<Const, Rng>>)
+        cursor end_cursor() const
+        {
+            return {last_(rng_), last_(rng_)};
+        }
+
+    public:
+        lines_view() = default;
+        explicit lines_view(Rng rng)
+          : rng_(std::move(rng))
+        {}
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+#if RANGES_CXX_DEDUCTION_GUIDES >= RANGES_CXX_DEDUCTION_GUIDES_17
+    template<typename Rng>
+    lines_view(Rng &&) //
+        -> lines_view<views::all_t<Rng>>;
+#endif
+
+    template<typename Rng>
+    RANGES_INLINE_VAR constexpr bool enable_borrowed_range<lines_view<Rng>> =
+        enable_borrowed_range<Rng>;
+
+    namespace views
+    {
+        struct lines_fn
+        {
+            template(typename Rng)(
+                /// \pre
+                requires viewable_range<Rng> AND contiguous_range<Rng> AND
+                    sized_range<Rng> AND
+                    detail::is_char_type<range_value_t<Rng>>::value)
+            lines_view<all_t<Rng>> operator()(Rng && rng) const
+            {
+                return lines_view<all_t<Rng>>{all(static_cast<Rng &&>(rng))};
+            }
+        };
+
+        /// \relates lines_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(view_closure<lines_fn>, lines)
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+RANGES_SATISFY_BOOST_RANGE(::ranges::lines_view)
+
+#endif
@@ -0,0 +1,262 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MEMOIZE_HPP
+#define RANGES_V3_VIEW_MEMOIZE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // The elements of a memoize_view made so far, in chunks of storage that
+        // never move, and the iterator into the underlying range that made the
+        // last of them, or that failed to make the next.
+        template<typename Rng>
+        struct memoize_cache_
+        {
+        private:
+            using T = range_value_t<Rng>;
+            static constexpr std::size_t chunk_size =
+                sizeof(T) < 4096 ? 4096 / sizeof(T) : 1;
+
+            Rng rng_;
+            optional<iterator_t<Rng>> it_;
+            std::vector<T *> chunks_;
+            std::size_t size_ = 0;
+            bool made_ = false; // whether *it_ has been made already
+            bool done_ = false;
+
+            T * slot_(std::size_t n) const noexcept
+            {
+                return chunks_[n / chunk_size] + n % chunk_size;
+            }
+
+        public:
+            explicit memoize_cache_(Rng rng)
+              : rng_(std::move(rng))
+            {}
+            memoize_cache_(memoize_cache_ const &) = delete;
+            memoize_cache_ & operator=(memoize_cache_ const &) = delete;
+            ~memoize_cache_()
+            {
+                for(std::size_t n = 0; n != size_; ++n)
+                    slot_(n)->~T();
+                for(T * chunk : chunks_)
+                    std::allocator<T>{}.deallocate(chunk, chunk_size);
+            }
+
+            Rng & base() noexcept
+            {
+                return rng_;
+            }
+            // Makes the elements up to the nth, reading the underlying range no
+            // further than that. Returns whether it has an nth element.
+            bool fill(std::size_t n)
+            {
+                if(n < size_)
+                    return true;
+                if(done_)
+                    return false;
+                if(!it_)
+                    it_.emplace(ranges::begin(rng_));
+                for(;;)
+                {
+                    // Move on only from an element that was made, so that one
+                    // whose construction threw is made again on the next call.
+                    if(made_)
+                    {
+                        ++*it_;
+                        made_ = false;
+                    }
+                    if(*it_ == ranges::end(rng_))
+                        return done_ = true, false;
+                    if(size_ == chunks_.size() * chunk_size)
+                    {
+                        // Make room first so that push_back cannot throw and
+                        // leak the chunk.
+                        if(chunks_.size() == chunks_.capacity())
+                            chunks_.reserve(2 * chunks_.size() + 1);
+                        chunks_.push_back(std::allocator<T>{}.allocate(chunk_size));
+                    }
+                    ::new(static_cast<void *>(slot_(size_))) T(**it_);
+                    made_ = true;
+                    if(size_++ == n)
+                        return true;
+                }
+            }
+            T const & operator[](std::size_t n)
+            {
+                fill(n);
+                return *slot_(n);
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-views
+    /// @{
+
+    /// A view of the elements of an input range that reads each of them from
+    /// the range once, the first time an iterator gets to it, and keeps it in
+    /// storage shared by all copies of the view and their iterators. The
+    /// elements are kept in chunks that never move, so references to them stay
+    /// valid as long as the view or a copy of it does. A memoize_view is random
+    /// access, and sized and common if the range is sized.
+    ///
+    /// \note Iterating a memoize_view changes its storage, so copies of it
+    /// cannot be iterated on different threads at the same time.
+    template<typename Rng>
+    struct memoize_view
+      : view_facade<memoize_view<Rng>, range_cardinality<Rng>::value>
+    {
+    private:
+        CPP_assert(view_<Rng>);
+        CPP_assert(input_range<Rng>);
+        CPP_assert(constructible_from<range_value_t<Rng>, range_reference_t<Rng>>);
+        friend range_access;
+        using cache_t = detail::memoize_cache_<Rng>;
+        std::shared_ptr<cache_t> cache_;
+
+        struct cursor
+        {
+        private:
+            cache_t * cache_ = nullptr;
+            std::ptrdiff_t n_ = 0;
+
+        public:
+            cursor() = default;
+            cursor(cache_t * cache, std::ptrdiff_t n)
+              : cache_(cache)
+              , n_(n)
+            {}
+            range_value_t<Rng> const & read() const
+            {
+                return (*cache_)[static_cast<std::size_t>(n_)];
+            }
+            bool equal(cursor const & that) const
+            {
+                return n_ == that.n_;
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return !cache_->fill(static_cast<std::size_t>(n_));
+            }
+            void next()
+            {
+                ++n_;
+            }
+            void prev()
+            {
+                --n_;
+            }
+            void advance(std::ptrdiff_t n)
+            {
+                n_ += n;
+            }
+            std::ptrdiff_t distance_to(cursor const & that) const
+            {
+                return that.n_ - n_;
+            }
+        };
+
+        cursor begin_cursor() const
+        {
+            return {cache_.get(), 0};
+        }
+        CPP_member
+        auto end_cursor() const //
+            -> CPP_ret(cursor)(
+                /// \pre
+                requires sized_range<Rng>)
+        {
+            return {cache_.get(), static_cast<std::ptrdiff_t>(size())};
+        }
+        CPP_member
+        auto end_cursor() const //
+            -> CPP_ret(default_sentinel_t)(
+                /// \pre
+                requires (!sized_range<Rng>))
+        {
+            return {};
+        }
+
+    public:
+        memoize_view() = default;
+        explicit memoize_view(Rng rng)
+          : cache_(std::make_shared<cache_t>(std::move(rng)))
+        {}
+        CPP_auto_member
+        auto CPP_fun(size)()(const //
+            requires sized_range<Rng>)
+        {
+            return ranges::size(cache_->base());
+        }
+    };
+
+#if RANGES_CXX_DEDUCTION_GUIDES >= RANGES_CXX_DEDUCTION_GUIDES_17
+    template<typename Rng>
+    memoize_view(Rng &&) //
+        -> memoize_view<views::all_t<Rng>>;
+#endif
+
+    namespace views
+    {
+        struct memoize_fn
+        {
+            /// \brief Reads each element of an input range once, when an iterator
+            /// first gets to it, and keeps it so that later passes and copies of
+            /// the iterators read it from memory. Unlike \c views::cache1, which
+            /// keeps only the current element and is single-pass, the view is
+            /// random access, so a \c views::transform that is costly, or a
+            /// range like \c views::istream that can be read only once, can be
+            /// walked many times.
+            template(typename Rng)(
+                /// \pre
+                requires viewable_range<Rng> AND input_range<Rng> AND
+                    constructible_from<range_value_t<Rng>, range_reference_t<Rng>>)
+            memoize_view<all_t<Rng>> operator()(Rng && rng) const //
+            {
+                return memoize_view<all_t<Rng>>{all(static_cast<Rng &&>(rng))};
+            }
+        };
+
+        /// \relates memoize_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(view_closure<memoize_fn>, memoize)
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,246 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MMAP_HPP
+#define RANGES_V3_VIEW_MMAP_HPP
+
+// This header is not part of <range/v3/view.hpp> or <range/v3/all.hpp>: it
+// includes the POSIX headers <fcntl.h>, <sys/mman.h> and <unistd.h>, which do
+// not exist on every target and declare a global ::mmap. Include it directly.
+//
+// The mapping shows the file as it is when each page is first read. If the file
+// shrinks while it is mapped, reading a page past its new end raises SIGBUS; it
+// does not throw.
+
+#include <range/v3/detail/config.hpp>
+
+// Whether views::mmap is available: it needs the POSIX mmap interface.
+#ifndef RANGES_HAS_MMAP
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+#define RANGES_HAS_MMAP 1
+#else
+#define RANGES_HAS_MMAP 0
+#endif
+#endif
+
+#if RANGES_HAS_MMAP
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/interface.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// Hints about how the contents of a mapped file will be read. They can be
+    /// combined with `|`; the kernel is free to ignore them.
+    enum class mmap_hint : unsigned
+    {
+        none = 0,
+        /// The file will be read front to back: read ahead aggressively.
+        sequential = 1u << 0,
+        /// The file will be read in no particular order: do not read ahead.
+        random = 1u << 1,
+        /// The whole file will be needed soon: start reading it in now.
+        willneed = 1u << 2,
+        /// Back the mapping with transparent huge pages where the kernel and the
+        /// file system support it, which saves TLB misses over large files.
+        huge_pages = 1u << 3,
+        /// Fault in every page before returning (Linux only).
+        populate = 1u << 4
+    };
+
+    constexpr mmap_hint operator|(mmap_hint a, mmap_hint b) noexcept
+    {
+        return static_cast<mmap_hint>(static_cast<unsigned>(a) |
+                                      static_cast<unsigned>(b));
+    }
+
+    /// \cond
+    namespace detail
+    {
+        constexpr bool has_mmap_hint(mmap_hint hints, mmap_hint h) noexcept
+        {
+            return (static_cast<unsigned>(hints) & static_cast<unsigned>(h)) != 0;
+        }
+
+        // A read-only private mapping of a whole file, unmapped on destruction.
+        // Empty files are not mapped at all.
+        struct mmap_file
+        {
+            void * addr_ = nullptr;
+            std::size_t size_ = 0;
+
+            mmap_file(char const * path, mmap_hint hints)
+            {
+                int const fd = ::open(path, O_RDONLY | O_CLOEXEC);
+                if(fd < 0)
+                    mmap_file::fail("open", path);
+                struct ::stat st;
+                if(::fstat(fd, &st) != 0)
+                {
+                    int const err = errno;
+                    ::close(fd);
+                    mmap_file::fail("fstat", path, err);
+                }
+                size_ = static_cast<std::size_t>(st.st_size);
+                if(size_ == 0)
+                {
+                    ::close(fd);
+                    return;
+                }
+                int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+                if(detail::has_mmap_hint(hints, mmap_hint::populate))
+                    flags |= MAP_POPULATE;
+#endif
+                void * const addr = ::mmap(nullptr, size_, PROT_READ, flags, fd, 0);
+                int const err = errno;
+                // The mapping keeps the file open.
+                ::close(fd);
+                if(addr == MAP_FAILED)
+                    mmap_file::fail("mmap", path, err);
+                addr_ = addr;
+                advise(hints);
+            }
+            mmap_file(mmap_file const &) = delete;
+            mmap_file & operator=(mmap_file const &) = delete;
+            ~mmap_file()
+            {
+                if(addr_ != nullptr)
+                    ::munmap(addr_, size_);
+            }
+
+            void advise(mmap_hint hints) const noexcept
+            {
+                if(addr_ == nullptr)
+                    return;
+                if(detail::has_mmap_hint(hints, mmap_hint::sequential))
+                    ::posix_madvise(addr_, size_, POSIX_MADV_SEQUENTIAL);
+                if(detail::has_mmap_hint(hints, mmap_hint::random))
+                    ::posix_madvise(addr_, size_, POSIX_MADV_RANDOM);
+                if(detail::has_mmap_hint(hints, mmap_hint::willneed))
+                    ::posix_madvise(addr_, size_, POSIX_MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+                if(detail::has_mmap_hint(hints, mmap_hint::huge_pages))
+                    ::madvise(addr_, size_, MADV_HUGEPAGE);
+#endif
+            }
+
+            [[noreturn]] static void fail(char const * what, char const * path,
+                                          int err = errno)
+            {
+                throw std::system_error(err,
+                                        std::generic_category(),
+                                        std::string("ranges::mmap_view: ") + what +
+                                            " \"" + path + "\"");
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// A read-only view of the contents of a file, mapped into memory with POSIX
+    /// `mmap` rather than read through a stream. It is a contiguous, sized range of
+    /// `T`, which is `char const` or another byte type such as `std::byte const`.
+    /// Copies share the mapping, which is unmapped when the last of them is
+    /// destroyed; iterators are valid for as long as some copy is alive.
+    /// Construction throws `std::system_error` if the file cannot be mapped.
+    ///
+    /// \warning Reading the view after the file has been truncated by another
+    /// writer raises SIGBUS for the pages past the new end of the file.
+    template<typename T = char const>
+    struct mmap_view : view_interface<mmap_view<T>, finite>
+    {
+    private:
+        static_assert(sizeof(T) == 1 && std::is_const<T>::value &&
+                          std::is_trivially_copyable<T>::value,
+                      "mmap_view is a view of constant bytes.");
+        std::shared_ptr<detail::mmap_file const> file_;
+
+    public:
+        mmap_view() = default;
+        explicit mmap_view(char const * path, mmap_hint hints = mmap_hint::none)
+          : file_(std::make_shared<detail::mmap_file const>(path, hints))
+        {}
+        explicit mmap_view(std::string const & path, mmap_hint hints = mmap_hint::none)
+          : mmap_view(path.c_str(), hints)
+        {}
+        T * data() const noexcept
+        {
+            return file_ ? static_cast<T *>(file_->addr_) : nullptr;
+        }
+        std::size_t size() const noexcept
+        {
+            return file_ ? file_->size_ : 0;
+        }
+        T * begin() const noexcept
+        {
+            return data();
+        }
+        T * end() const noexcept
+        {
+            return data() + size();
+        }
+        /// Passes more hints about how the file will be read to the kernel.
+        void advise(mmap_hint hints) const noexcept
+        {
+            if(file_)
+                file_->advise(hints);
+        }
+    };
+
+    namespace views
+    {
+        struct mmap_fn
+        {
+            mmap_view<> operator()(char const * path,
+                                   mmap_hint hints = mmap_hint::none) const
+            {
+                return mmap_view<>{path, hints};
+            }
+            mmap_view<> operator()(std::string const & path,
+                                   mmap_hint hints = mmap_hint::none) const
+            {
+                return mmap_view<>{path, hints};
+            }
+        };
+
+        /// \relates mmap_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(mmap_fn, mmap)
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif // RANGES_HAS_MMAP
+
+#endif
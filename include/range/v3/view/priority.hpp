@@ -0,0 +1,199 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_PRIORITY_HPP
+#define RANGES_V3_VIEW_PRIORITY_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/semiregular_box.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// The elements of a range from the greatest to the least by `C` and `P`, as
+    /// a `std::priority_queue` would pop them. Beginning the view copies the
+    /// elements into a heap in which each element has up to `Arity` children;
+    /// each step pops the next element off it. Reading the first `k` elements
+    /// takes `O(n + k log n)` comparisons, so the view is a lazy partial sort.
+    template<typename Rng, std::size_t Arity = 4, typename C = less,
+             typename P = identity>
+    struct priority_view
+      : view_facade<priority_view<Rng, Arity, C, P>,
+                    range_cardinality<Rng>::value == unknown
+                        ? finite
+                        : range_cardinality<Rng>::value>
+    {
+    private:
+        CPP_assert(view_<Rng>);
+        CPP_assert(input_range<Rng>);
+        CPP_assert(!is_infinite<Rng>::value);
+        static_assert(Arity >= 2, "A heap needs an arity of 2 or more.");
+        friend range_access;
+        using value_t = range_value_t<Rng>;
+
+        Rng rng_;
+        RANGES_NO_UNIQUE_ADDRESS semiregular_box_t<C> pred_;
+        RANGES_NO_UNIQUE_ADDRESS semiregular_box_t<P> proj_;
+        std::vector<value_t> heap_;
+
+        struct cursor
+        {
+        private:
+            priority_view * view_ = nullptr;
+
+        public:
+            using single_pass = std::true_type;
+
+            cursor() = default;
+            explicit cursor(priority_view * view)
+              : view_(view)
+            {}
+            value_t const & read() const
+            {
+                return view_->heap_.front();
+            }
+            void next()
+            {
+                auto & heap = view_->heap_;
+                detail::heap_pop_n_<Arity>(heap.begin(),
+                                           static_cast<std::ptrdiff_t>(heap.size()),
+                                           view_->pred_,
+                                           view_->proj_);
+                heap.pop_back();
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return view_->heap_.empty();
+            }
+        };
+
+        cursor begin_cursor()
+        {
+            heap_.clear();
+            for(auto it = ranges::begin(rng_), last = ranges::end(rng_); it != last;
+                ++it)
+                heap_.emplace_back(*it);
+            detail::heap_make_n_<Arity>(
+                heap_.begin(), static_cast<std::ptrdiff_t>(heap_.size()), pred_, proj_);
+            return cursor{this};
+        }
+
+    public:
+        priority_view() = default;
+        explicit priority_view(Rng rng, C pred = C{}, P proj = P{})
+          : rng_(std::move(rng))
+          , pred_(std::move(pred))
+          , proj_(std::move(proj))
+        {}
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+    namespace views
+    {
+        /// \cond
+        // clang-format off
+        template(typename Rng, typename C, typename P)(
+        concept (prioritizable_range_)(Rng, C, P),
+            constructible_from<range_value_t<Rng>, range_reference_t<Rng>> AND
+            sortable<typename std::vector<range_value_t<Rng>>::iterator, C, P>
+        );
+        template<typename Rng, typename C, typename P>
+        CPP_concept prioritizable_range =
+            viewable_range<Rng> && input_range<Rng> &&
+            CPP_concept_ref(views::prioritizable_range_, Rng, C, P);
+        // clang-format on
+        /// \endcond
+
+        template<std::size_t Arity>
+        struct priority_base_fn
+        {
+            template(typename Rng, typename C = less, typename P = identity)(
+                /// \pre
+                requires prioritizable_range<Rng, C, P>)
+            priority_view<all_t<Rng>, Arity, C, P> //
+            operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+            {
+                return priority_view<all_t<Rng>, Arity, C, P>{
+                    all(static_cast<Rng &&>(rng)), std::move(pred), std::move(proj)};
+            }
+        };
+
+        template<std::size_t Arity>
+        struct dary_priority_fn : priority_base_fn<Arity>
+        {
+            using priority_base_fn<Arity>::operator();
+
+            template(typename C, typename P = identity)(
+                /// \pre
+                requires (!range<C>))
+            constexpr auto operator()(C pred, P proj = P{}) const
+            {
+                return make_view_closure(bind_back(
+                    priority_base_fn<Arity>{}, std::move(pred), std::move(proj)));
+            }
+        };
+
+        /// \brief Given an input range, returns its elements from the greatest to
+        /// the least, popping them lazily off a 4-ary heap of copies. Takes an
+        /// optional order and projection; with \c greater the least comes first.
+        /// \c views::dary_priority<Arity> picks the arity of the heap.
+        using priority_fn = dary_priority_fn<4>;
+
+        /// \relates priority_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(view_closure<priority_fn>, priority)
+
+        /// \relates priority_fn
+#if RANGES_CXX_INLINE_VARIABLES < RANGES_CXX_INLINE_VARIABLES_17
+        namespace
+        {
+            template<std::size_t Arity>
+            constexpr auto & dary_priority =
+                static_const<view_closure<dary_priority_fn<Arity>>>::value;
+        } // namespace
+#else  // RANGES_CXX_INLINE_VARIABLES >= RANGES_CXX_INLINE_VARIABLES_17
+        template<std::size_t Arity>
+        inline constexpr view_closure<dary_priority_fn<Arity>> dary_priority{};
+#endif // RANGES_CXX_INLINE_VARIABLES
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,189 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_RANDOM_HPP
+#define RANGES_V3_VIEW_RANDOM_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/unreachable_sentinel.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/utility/semiregular_box.hpp>
+#include <range/v3/view/facade.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // The elements of views::random<T>(seed): every value of an integral T
+        // equally likely, or for a floating-point one, the multiples of 2^-p in
+        // [0, 1), p being its precision or 64 if that is less. Unlike the
+        // standard distributions, these are the same everywhere.
+        template<typename T, bool = std::is_integral<T>::value>
+        struct uniform_random_
+        {
+            template<typename Gen>
+            T operator()(Gen & gen) const
+            {
+                constexpr int bits =
+                    std::numeric_limits<T>::digits + std::numeric_limits<T>::is_signed;
+                return static_cast<T>(gen() >> (64 - bits));
+            }
+        };
+        template<typename T>
+        struct uniform_random_<T, false>
+        {
+            template<typename Gen>
+            T operator()(Gen & gen) const
+            {
+                constexpr int bits = std::numeric_limits<T>::digits < 64
+                                         ? std::numeric_limits<T>::digits
+                                         : 64;
+                return static_cast<T>(gen() >> (64 - bits)) * std::ldexp(T(1), -bits);
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-views
+    /// @{
+
+    /// An infinite random-access range of random `T`s. The element at index
+    /// `i` is `dist` applied to a `philox4x64` keyed by the seed and set to the
+    /// counter `{i, 0, 0, 0}`, a stream of its own, so it depends on nothing
+    /// but the seed, `dist` and `i`. Any slice of the range can be made on any
+    /// thread, in any order, and gives the same elements.
+    template<typename T, typename Dist = detail::uniform_random_<T>>
+    struct random_view : view_facade<random_view<T, Dist>, infinite>
+    {
+    private:
+        friend range_access;
+        std::uint64_t seed_ = philox4x64::default_seed;
+        semiregular_box_t<Dist> dist_;
+
+        struct cursor
+        {
+        private:
+            random_view const * rng_ = nullptr;
+            std::ptrdiff_t n_ = 0;
+
+        public:
+            cursor() = default;
+            explicit cursor(random_view const * rng)
+              : rng_(rng)
+            {}
+            T read() const
+            {
+                return rng_->at_(n_);
+            }
+            bool equal(cursor const & that) const
+            {
+                return n_ == that.n_;
+            }
+            void next()
+            {
+                ++n_;
+            }
+            void prev()
+            {
+                --n_;
+            }
+            void advance(std::ptrdiff_t d)
+            {
+                n_ += d;
+            }
+            std::ptrdiff_t distance_to(cursor const & that) const
+            {
+                return that.n_ - n_;
+            }
+        };
+        cursor begin_cursor() const
+        {
+            return cursor{this};
+        }
+        unreachable_sentinel_t end_cursor() const
+        {
+            return unreachable;
+        }
+
+        T at_(std::ptrdiff_t n) const
+        {
+            philox4x64 gen{seed_};
+            gen.set_counter({{static_cast<std::uint64_t>(n), 0, 0, 0}});
+            Dist dist = dist_;
+            return static_cast<T>(invoke(dist, gen));
+        }
+
+    public:
+        random_view() = default;
+        constexpr random_view(std::uint64_t seed, Dist dist)
+          : seed_(seed)
+          , dist_(std::move(dist))
+        {}
+    };
+
+    namespace views
+    {
+        /// \cond
+        namespace _random_
+        {
+            /// \endcond
+
+            /// `views::random<T>(seed)` is uniform over the values of an
+            /// integral `T`, and over `[0, 1)` for a floating-point one, with
+            /// the same elements on every platform. `views::random<T>(seed,
+            /// dist)` takes them from a distribution such as
+            /// `std::normal_distribution<double>`, which standard libraries
+            /// implement differently.
+            ///
+            /// \sa `random_view`
+            template(typename T)(
+                /// \pre
+                requires (integral<T> || std::is_floating_point<T>::value))
+            random_view<T> random(std::uint64_t seed)
+            {
+                return {seed, detail::uniform_random_<T>{}};
+            }
+
+            /// \overload
+            template(typename T, typename Dist)(
+                /// \pre
+                requires copy_constructible<Dist> AND
+                    invocable<Dist &, philox4x64 &> AND
+                    convertible_to<invoke_result_t<Dist &, philox4x64 &>, T>)
+            random_view<T, Dist> random(std::uint64_t seed, Dist dist)
+            {
+                return {seed, std::move(dist)};
+            }
+            /// \cond
+        } // namespace _random_
+        using namespace _random_;
+        /// \endcond
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
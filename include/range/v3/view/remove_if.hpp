@@ -26,6 +26,7 @@
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/box.hpp>
 #include <range/v3/utility/optional.hpp>
@@ -34,6 +35,7 @@
 #include <range/v3/view/adaptor.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -51,6 +53,19 @@ namespace ranges
           : remove_if_view::view_adaptor{detail::move(rng)}
           , remove_if_view::box(detail::move(pred))
         {}
+        CPP_auto_member
+        constexpr auto CPP_fun(size_hint)()(
+            /// \pre
+            requires detail::size_hinted_<Rng>)
+        {
+            return detail::size_hint_at_most_(ranges::size_hint(this->base()));
+        }
+        CPP_auto_member
+        constexpr auto CPP_fun(size_hint)()(const //
+            requires detail::size_hinted_<Rng const>)
+        {
+            return detail::size_hint_at_most_(ranges::size_hint(this->base()));
+        }
 
     private:
         friend range_access;
@@ -78,6 +93,17 @@ namespace ranges
             {
                 rng_->satisfy_reverse(it);
             }
+            // Pushes the elements that are not removed into sink, testing them as
+            // the base range pushes them.
+            template<typename Last, typename F>
+            void for_each_while(iterator_t<Rng> & it, Last const & last, F & sink) const
+            {
+                auto & pred = rng_->remove_if_view::box::get();
+                auto keep = [&](auto && ref) -> bool {
+                    return invoke(pred, ref) || sink(static_cast<decltype(ref)>(ref));
+                };
+                it = detail::for_each_while_(std::move(it), last, keep);
+            }
             void advance() = delete;
             void distance_to() = delete;
 
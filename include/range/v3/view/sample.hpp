@@ -28,6 +28,7 @@
 #include <range/v3/view/facade.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/sample_skip.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -47,9 +48,9 @@ namespace ranges
             size_tracker(Rng & rng)
               : size_(ranges::distance(rng))
             {}
-            void decrement()
+            void decrement(range_difference_t<Rng> n = 1)
             {
-                --size_;
+                size_ -= n;
             }
             range_difference_t<Rng> get(Rng &, iterator_t<Rng> &) const
             {
@@ -65,7 +66,7 @@ namespace ranges
             size_tracker() = default;
             size_tracker(Rng &)
             {}
-            void decrement()
+            void decrement(range_difference_t<Rng> = 1)
             {}
             range_difference_t<Rng> get(Rng & rng, iterator_t<Rng> const & it) const
             {
@@ -98,28 +99,21 @@ namespace ranges
             meta::const_if_c<IsConst, sample_view> * parent_;
             iterator_t<Base> current_;
             RANGES_NO_UNIQUE_ADDRESS detail::size_tracker<Base> size_;
+            detail::sample_skip_<D> skip_;
 
             D pop_size()
             {
                 return size_.get(parent_->rng_, current_);
             }
+            // Skips to the next element in the sample; see sample_skip_.
             void advance()
             {
                 if(parent_->size_ > 0)
                 {
-                    using Dist = std::uniform_int_distribution<D>;
-                    Dist dist{};
-                    URNG & engine = *parent_->engine_;
-
-                    for(;; ++current_, size_.decrement())
-                    {
-                        RANGES_ASSERT(current_ != ranges::end(parent_->rng_));
-                        auto n = pop_size();
-                        RANGES_EXPECT(n > 0);
-                        typename Dist::param_type const interval{0, n - 1};
-                        if(dist(engine, interval) < parent_->size_)
-                            break;
-                    }
+                    RANGES_ASSERT(current_ != ranges::end(parent_->rng_));
+                    D const s = skip_(pop_size(), parent_->size_, *parent_->engine_);
+                    ranges::advance(current_, s);
+                    size_.decrement(s);
                 }
             }
 
@@ -145,6 +139,7 @@ namespace ranges
               : parent_(that.parent_)
               , current_(std::move(that.current_))
               , size_(that.size_)
+              , skip_(that.skip_)
             {}
             range_reference_t<Rng> read() const
             {
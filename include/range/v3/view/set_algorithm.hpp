@@ -16,6 +16,7 @@
 #define RANGES_V3_VIEW_SET_ALGORITHM_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -24,6 +25,7 @@
 
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/functional/bind_back.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
@@ -38,6 +40,7 @@
 #include <range/v3/view/facade.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/gallop.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -126,8 +129,16 @@ namespace ranges
             iterator_t<R2> it2_;
             sentinel_t<R2> end2_;
 
+            using gallop2_ = gallopable_t<iterator_t<R2>, sentinel_t<R2>>;
+
             void satisfy()
             {
+                // Runs of the second range that the first lacks are skipped,
+                // galloping through long ones.
+                auto before1 = [this](auto && x) {
+                    return invoke(pred_, invoke(proj2_, x), invoke(proj1_, *it1_));
+                };
+                std::ptrdiff_t run2 = 0;
                 while(it1_ != end1_)
                 {
                     if(it2_ == end2_)
@@ -136,10 +147,14 @@ namespace ranges
                     if(invoke(pred_, invoke(proj1_, *it1_), invoke(proj2_, *it2_)))
                         return;
 
-                    if(!invoke(pred_, invoke(proj2_, *it2_), invoke(proj1_, *it1_)))
+                    if(before1(*it2_))
+                        detail::skip_while_(it2_, end2_, before1, run2, gallop2_{});
+                    else
+                    {
                         ++it1_;
-
-                    ++it2_;
+                        ++it2_;
+                        run2 = 0;
+                    }
                 }
             }
 
@@ -305,18 +320,34 @@ namespace ranges
             iterator_t<R2> it2_;
             sentinel_t<R2> end2_;
 
+            using gallop1_ = gallopable_t<iterator_t<R1>, sentinel_t<R1>>;
+            using gallop2_ = gallopable_t<iterator_t<R2>, sentinel_t<R2>>;
+
             void satisfy()
             {
+                // Whichever range is behind catches up, galloping if it has to
+                // skip many elements in a row.
+                auto before2 = [this](auto && x) {
+                    return invoke(pred_, invoke(proj1_, x), invoke(proj2_, *it2_));
+                };
+                auto before1 = [this](auto && x) {
+                    return invoke(pred_, invoke(proj2_, x), invoke(proj1_, *it1_));
+                };
+                std::ptrdiff_t run1 = 0, run2 = 0;
                 while(it1_ != end1_ && it2_ != end2_)
                 {
-                    if(invoke(pred_, invoke(proj1_, *it1_), invoke(proj2_, *it2_)))
-                        ++it1_;
-                    else
+                    if(before2(*it1_))
                     {
-                        if(!invoke(pred_, invoke(proj2_, *it2_), invoke(proj1_, *it1_)))
-                            return;
-                        ++it2_;
+                        detail::skip_while_(it1_, end1_, before2, run1, gallop1_{});
+                        run2 = 0;
                     }
+                    else if(before1(*it2_))
+                    {
+                        detail::skip_while_(it2_, end2_, before1, run2, gallop2_{});
+                        run1 = 0;
+                    }
+                    else
+                        return;
                 }
             }
 
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_VIEW_SPLIT_HPP
 #define RANGES_V3_VIEW_SPLIT_HPP
 
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -24,8 +25,10 @@
 #include <range/v3/algorithm/mismatch.hpp>
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
@@ -33,6 +36,7 @@
 #include <range/v3/view/single.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/simd.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -125,6 +129,53 @@ namespace ranges
         template<typename It>
         using split_view_base = meta::invoke<here_or_there_<!forward_iterator<It>>, It>;
 
+        /// Whether split_view can look for the pattern `P` in `Base` with the
+        /// kernels of detail/simd.hpp: both are contiguous arrays of the same
+        /// element type whose `==` the vector unit can evaluate, such as `char`.
+        template<typename Base, typename P>
+        using split_searchable =
+            meta::bool_<vectorizable_pair<iterator_t<Base>, sentinel_t<Base>,
+                                          iterator_t<P>, sentinel_t<P>>>;
+
+        // The start of the first occurrence of the non-empty pattern
+        // [pbegin, pend) in [cur, last), or last.
+        template<typename I, typename S, typename PI, typename PS>
+        I split_search(I cur, S last, PI pbegin, PS pend)
+        {
+            auto const n = static_cast<std::ptrdiff_t>(last - cur);
+            auto const m = static_cast<std::ptrdiff_t>(pend - pbegin);
+            if(n < m)
+                return cur + n;
+            return cur + detail::simd_search(
+                             std::addressof(*cur), n, std::addressof(*pbegin), m);
+        }
+
+        // Where the inner range that starts at `cur` ends when split_searchable
+        // lets split_inner_iterator find it up front.
+        template<typename It, bool Searchable>
+        struct split_inner_end
+        {
+            template<typename S, typename P>
+            constexpr split_inner_end(It const &, S const &, P &)
+            {}
+            split_inner_end() = default;
+        };
+
+        template<typename It>
+        struct split_inner_end<It, true>
+        {
+            It end_ = It();
+
+            template<typename S, typename P>
+            split_inner_end(It const & cur, S const & last, P & pattern)
+              : end_(ranges::empty(pattern)
+                         ? (cur == last ? cur : ranges::next(cur))
+                         : detail::split_search(
+                               cur, last, ranges::begin(pattern), ranges::end(pattern)))
+            {}
+            split_inner_end() = default;
+        };
+
         template<typename JoinView, bool Const>
         struct split_outer_iterator;
 
@@ -133,12 +184,19 @@ namespace ranges
 
         template<typename V, typename Pattern, bool Const>
         struct split_inner_iterator<split_view<V, Pattern>, Const>
+          : private split_inner_end<
+                iterator_t<meta::const_if_c<Const, V>>,
+                split_searchable<meta::const_if_c<Const, V>,
+                                 meta::const_if_c<Const, Pattern>>::value>
         {
         private:
             using Outer = split_outer_iterator<split_view<V, Pattern>, Const>;
             using Base = meta::const_if_c<Const, V>;
             using BaseIterCategory =
                 typename std::iterator_traits<iterator_t<Base>>::iterator_category;
+            using Searchable =
+                split_searchable<Base, meta::const_if_c<Const, Pattern>>;
+            using End = split_inner_end<iterator_t<Base>, Searchable::value>;
             Outer i_ = Outer();
             bool incremented_ = false;
             constexpr decltype(auto) current_() noexcept
@@ -149,7 +207,11 @@ namespace ranges
             {
                 return i_.current_();
             }
-            constexpr bool done_() const
+            bool done_(std::true_type) const
+            {
+                return current_() == this->end_;
+            }
+            constexpr bool done_(std::false_type) const
             {
                 auto cur = current_();
                 auto last = ranges::end(i_.parent_->base_);
@@ -168,6 +230,10 @@ namespace ranges
                 } while(++cur != last);
                 return false;
             }
+            constexpr bool done_() const
+            {
+                return done_(Searchable{});
+            }
 #if RANGES_CXX_IF_CONSTEXPR < RANGES_CXX_IF_CONSTEXPR_17
             constexpr void pre_inc(std::true_type) // Forward
             {
@@ -204,7 +270,8 @@ namespace ranges
             split_inner_iterator() = default;
 
             constexpr explicit split_inner_iterator(Outer i)
-              : i_(std::move(i))
+              : End(i.current_(), ranges::end(i.parent_->base_), i.parent_->pattern_)
+              , i_(std::move(i))
             {}
 
             constexpr decltype(auto) operator*() const
@@ -344,6 +411,30 @@ namespace ranges
             {
                 return (parent_->base_);
             }
+            // Moves `current` past the next occurrence of the non-empty pattern
+            // [pbegin, pend), or to `last`.
+            template<typename I, typename S, typename PI, typename PS>
+            static void skip_(I & current, S const & last, PI pbegin, PS pend,
+                              std::true_type)
+            {
+                current = detail::split_search(current, last, pbegin, pend);
+                if(current != last)
+                    current += pend - pbegin;
+            }
+            template<typename I, typename S, typename PI, typename PS>
+            static constexpr void skip_(I & current, S const & last, PI pbegin, PS pend,
+                                        std::false_type)
+            {
+                do
+                {
+                    const auto ret = ranges::mismatch(current, last, pbegin, pend);
+                    if(ret.in2 == pend)
+                    {
+                        current = ret.in1; // The pattern matched; skip it
+                        return;
+                    }
+                } while(++current != last);
+            }
 #if RANGES_CXX_IF_CONSTEXPR < RANGES_CXX_IF_CONSTEXPR_17
             constexpr split_outer_iterator post_inc(std::true_type) // Forward
             {
@@ -430,15 +521,12 @@ namespace ranges
                 if(pbegin == pend)
                     ++current;
                 else
-                    do
-                    {
-                        const auto ret = ranges::mismatch(current, last, pbegin, pend);
-                        if(ret.in2 == pend)
-                        {
-                            current = ret.in1; // The pattern matched; skip it
-                            break;
-                        }
-                    } while(++current != last);
+                    split_outer_iterator::skip_(
+                        current,
+                        last,
+                        pbegin,
+                        pend,
+                        split_searchable<Base, meta::const_if_c<Const, Pattern>>{});
                 return *this;
             }
 
@@ -23,6 +23,7 @@
 #include <range/v3/iterator/counted_iterator.hpp>
 #include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
@@ -271,6 +272,16 @@ namespace ranges
             auto n = ranges::size(base_);
             return ranges::min(n, static_cast<decltype(n)>(count_));
         }
+        constexpr size_hint_t size_hint()
+        {
+            return detail::size_hint_take_(detail::size_hint_or_none_(base_),
+                                           static_cast<std::size_t>(count_));
+        }
+        constexpr size_hint_t size_hint() const
+        {
+            return detail::size_hint_take_(detail::size_hint_or_none_(base_),
+                                           static_cast<std::size_t>(count_));
+        }
     };
 
     template<typename Rng>
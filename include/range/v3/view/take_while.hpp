@@ -27,11 +27,13 @@
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/utility/semiregular_box.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/adaptor.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -70,6 +72,21 @@ namespace ranges
             {
                 return it == last || !invoke(pred_, it);
             }
+            // A predicate on the elements, rather than on iterators, can test the
+            // elements as the base range pushes them.
+            template(typename F, typename P = Pred)(
+                /// \pre
+                requires detail::is_indirected_<P>::value)
+            void for_each_while(iterator_t<CRng> & it, sentinel_t<CRng> const & last,
+                                F & sink) const
+            {
+                auto & pred = pred_;
+                auto take = [&](auto && ref) -> bool {
+                    return invoke(pred, detail::element_ptr(ref)) &&
+                           sink(static_cast<decltype(ref)>(ref));
+                };
+                it = detail::for_each_while_(std::move(it), last, take);
+            }
         };
         sentinel_adaptor<false> end_adaptor()
         {
@@ -90,6 +107,19 @@ namespace ranges
           : iter_take_while_view::view_adaptor{std::move(rng)}
           , pred_(std::move(pred))
         {}
+        CPP_auto_member
+        constexpr auto CPP_fun(size_hint)()(
+            /// \pre
+            requires detail::size_hinted_<Rng>)
+        {
+            return detail::size_hint_at_most_(ranges::size_hint(this->base()));
+        }
+        CPP_auto_member
+        constexpr auto CPP_fun(size_hint)()(const //
+            requires detail::size_hinted_<Rng const>)
+        {
+            return detail::size_hint_at_most_(ranges::size_hint(this->base()));
+        }
     };
 
     template<typename Rng, typename Pred>
@@ -30,6 +30,7 @@
 #include <range/v3/iterator/operations.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/move.hpp>
 #include <range/v3/utility/semiregular_box.hpp>
@@ -38,6 +39,7 @@
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/for_each_while.hpp>
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -142,6 +144,21 @@ namespace ranges
                 return invoke(fun_, move_tag{}, it)
             )
             // clang-format on
+
+            // A function of the elements, rather than of iterators, can be applied
+            // to the elements as the base range pushes them.
+            template(typename Last, typename F, typename Fn = Fun)(
+                /// \pre
+                requires detail::is_indirected_<Fn>::value)
+            void for_each_while(iterator_t<CRng> & it, Last const & last, F & sink) const
+            {
+                auto & fun = fun_;
+                auto apply = [&](auto && ref) -> bool {
+                    return sink(invoke(
+                        fun, detail::element_ptr(static_cast<decltype(ref)>(ref))));
+                };
+                it = detail::for_each_while_(std::move(it), last, apply);
+            }
         };
 
         adaptor<false> begin_adaptor()
@@ -190,6 +207,19 @@ namespace ranges
         {
             return ranges::size(this->base());
         }
+        CPP_auto_member
+        constexpr auto CPP_fun(size_hint)()(
+            /// \pre
+            requires detail::size_hinted_<Rng>)
+        {
+            return ranges::size_hint(this->base());
+        }
+        CPP_auto_member
+        constexpr auto CPP_fun(size_hint)()(const //
+            requires detail::size_hinted_<Rng const>)
+        {
+            return ranges::size_hint(this->base());
+        }
     };
 
     template<typename Rng, typename Fun>
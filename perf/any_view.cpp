@@ -0,0 +1,190 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost of iterating and copying any_view and its iterators, and of
+// the algorithms that read any_view's elements a batch at a time. Build
+// with RANGES_ANY_VIEW_BUFFER_SIZE and RANGES_ANY_CURSOR_BUFFER_SIZE set to 0 (as
+// the range_v3_any_view_heap target does) to compare against heap-allocated
+// views and iterators.
+
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/any_view.hpp>
+#include <range/v3/view/transform.hpp>
+
+namespace
+{
+    using forward_view = ranges::any_view<int const &, ranges::category::forward>;
+    using random_access_view =
+        ranges::any_view<int, ranges::category::random_access | ranges::category::sized>;
+    using input_view = ranges::any_view<int, ranges::category::input>;
+
+    std::vector<int> const & data()
+    {
+        static std::vector<int> const v = [] {
+            std::vector<int> v(1000);
+            std::iota(v.begin(), v.end(), 0);
+            return v;
+        }();
+        return v;
+    }
+
+    template<typename View>
+    View make_view()
+    {
+        return data() | ranges::views::transform([](int const & i) -> int const & {
+                   return i;
+               });
+    }
+
+    template<typename View>
+    void iterate(benchmark::State & state)
+    {
+        View v = make_view<View>();
+        for(auto _ : state)
+        {
+            long long sum = 0;
+            for(auto it = v.begin(), last = v.end(); it != last; ++it)
+                sum += *it;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * 1000);
+    }
+
+    template<typename View>
+    void copy_iterator(benchmark::State & state)
+    {
+        View v = make_view<View>();
+        auto const it = v.begin();
+        for(auto _ : state)
+        {
+            auto copy = it;
+            benchmark::DoNotOptimize(copy);
+        }
+    }
+
+    template<typename View>
+    void begin(benchmark::State & state)
+    {
+        View v = make_view<View>();
+        for(auto _ : state)
+        {
+            auto it = v.begin();
+            benchmark::DoNotOptimize(it);
+        }
+    }
+
+    template<typename View>
+    void copy_view(benchmark::State & state)
+    {
+        View const v = make_view<View>();
+        for(auto _ : state)
+        {
+            View copy = v;
+            benchmark::DoNotOptimize(copy);
+        }
+    }
+
+    // Post-increment copies the iterator, as do many algorithms.
+    template<typename View>
+    void post_increment(benchmark::State & state)
+    {
+        View v = make_view<View>();
+        for(auto _ : state)
+        {
+            long long sum = 0;
+            for(auto it = v.begin(), last = v.end(); it != last;)
+                sum += *it++;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * 1000);
+    }
+
+    // The algorithms below call the erased cursor once per batch of elements.
+    template<typename View>
+    void for_each(benchmark::State & state)
+    {
+        View v = make_view<View>();
+        for(auto _ : state)
+        {
+            long long sum = 0;
+            ranges::for_each(v, [&sum](int i) { sum += i; });
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * 1000);
+    }
+
+    template<typename View>
+    void copy(benchmark::State & state)
+    {
+        View v = make_view<View>();
+        std::vector<int> out(1000);
+        for(auto _ : state)
+        {
+            ranges::copy(v, out.begin());
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(state.iterations() * 1000);
+    }
+
+    template<typename View>
+    void to_vector(benchmark::State & state)
+    {
+        View v = make_view<View>();
+        for(auto _ : state)
+        {
+            auto out = v | ranges::to<std::vector>();
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(state.iterations() * 1000);
+    }
+
+    // The same, over the view that the any_views erase.
+    void for_each_unerased(benchmark::State & state)
+    {
+        auto v = data() | ranges::views::transform([](int i) { return i; });
+        for(auto _ : state)
+        {
+            long long sum = 0;
+            ranges::for_each(v, [&sum](int i) { sum += i; });
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * 1000);
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(iterate, input_view);
+BENCHMARK_TEMPLATE(iterate, forward_view);
+BENCHMARK_TEMPLATE(iterate, random_access_view);
+BENCHMARK_TEMPLATE(post_increment, forward_view);
+BENCHMARK_TEMPLATE(post_increment, random_access_view);
+BENCHMARK_TEMPLATE(begin, forward_view);
+BENCHMARK_TEMPLATE(begin, random_access_view);
+BENCHMARK_TEMPLATE(copy_iterator, forward_view);
+BENCHMARK_TEMPLATE(copy_iterator, random_access_view);
+BENCHMARK_TEMPLATE(copy_view, forward_view);
+BENCHMARK_TEMPLATE(copy_view, random_access_view);
+BENCHMARK_TEMPLATE(for_each, input_view);
+BENCHMARK_TEMPLATE(for_each, forward_view);
+BENCHMARK_TEMPLATE(for_each, random_access_view);
+BENCHMARK_TEMPLATE(copy, input_view);
+BENCHMARK_TEMPLATE(copy, forward_view);
+BENCHMARK_TEMPLATE(copy, random_access_view);
+BENCHMARK_TEMPLATE(to_vector, forward_view);
+BENCHMARK_TEMPLATE(to_vector, random_access_view);
+BENCHMARK(for_each_unerased);
@@ -0,0 +1,152 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Benchmarks the vectorized find / count / mismatch / equal kernels for
+// contiguous arithmetic ranges against the generic element loop. Every
+// benchmark is run over a matrix of element type x length x hit position,
+// where the hit position is given in percent of the length (100 = no hit).
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/mismatch.hpp>
+
+namespace
+{
+    // Any predicate other than ranges::equal_to selects the generic loop.
+    struct generic_equal_to
+    {
+        template<typename T>
+        bool operator()(T const & a, T const & b) const
+        {
+            return a == b;
+        }
+    };
+
+    template<typename T>
+    struct haystack
+    {
+        std::vector<T> data;
+        std::vector<T> copy;
+        T needle;
+        explicit haystack(benchmark::State const & st)
+          : data(static_cast<std::size_t>(st.range(0)), T(1))
+          , needle(T(2))
+        {
+            auto const pos = static_cast<std::size_t>(st.range(0) * st.range(1) / 100);
+            copy = data;
+            if(pos < data.size())
+            {
+                data[pos] = needle;
+                copy[pos] = T(3);
+            }
+        }
+    };
+
+    template<typename T>
+    void BM_find_generic(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(
+                ranges::find_if(h.data, [&](T t) { return t == h.needle; }));
+    }
+
+    template<typename T>
+    void BM_find(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::find(h.data, h.needle));
+    }
+
+    template<typename T>
+    void BM_count_generic(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(
+                ranges::count_if(h.data, [&](T t) { return t == h.needle; }));
+    }
+
+    template<typename T>
+    void BM_count(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::count(h.data, h.needle));
+    }
+
+    template<typename T>
+    void BM_mismatch_generic(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::mismatch(h.data, h.copy, generic_equal_to{}));
+    }
+
+    template<typename T>
+    void BM_mismatch(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::mismatch(h.data, h.copy));
+    }
+
+    template<typename T>
+    void BM_equal_generic(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::equal(h.data, h.copy, generic_equal_to{}));
+    }
+
+    template<typename T>
+    void BM_equal(benchmark::State & st)
+    {
+        haystack<T> h(st);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::equal(h.data, h.copy));
+    }
+
+    void matrix(benchmark::internal::Benchmark * b)
+    {
+        for(std::int64_t len : {16, 256, 4096, 65536, 1 << 20})
+            for(std::int64_t hit : {0, 10, 50, 100})
+                b->Args({len, hit});
+    }
+} // namespace
+
+#define RANGES_BENCH_TYPES(BM)                   \
+    BENCHMARK_TEMPLATE(BM, char)->Apply(matrix);  \
+    BENCHMARK_TEMPLATE(BM, short)->Apply(matrix); \
+    BENCHMARK_TEMPLATE(BM, int)->Apply(matrix);   \
+    BENCHMARK_TEMPLATE(BM, float)->Apply(matrix); \
+    BENCHMARK_TEMPLATE(BM, double)->Apply(matrix)
+
+RANGES_BENCH_TYPES(BM_find_generic);
+RANGES_BENCH_TYPES(BM_find);
+RANGES_BENCH_TYPES(BM_count_generic);
+RANGES_BENCH_TYPES(BM_count);
+RANGES_BENCH_TYPES(BM_mismatch_generic);
+RANGES_BENCH_TYPES(BM_mismatch);
+RANGES_BENCH_TYPES(BM_equal_generic);
+RANGES_BENCH_TYPES(BM_equal);
@@ -0,0 +1,129 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares the memmove fast path of ranges::copy for contiguous ranges of
+// trivially copyable types against an element-by-element loop and std::copy.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/copy_backward.hpp>
+#include <range/v3/view/span.hpp>
+
+namespace
+{
+    // The generic loop that ranges::copy used to run for every input.
+    template<typename I, typename O>
+    O loop_copy(I first, I last, O out)
+    {
+        for(; first != last; ++first, ++out)
+            *out = *first;
+        return out;
+    }
+
+    template<typename T>
+    struct buffers
+    {
+        std::vector<T> src;
+        std::vector<T> dst;
+        explicit buffers(std::size_t n)
+          : src(n, T(1))
+          , dst(n)
+        {}
+    };
+
+    template<typename T>
+    void BM_loop_copy(benchmark::State & st)
+    {
+        buffers<T> b(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+        {
+            loop_copy(b.src.begin(), b.src.end(), b.dst.begin());
+            benchmark::DoNotOptimize(b.dst.data());
+            benchmark::ClobberMemory();
+        }
+        st.SetBytesProcessed(st.iterations() * st.range(0) *
+                             static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    template<typename T>
+    void BM_std_copy(benchmark::State & st)
+    {
+        buffers<T> b(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+        {
+            std::copy(b.src.begin(), b.src.end(), b.dst.begin());
+            benchmark::DoNotOptimize(b.dst.data());
+            benchmark::ClobberMemory();
+        }
+        st.SetBytesProcessed(st.iterations() * st.range(0) *
+                             static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    template<typename T>
+    void BM_ranges_copy(benchmark::State & st)
+    {
+        buffers<T> b(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+        {
+            ranges::copy(b.src, b.dst.begin());
+            benchmark::DoNotOptimize(b.dst.data());
+            benchmark::ClobberMemory();
+        }
+        st.SetBytesProcessed(st.iterations() * st.range(0) *
+                             static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    template<typename T>
+    void BM_ranges_copy_span(benchmark::State & st)
+    {
+        buffers<T> b(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+        {
+            ranges::copy(ranges::span<T const>(b.src), b.dst.data());
+            benchmark::DoNotOptimize(b.dst.data());
+            benchmark::ClobberMemory();
+        }
+        st.SetBytesProcessed(st.iterations() * st.range(0) *
+                             static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    template<typename T>
+    void BM_ranges_copy_backward(benchmark::State & st)
+    {
+        buffers<T> b(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+        {
+            ranges::copy_backward(b.src, b.dst.end());
+            benchmark::DoNotOptimize(b.dst.data());
+            benchmark::ClobberMemory();
+        }
+        st.SetBytesProcessed(st.iterations() * st.range(0) *
+                             static_cast<std::int64_t>(sizeof(T)));
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_loop_copy, float)->Range(64, 1 << 22);
+BENCHMARK_TEMPLATE(BM_std_copy, float)->Range(64, 1 << 22);
+BENCHMARK_TEMPLATE(BM_ranges_copy, float)->Range(64, 1 << 22);
+BENCHMARK_TEMPLATE(BM_ranges_copy_span, float)->Range(64, 1 << 22);
+BENCHMARK_TEMPLATE(BM_ranges_copy_backward, float)->Range(64, 1 << 22);
+
+BENCHMARK_TEMPLATE(BM_loop_copy, unsigned char)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(BM_std_copy, unsigned char)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(BM_ranges_copy, unsigned char)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(BM_ranges_copy_span, unsigned char)->Range(64, 1 << 24);
@@ -0,0 +1,69 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Looks up random keys in sorted arrays of 2^10 to 2^24 integers, with
+// ranges::lower_bound over the sorted array and with the lower_bound of an
+// eytzinger_index over the same elements. The argument is the log2 of the size.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/utility/eytzinger_index.hpp>
+
+namespace
+{
+    constexpr std::size_t query_count = 1 << 12;
+
+    struct inputs
+    {
+        std::vector<std::uint32_t> sorted_, queries_;
+
+        explicit inputs(std::int64_t log_size)
+        {
+            std::mt19937 gen(1);
+            sorted_.resize(std::size_t(1) << log_size);
+            for(auto & i : sorted_)
+                i = gen();
+            std::sort(sorted_.begin(), sorted_.end());
+            queries_.resize(query_count);
+            for(auto & q : queries_)
+                q = gen();
+        }
+    };
+
+    void BM_lower_bound(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        for(auto _ : st)
+            for(auto q : in.queries_)
+                benchmark::DoNotOptimize(ranges::lower_bound(in.sorted_, q));
+        st.SetItemsProcessed(st.iterations() * std::int64_t(query_count));
+    }
+
+    void BM_eytzinger_lower_bound(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        ranges::eytzinger_index<std::uint32_t> const index(in.sorted_);
+        for(auto _ : st)
+            for(auto q : in.queries_)
+                benchmark::DoNotOptimize(index.lower_bound(q));
+        st.SetItemsProcessed(st.iterations() * std::int64_t(query_count));
+    }
+
+    BENCHMARK(BM_lower_bound)->DenseRange(10, 24, 2);
+    BENCHMARK(BM_eytzinger_lower_bound)->DenseRange(10, 24, 2);
+} // namespace
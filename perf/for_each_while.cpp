@@ -0,0 +1,164 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Folds pipelines of views with the algorithms, which have the views push their
+// elements, and with the iterator loop that pulls them one at a time.
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/cartesian_product.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+
+namespace
+{
+    template<typename Rng>
+    std::int64_t loop_sum(Rng & rng)
+    {
+        std::int64_t sum = 0;
+        for(auto it = ranges::begin(rng), last = ranges::end(rng); it != last; ++it)
+            sum += *it;
+        return sum;
+    }
+
+    auto generated(int n)
+    {
+        return ranges::views::iota(0) |
+               ranges::views::filter([](int i) { return i % 3 != 0; }) |
+               ranges::views::transform([](int i) { return i * 7 + 1; }) |
+               ranges::views::take_while([n](int i) { return i < n; });
+    }
+
+    std::vector<int> events(int n)
+    {
+        std::vector<int> v(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            v[static_cast<std::size_t>(i)] = (i * 7919) % 1000;
+        return v;
+    }
+
+    auto aggregated(std::vector<int> const & v)
+    {
+        return v | ranges::views::filter([](int i) { return i >= 250; }) |
+               ranges::views::transform([](int i) { return i * 3 - 1; });
+    }
+
+    void BM_generated_loop(benchmark::State & st)
+    {
+        auto rng = generated(static_cast<int>(st.range(0)));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(loop_sum(rng));
+        st.SetItemsProcessed(st.iterations() * st.range(0) / 7);
+    }
+
+    void BM_generated_accumulate(benchmark::State & st)
+    {
+        auto rng = generated(static_cast<int>(st.range(0)));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::accumulate(rng, std::int64_t(0)));
+        st.SetItemsProcessed(st.iterations() * st.range(0) / 7);
+    }
+
+    void BM_generated_to_vector(benchmark::State & st)
+    {
+        auto rng = generated(static_cast<int>(st.range(0)));
+        for(auto _ : st)
+            benchmark::DoNotOptimize((rng | ranges::to<std::vector>()).data());
+        st.SetItemsProcessed(st.iterations() * st.range(0) / 7);
+    }
+
+    void BM_aggregate_loop(benchmark::State & st)
+    {
+        auto const v = events(static_cast<int>(st.range(0)));
+        auto rng = aggregated(v);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(loop_sum(rng));
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    void BM_aggregate_accumulate(benchmark::State & st)
+    {
+        auto const v = events(static_cast<int>(st.range(0)));
+        auto rng = aggregated(v);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::accumulate(rng, std::int64_t(0)));
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    void BM_aggregate_count_if(benchmark::State & st)
+    {
+        auto const v = events(static_cast<int>(st.range(0)));
+        auto rng = aggregated(v);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(
+                ranges::count_if(rng, [](int i) { return i % 2 == 0; }));
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    // The baseline: the same aggregation written by hand.
+    void BM_aggregate_hand(benchmark::State & st)
+    {
+        auto const v = events(static_cast<int>(st.range(0)));
+        for(auto _ : st)
+        {
+            std::int64_t sum = 0;
+            for(int i : v)
+                if(i >= 250)
+                    sum += i * 3 - 1;
+            benchmark::DoNotOptimize(sum);
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    auto grid(int n)
+    {
+        return ranges::views::cartesian_product(ranges::views::iota(0, n),
+                                                ranges::views::iota(0, n)) |
+               ranges::views::transform(
+                   [](auto && t) { return std::get<0>(t) * std::get<1>(t); });
+    }
+
+    void BM_grid_loop(benchmark::State & st)
+    {
+        auto rng = grid(static_cast<int>(st.range(0)));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(loop_sum(rng));
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(0));
+    }
+
+    void BM_grid_accumulate(benchmark::State & st)
+    {
+        auto rng = grid(static_cast<int>(st.range(0)));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::accumulate(rng, std::int64_t(0)));
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(0));
+    }
+
+    BENCHMARK(BM_generated_loop)->Arg(1 << 16);
+    BENCHMARK(BM_generated_accumulate)->Arg(1 << 16);
+    BENCHMARK(BM_generated_to_vector)->Arg(1 << 16);
+    BENCHMARK(BM_aggregate_hand)->Arg(1 << 14);
+    BENCHMARK(BM_aggregate_loop)->Arg(1 << 14);
+    BENCHMARK(BM_aggregate_accumulate)->Arg(1 << 14);
+    BENCHMARK(BM_aggregate_count_if)->Arg(1 << 14);
+    BENCHMARK(BM_grid_loop)->Arg(256);
+    BENCHMARK(BM_grid_accumulate)->Arg(256);
+} // namespace
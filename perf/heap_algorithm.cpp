@@ -0,0 +1,187 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Heaps of 4, 16 and 64 byte elements with 2^10 to 2^22 of them, built with
+// std::make_heap and with the heap algorithms of arity 2, 4 and 8, then used
+// as a priority queue that pops the top and pushes a new element, and sorted.
+// The argument is the log2 of the number of elements.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/heap_algorithm.hpp>
+
+namespace
+{
+    // An element of `Size` bytes whose key is its first four.
+    template<std::size_t Size>
+    struct elem
+    {
+        std::uint32_t key;
+        char payload[Size - sizeof(std::uint32_t)];
+
+        friend bool operator<(elem const & a, elem const & b)
+        {
+            return a.key < b.key;
+        }
+    };
+
+    template<>
+    struct elem<4>
+    {
+        std::uint32_t key;
+
+        friend bool operator<(elem const & a, elem const & b)
+        {
+            return a.key < b.key;
+        }
+    };
+
+    template<std::size_t Size>
+    std::vector<elem<Size>> random_elems(std::int64_t log_size)
+    {
+        std::mt19937 gen(1);
+        std::vector<elem<Size>> v(std::size_t(1) << log_size);
+        for(auto & e : v)
+            e.key = gen();
+        return v;
+    }
+
+    template<typename V>
+    using elem_t = typename V::value_type;
+
+    // 0 stands for std's binary heap.
+    template<std::size_t Arity>
+    struct heap
+    {
+        template<typename V>
+        static void make(V & v)
+        {
+            ranges::make_dary_heap<Arity>(v, ranges::less{}, &elem_t<V>::key);
+        }
+        template<typename V>
+        static void push(V & v)
+        {
+            ranges::push_dary_heap<Arity>(v, ranges::less{}, &elem_t<V>::key);
+        }
+        template<typename V>
+        static void pop(V & v)
+        {
+            ranges::pop_dary_heap<Arity>(v, ranges::less{}, &elem_t<V>::key);
+        }
+        template<typename V>
+        static void sort(V & v)
+        {
+            ranges::sort_dary_heap<Arity>(v, ranges::less{}, &elem_t<V>::key);
+        }
+    };
+
+    template<>
+    struct heap<0>
+    {
+        template<typename V>
+        static void make(V & v)
+        {
+            std::make_heap(v.begin(), v.end());
+        }
+        template<typename V>
+        static void push(V & v)
+        {
+            std::push_heap(v.begin(), v.end());
+        }
+        template<typename V>
+        static void pop(V & v)
+        {
+            std::pop_heap(v.begin(), v.end());
+        }
+        template<typename V>
+        static void sort(V & v)
+        {
+            std::sort_heap(v.begin(), v.end());
+        }
+    };
+
+    template<std::size_t Size, std::size_t Arity>
+    void BM_make_heap(benchmark::State & st)
+    {
+        auto const in = random_elems<Size>(st.range(0));
+        auto v = in;
+        for(auto _ : st)
+        {
+            st.PauseTiming();
+            v = in;
+            st.ResumeTiming();
+            heap<Arity>::make(v);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    // Pops the top, and pushes an element that is a little smaller, as in an
+    // event queue.
+    template<std::size_t Size, std::size_t Arity>
+    void BM_priority_queue(benchmark::State & st)
+    {
+        auto v = random_elems<Size>(st.range(0));
+        heap<Arity>::make(v);
+        constexpr std::int64_t ops = 1 << 12;
+        std::mt19937 gen(2);
+        for(auto _ : st)
+        {
+            for(std::int64_t i = 0; i < ops; ++i)
+            {
+                heap<Arity>::pop(v);
+                v.back().key -= gen() % 1024u;
+                heap<Arity>::push(v);
+            }
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * ops);
+    }
+
+    template<std::size_t Size, std::size_t Arity>
+    void BM_sort_heap(benchmark::State & st)
+    {
+        auto in = random_elems<Size>(st.range(0));
+        heap<Arity>::make(in);
+        auto v = in;
+        for(auto _ : st)
+        {
+            st.PauseTiming();
+            v = in;
+            st.ResumeTiming();
+            heap<Arity>::sort(v);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+} // namespace
+
+#define HEAP_BENCHMARKS(BM, SIZE)                                   \
+    BENCHMARK_TEMPLATE(BM, SIZE, 0)->DenseRange(10, 22, 6);         \
+    BENCHMARK_TEMPLATE(BM, SIZE, 2)->DenseRange(10, 22, 6);         \
+    BENCHMARK_TEMPLATE(BM, SIZE, 4)->DenseRange(10, 22, 6);         \
+    BENCHMARK_TEMPLATE(BM, SIZE, 8)->DenseRange(10, 22, 6)
+
+HEAP_BENCHMARKS(BM_make_heap, 4);
+HEAP_BENCHMARKS(BM_make_heap, 16);
+HEAP_BENCHMARKS(BM_make_heap, 64);
+HEAP_BENCHMARKS(BM_priority_queue, 4);
+HEAP_BENCHMARKS(BM_priority_queue, 16);
+HEAP_BENCHMARKS(BM_priority_queue, 64);
+HEAP_BENCHMARKS(BM_sort_heap, 4);
+HEAP_BENCHMARKS(BM_sort_heap, 16);
+HEAP_BENCHMARKS(BM_sort_heap, 64);
@@ -0,0 +1,94 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Reads the lines of a buffer of log lines with getlines, which copies every
+// line out of a std::istream, and with views::lines, which finds the line breaks
+// in place.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/view/getlines.hpp>
+#include <range/v3/view/lines.hpp>
+#include <range/v3/view/split.hpp>
+
+namespace
+{
+    std::string const & input()
+    {
+        static std::string const s = [] {
+            std::mt19937 gen(42);
+            std::string r;
+            while(r.size() < (std::size_t(1) << 22))
+            {
+                r += "2024-03-01T12:00:" + std::to_string(gen() % 60) +
+                     "Z INFO [worker-" + std::to_string(gen() % 32) +
+                     "] GET /api/v1/items?id=" +
+                     std::to_string(gen() % 100000) + " 200 " +
+                     std::to_string(gen() % 2000) + "ms\n";
+            }
+            return r;
+        }();
+        return s;
+    }
+
+    void BM_getlines(benchmark::State & st)
+    {
+        auto const & s = input();
+        for(auto _ : st)
+        {
+            std::istringstream sin{s};
+            std::size_t n = 0;
+            auto rng = ranges::getlines(sin);
+            for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+                n += (*it).size();
+            benchmark::DoNotOptimize(n);
+        }
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    void BM_lines(benchmark::State & st)
+    {
+        auto const & s = input();
+        for(auto _ : st)
+        {
+            std::size_t n = 0;
+            for(auto && line : s | ranges::views::lines)
+                n += static_cast<std::size_t>(line.end() - line.begin());
+            benchmark::DoNotOptimize(n);
+        }
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    void BM_split_newline(benchmark::State & st)
+    {
+        auto const & s = input();
+        for(auto _ : st)
+        {
+            std::size_t n = 0;
+            for(auto && line : s | ranges::views::split('\n'))
+                for(auto it = ranges::begin(line); it != ranges::end(line); ++it)
+                    ++n;
+            benchmark::DoNotOptimize(n);
+        }
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    BENCHMARK(BM_getlines);
+    BENCHMARK(BM_lines);
+    BENCHMARK(BM_split_newline);
+} // namespace
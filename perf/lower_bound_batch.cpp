@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Looks up 2^14 random keys in sorted arrays of 2^10 to 2^24 integers, one
+// ranges::lower_bound at a time and with lower_bound_batch, and with
+// lower_bound_batch given the keys in sorted order. The argument is the log2
+// of the size of the array.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/lower_bound_batch.hpp>
+
+namespace
+{
+    constexpr std::size_t query_count = 1 << 14;
+
+    struct inputs
+    {
+        std::vector<std::uint32_t> sorted_, queries_, sorted_queries_;
+        std::vector<std::ptrdiff_t> out_;
+
+        explicit inputs(std::int64_t log_size)
+          : out_(query_count)
+        {
+            std::mt19937 gen(1);
+            sorted_.resize(std::size_t(1) << log_size);
+            for(auto & i : sorted_)
+                i = gen();
+            std::sort(sorted_.begin(), sorted_.end());
+            queries_.resize(query_count);
+            for(auto & q : queries_)
+                q = gen();
+            sorted_queries_ = queries_;
+            std::sort(sorted_queries_.begin(), sorted_queries_.end());
+        }
+    };
+
+    void BM_lower_bound(benchmark::State & st)
+    {
+        inputs in(st.range(0));
+        for(auto _ : st)
+        {
+            auto out = in.out_.begin();
+            for(auto q : in.queries_)
+                *out++ = ranges::lower_bound(in.sorted_, q) - in.sorted_.begin();
+            benchmark::DoNotOptimize(in.out_.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(query_count));
+    }
+
+    void BM_lower_bound_batch(benchmark::State & st)
+    {
+        inputs in(st.range(0));
+        for(auto _ : st)
+        {
+            ranges::lower_bound_batch(in.sorted_, in.queries_, in.out_.begin());
+            benchmark::DoNotOptimize(in.out_.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(query_count));
+    }
+
+    void BM_lower_bound_batch_sorted(benchmark::State & st)
+    {
+        inputs in(st.range(0));
+        for(auto _ : st)
+        {
+            ranges::lower_bound_batch(
+                ranges::sorted_queries, in.sorted_, in.sorted_queries_, in.out_.begin());
+            benchmark::DoNotOptimize(in.out_.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(query_count));
+    }
+
+    BENCHMARK(BM_lower_bound)->DenseRange(10, 24, 2);
+    BENCHMARK(BM_lower_bound_batch)->DenseRange(10, 24, 2);
+    BENCHMARK(BM_lower_bound_batch_sorted)->DenseRange(10, 24, 2);
+} // namespace
@@ -0,0 +1,79 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Parses 2^10 to 2^16 numbers from a string with views::istream and sums them
+// over three passes: parsing the string again for each pass, and parsing it
+// once into views::memoize. The argument is the log2 of the number of numbers.
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/istream.hpp>
+#include <range/v3/view/memoize.hpp>
+
+namespace
+{
+    std::string numbers(benchmark::State const & st)
+    {
+        std::string s;
+        for(std::int64_t i = 0; i < (std::int64_t(1) << st.range(0)); ++i)
+            s += std::to_string(i * 7919 % 100003) + ' ';
+        return s;
+    }
+
+    template<typename Rng>
+    std::int64_t sum(Rng && rng)
+    {
+        std::int64_t n = 0;
+        RANGES_FOR(int i, rng)
+            n += i;
+        return n;
+    }
+
+    void BM_parse_each_pass(benchmark::State & st)
+    {
+        auto const s = numbers(st);
+        for(auto _ : st)
+        {
+            std::int64_t n = 0;
+            for(int pass = 0; pass < 3; ++pass)
+            {
+                std::istringstream in{s};
+                n += sum(ranges::istream<int>(in));
+            }
+            benchmark::DoNotOptimize(n);
+        }
+        st.SetItemsProcessed(st.iterations() * (std::int64_t(3) << st.range(0)));
+    }
+
+    void BM_memoize(benchmark::State & st)
+    {
+        auto const s = numbers(st);
+        for(auto _ : st)
+        {
+            std::istringstream in{s};
+            auto ints = ranges::istream<int>(in) | ranges::views::memoize;
+            std::int64_t n = 0;
+            for(int pass = 0; pass < 3; ++pass)
+                n += sum(ints);
+            benchmark::DoNotOptimize(n);
+        }
+        st.SetItemsProcessed(st.iterations() * (std::int64_t(3) << st.range(0)));
+    }
+} // namespace
+
+BENCHMARK(BM_parse_each_pass)->DenseRange(10, 16, 3);
+BENCHMARK(BM_memoize)->DenseRange(10, 16, 3);
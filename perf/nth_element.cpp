@@ -0,0 +1,161 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Finds the median and the 99th percentile of 2^10 to 2^24 random integers,
+// and of 2^20 integers in a few patterns, with std::nth_element and
+// ranges::nth_element, and the 1st to 99th percentiles at once with one
+// ranges::nth_elements, one ranges::nth_element each, and a sort. The
+// argument is the log2 of the number of elements.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/nth_element.hpp>
+
+namespace
+{
+    enum pattern
+    {
+        random,
+        sorted,
+        organ_pipe,
+        few_distinct
+    };
+
+    std::vector<std::uint32_t> make_input(std::int64_t log_size, pattern pat,
+                                          std::uint32_t seed)
+    {
+        std::mt19937 gen(seed);
+        std::vector<std::uint32_t> v(std::size_t(1) << log_size);
+        for(auto & i : v)
+            i = pat == few_distinct ? gen() % 16u : gen();
+        if(pat == sorted || pat == organ_pipe)
+            std::sort(v.begin(), v.end());
+        if(pat == organ_pipe)
+            std::reverse(v.begin() + std::ptrdiff_t(v.size() / 2), v.end());
+        return v;
+    }
+
+    // Each run takes the next of several inputs, so that the branch predictor
+    // cannot learn the branches of a small one by heart.
+    template<typename F>
+    void run(benchmark::State & st, pattern pat, F select)
+    {
+        std::vector<std::vector<std::uint32_t>> ins;
+        for(std::int64_t i = 0; i < std::max<std::int64_t>(1, 20 - st.range(0)); ++i)
+            ins.push_back(make_input(st.range(0), pat, std::uint32_t(i + 1)));
+        std::size_t next = 0;
+        std::vector<std::uint32_t> v;
+        for(auto _ : st)
+        {
+            st.PauseTiming();
+            v = ins[next++ % ins.size()];
+            st.ResumeTiming();
+            select(v);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(v.size()));
+    }
+
+    struct std_median
+    {
+        template<typename V>
+        void operator()(V & v) const
+        {
+            std::nth_element(
+                v.begin(), v.begin() + std::ptrdiff_t(v.size() / 2), v.end());
+        }
+    };
+    struct ranges_median
+    {
+        template<typename V>
+        void operator()(V & v) const
+        {
+            ranges::nth_element(v, v.begin() + std::ptrdiff_t(v.size() / 2));
+        }
+    };
+    struct std_p99
+    {
+        template<typename V>
+        void operator()(V & v) const
+        {
+            std::nth_element(v.begin(), v.begin() + std::ptrdiff_t(v.size() / 100 * 99),
+                             v.end());
+        }
+    };
+    struct ranges_p99
+    {
+        template<typename V>
+        void operator()(V & v) const
+        {
+            ranges::nth_element(v, v.begin() + std::ptrdiff_t(v.size() / 100 * 99));
+        }
+    };
+
+    template<typename Select>
+    void BM_random(benchmark::State & st)
+    {
+        run(st, random, Select{});
+    }
+
+    template<typename Select>
+    void BM_patterns(benchmark::State & st)
+    {
+        run(st, static_cast<pattern>(st.range(1)), Select{});
+    }
+
+    std::vector<std::ptrdiff_t> percentiles(std::size_t n)
+    {
+        std::vector<std::ptrdiff_t> ranks;
+        for(std::size_t p = 1; p < 100; ++p)
+            ranks.push_back(std::ptrdiff_t(n * p / 100));
+        return ranks;
+    }
+
+    void BM_percentiles_nth_elements(benchmark::State & st)
+    {
+        run(st, random, [](std::vector<std::uint32_t> & v) {
+            ranges::nth_elements(v, percentiles(v.size()));
+        });
+    }
+
+    void BM_percentiles_nth_element(benchmark::State & st)
+    {
+        run(st, random, [](std::vector<std::uint32_t> & v) {
+            for(auto r : percentiles(v.size()))
+                ranges::nth_element(v, v.begin() + r);
+        });
+    }
+
+    void BM_percentiles_sort(benchmark::State & st)
+    {
+        run(st, random, [](std::vector<std::uint32_t> & v) {
+            std::sort(v.begin(), v.end());
+        });
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_random, std_median)->DenseRange(10, 24, 7);
+BENCHMARK_TEMPLATE(BM_random, ranges_median)->DenseRange(10, 24, 7);
+BENCHMARK_TEMPLATE(BM_random, std_p99)->DenseRange(10, 24, 7);
+BENCHMARK_TEMPLATE(BM_random, ranges_p99)->DenseRange(10, 24, 7);
+BENCHMARK_TEMPLATE(BM_patterns, std_median)
+    ->ArgsProduct({{20}, {sorted, organ_pipe, few_distinct}});
+BENCHMARK_TEMPLATE(BM_patterns, ranges_median)
+    ->ArgsProduct({{20}, {sorted, organ_pipe, few_distinct}});
+BENCHMARK(BM_percentiles_nth_elements)->Arg(20);
+BENCHMARK(BM_percentiles_nth_element)->Arg(20);
+BENCHMARK(BM_percentiles_sort)->Arg(20);
@@ -0,0 +1,172 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares the sequential and parallel execution policies of the algorithms
+// that accept one, over vectors and over views::iota | views::transform.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+
+namespace
+{
+    std::vector<std::uint32_t> random_data(std::size_t n)
+    {
+        std::mt19937 gen(42);
+        std::vector<std::uint32_t> v(n);
+        for(auto & x : v)
+            x = gen();
+        return v;
+    }
+
+    template<typename Policy>
+    void BM_sort(benchmark::State & st)
+    {
+        auto const data = random_data(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+        {
+            st.PauseTiming();
+            auto v = data;
+            st.ResumeTiming();
+            ranges::sort(Policy{}, v);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    template<typename Policy>
+    void BM_stable_sort(benchmark::State & st)
+    {
+        auto const data = random_data(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+        {
+            st.PauseTiming();
+            auto v = data;
+            st.ResumeTiming();
+            ranges::stable_sort(Policy{}, v);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    // Like BM_stable_sort, with one scratch buffer for all of the sorts.
+    template<typename Policy>
+    void BM_stable_sort_scratch(benchmark::State & st)
+    {
+        auto const data = random_data(static_cast<std::size_t>(st.range(0)));
+        ranges::scratch_buffer<std::uint32_t> buf;
+        for(auto _ : st)
+        {
+            st.PauseTiming();
+            auto v = data;
+            st.ResumeTiming();
+            ranges::stable_sort(Policy{}, v, buf);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    template<typename Policy>
+    void BM_transform(benchmark::State & st)
+    {
+        auto const data = random_data(static_cast<std::size_t>(st.range(0)));
+        std::vector<double> out(data.size());
+        for(auto _ : st)
+        {
+            ranges::transform(
+                Policy{}, data, out.begin(), [](std::uint32_t x) { return x * 0.5; });
+            benchmark::DoNotOptimize(out.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    template<typename Policy>
+    void BM_count_if_view(benchmark::State & st)
+    {
+        auto const n = static_cast<int>(st.range(0));
+        auto rng = ranges::views::iota(0, n) |
+                   ranges::views::transform([](int i) { return i * 2654435761u; });
+        for(auto _ : st)
+            benchmark::DoNotOptimize(
+                ranges::count_if(Policy{}, rng, [](unsigned x) { return x % 7 == 0; }));
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    template<typename Policy>
+    void BM_accumulate(benchmark::State & st)
+    {
+        auto const data = random_data(static_cast<std::size_t>(st.range(0)));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(
+                ranges::accumulate(Policy{}, data, std::uint64_t{0}));
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    template<typename Policy>
+    void BM_copy_if(benchmark::State & st)
+    {
+        auto const data = random_data(static_cast<std::size_t>(st.range(0)));
+        std::vector<std::uint32_t> out(data.size());
+        for(auto _ : st)
+        {
+            ranges::copy_if(
+                Policy{}, data, out.begin(), [](std::uint32_t x) { return x & 1; });
+            benchmark::DoNotOptimize(out.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    template<typename Policy>
+    void BM_partial_sum(benchmark::State & st)
+    {
+        auto const data = random_data(static_cast<std::size_t>(st.range(0)));
+        std::vector<std::uint32_t> out(data.size());
+        for(auto _ : st)
+        {
+            ranges::partial_sum(Policy{}, data, out.begin());
+            benchmark::DoNotOptimize(out.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    using seq = ranges::execution::sequenced_policy;
+    using par = ranges::execution::parallel_policy;
+
+#define RANGES_PARALLEL_BENCHMARK(NAME)                              \
+    BENCHMARK_TEMPLATE(NAME, seq)->RangeMultiplier(10)->Range(1e4, 1e7); \
+    BENCHMARK_TEMPLATE(NAME, par)->RangeMultiplier(10)->Range(1e4, 1e7)
+
+    RANGES_PARALLEL_BENCHMARK(BM_sort);
+    RANGES_PARALLEL_BENCHMARK(BM_stable_sort);
+    RANGES_PARALLEL_BENCHMARK(BM_stable_sort_scratch);
+    // Small sorts, where getting a temporary buffer every time costs the most.
+    BENCHMARK_TEMPLATE(BM_stable_sort, seq)->RangeMultiplier(4)->Range(64, 4096);
+    BENCHMARK_TEMPLATE(BM_stable_sort_scratch, seq)->RangeMultiplier(4)->Range(64, 4096);
+    RANGES_PARALLEL_BENCHMARK(BM_transform);
+    RANGES_PARALLEL_BENCHMARK(BM_count_if_view);
+    RANGES_PARALLEL_BENCHMARK(BM_accumulate);
+    RANGES_PARALLEL_BENCHMARK(BM_copy_if);
+    RANGES_PARALLEL_BENCHMARK(BM_partial_sum);
+} // namespace
@@ -0,0 +1,138 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sorts integers, floats, and records by an integral member with the radix sorts
+// and with the comparison sort.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/algorithm/sort.hpp>
+
+namespace
+{
+    struct record
+    {
+        std::int64_t timestamp;
+        std::uint64_t id;
+    };
+
+    template<typename T>
+    std::vector<T> random_keys(std::int64_t n)
+    {
+        std::mt19937_64 gen(42);
+        std::vector<T> v(static_cast<std::size_t>(n));
+        for(auto & t : v)
+            t = static_cast<T>(gen());
+        return v;
+    }
+
+    std::vector<double> random_doubles(std::int64_t n)
+    {
+        std::mt19937_64 gen(42);
+        std::normal_distribution<double> dist(0, 1e6);
+        std::vector<double> v(static_cast<std::size_t>(n));
+        for(auto & d : v)
+            d = dist(gen);
+        return v;
+    }
+
+    // Timestamps within a day of each other: their high bytes are all equal.
+    std::vector<record> random_records(std::int64_t n)
+    {
+        std::mt19937_64 gen(42);
+        std::vector<record> v(static_cast<std::size_t>(n));
+        std::uint64_t id = 0;
+        for(auto & r : v)
+            r = {1700000000000 + static_cast<std::int64_t>(gen() % 86400000), id++};
+        return v;
+    }
+
+    template<typename Make, typename Sort>
+    void run(benchmark::State & st, Make make, Sort sort)
+    {
+        auto const input = make(st.range(0));
+        for(auto _ : st)
+        {
+            st.PauseTiming();
+            auto v = input;
+            st.ResumeTiming();
+            sort(v);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    auto const by_time = &record::timestamp;
+
+    void BM_u64_sort(benchmark::State & st)
+    {
+        run(st, random_keys<std::uint64_t>, [](auto & v) { ranges::sort(v); });
+    }
+    void BM_u64_radix_sort(benchmark::State & st)
+    {
+        run(st, random_keys<std::uint64_t>, [](auto & v) { ranges::radix_sort(v); });
+    }
+    void BM_u64_american_flag_sort(benchmark::State & st)
+    {
+        run(st, random_keys<std::uint64_t>, [](auto & v) {
+            ranges::american_flag_sort(v);
+        });
+    }
+    void BM_i32_sort(benchmark::State & st)
+    {
+        run(st, random_keys<std::int32_t>, [](auto & v) { ranges::sort(v); });
+    }
+    void BM_i32_radix_sort(benchmark::State & st)
+    {
+        run(st, random_keys<std::int32_t>, [](auto & v) { ranges::radix_sort(v); });
+    }
+    void BM_double_sort(benchmark::State & st)
+    {
+        run(st, random_doubles, [](auto & v) { ranges::sort(v); });
+    }
+    void BM_double_radix_sort(benchmark::State & st)
+    {
+        run(st, random_doubles, [](auto & v) { ranges::radix_sort(v); });
+    }
+    void BM_records_sort(benchmark::State & st)
+    {
+        run(st, random_records, [](auto & v) {
+            ranges::sort(v, ranges::less{}, by_time);
+        });
+    }
+    void BM_records_radix_sort(benchmark::State & st)
+    {
+        run(st, random_records, [](auto & v) { ranges::radix_sort(v, by_time); });
+    }
+    void BM_records_american_flag_sort(benchmark::State & st)
+    {
+        run(st, random_records, [](auto & v) {
+            ranges::american_flag_sort(v, by_time);
+        });
+    }
+
+    BENCHMARK(BM_u64_sort)->Arg(1 << 10)->Arg(1 << 20);
+    BENCHMARK(BM_u64_radix_sort)->Arg(1 << 10)->Arg(1 << 20);
+    BENCHMARK(BM_u64_american_flag_sort)->Arg(1 << 10)->Arg(1 << 20);
+    BENCHMARK(BM_i32_sort)->Arg(1 << 20);
+    BENCHMARK(BM_i32_radix_sort)->Arg(1 << 20);
+    BENCHMARK(BM_double_sort)->Arg(1 << 20);
+    BENCHMARK(BM_double_radix_sort)->Arg(1 << 20);
+    BENCHMARK(BM_records_sort)->Arg(1 << 20);
+    BENCHMARK(BM_records_radix_sort)->Arg(1 << 20);
+    BENCHMARK(BM_records_american_flag_sort)->Arg(1 << 20);
+} // namespace
@@ -0,0 +1,77 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Fills 2^16 64-bit integers from std::mt19937_64, xoshiro256starstar,
+// philox4x32 and philox4x64, and 2^16 doubles in [0, 1) from views::random and
+// from std::mt19937_64 through std::uniform_real_distribution.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/generate.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/random.hpp>
+#include <range/v3/view/take.hpp>
+
+namespace
+{
+    constexpr std::size_t size = 1 << 16;
+
+    template<typename Engine>
+    void BM_engine(benchmark::State & st)
+    {
+        std::vector<std::uint64_t> v(size);
+        Engine gen;
+        for(auto _ : st)
+        {
+            ranges::generate(v, [&] { return static_cast<std::uint64_t>(gen()); });
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(size));
+    }
+
+    void BM_mt19937_64_uniform_real(benchmark::State & st)
+    {
+        std::vector<double> v(size);
+        std::mt19937_64 gen;
+        std::uniform_real_distribution<double> dist;
+        for(auto _ : st)
+        {
+            ranges::generate(v, [&] { return dist(gen); });
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(size));
+    }
+
+    void BM_view_random(benchmark::State & st)
+    {
+        std::vector<double> v(size);
+        for(auto _ : st)
+        {
+            ranges::copy(ranges::views::random<double>(1) | ranges::views::take(size),
+                         v.begin());
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(size));
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_engine, std::mt19937_64);
+BENCHMARK_TEMPLATE(BM_engine, ranges::xoshiro256starstar);
+BENCHMARK_TEMPLATE(BM_engine, ranges::philox4x32);
+BENCHMARK_TEMPLATE(BM_engine, ranges::philox4x64);
+BENCHMARK(BM_mt19937_64_uniform_real);
+BENCHMARK(BM_view_random);
@@ -0,0 +1,108 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Samples 100 of 2^10 to 2^22 integers from a vector with std::sample and
+// ranges::sample, and from a stream of unknown length with ranges::sample, and
+// takes the 100 elements of views::sample of a vector. The argument is the log2
+// of the number of elements.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/sample.hpp>
+#include <range/v3/view/generate.hpp>
+#include <range/v3/view/sample.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/take_while.hpp>
+
+namespace
+{
+    constexpr std::ptrdiff_t sample_size = 100;
+
+    std::vector<std::uint32_t> make_input(std::int64_t log_size)
+    {
+        std::vector<std::uint32_t> v(std::size_t(1) << log_size);
+        std::mt19937 gen(1);
+        for(auto & i : v)
+            i = gen();
+        return v;
+    }
+
+    // An input range of the integers 0 to n - 1 that does not know its size.
+    auto make_stream(std::uint32_t n)
+    {
+        return ranges::views::generate([i = 0u]() mutable { return i++; }) |
+               ranges::views::take_while([n](std::uint32_t i) { return i < n; });
+    }
+
+    void BM_std_sample_vector(benchmark::State & st)
+    {
+        auto const v = make_input(st.range(0));
+        std::vector<std::uint32_t> out(sample_size);
+        std::mt19937 gen(2);
+        for(auto _ : st)
+        {
+            std::sample(v.begin(), v.end(), out.begin(), sample_size, gen);
+            benchmark::DoNotOptimize(out.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    void BM_ranges_sample_vector(benchmark::State & st)
+    {
+        auto const v = make_input(st.range(0));
+        std::vector<std::uint32_t> out(sample_size);
+        std::mt19937 gen(2);
+        for(auto _ : st)
+        {
+            ranges::sample(v, out.begin(), sample_size, gen);
+            benchmark::DoNotOptimize(out.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    void BM_ranges_sample_stream(benchmark::State & st)
+    {
+        auto const n = std::uint32_t(1) << st.range(0);
+        std::vector<std::uint32_t> out(sample_size);
+        std::mt19937 gen(2);
+        for(auto _ : st)
+        {
+            ranges::sample(make_stream(n), out.begin(), sample_size, gen);
+            benchmark::DoNotOptimize(out.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    void BM_view_sample(benchmark::State & st)
+    {
+        auto const v = make_input(st.range(0));
+        std::mt19937 gen(2);
+        for(auto _ : st)
+        {
+            std::uint32_t sum = 0;
+            for(auto i : v | ranges::views::sample(sample_size, gen))
+                sum += i;
+            benchmark::DoNotOptimize(sum);
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+} // namespace
+
+BENCHMARK(BM_std_sample_vector)->DenseRange(10, 22, 6);
+BENCHMARK(BM_ranges_sample_vector)->DenseRange(10, 22, 6);
+BENCHMARK(BM_ranges_sample_stream)->DenseRange(10, 22, 6);
+BENCHMARK(BM_view_sample)->DenseRange(10, 22, 6);
@@ -0,0 +1,177 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Walks flattened sequences with the algorithms that visit them a segment at a
+// time, and with the plain iterator loop that every other algorithm uses.
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/join.hpp>
+
+namespace
+{
+    // Small enough to stay in cache, so that the loops rather than memory set
+    // the pace.
+    std::vector<std::vector<int>> events(std::size_t outer, std::size_t inner)
+    {
+        std::vector<std::vector<int>> vv(outer);
+        int n = 0;
+        for(auto & v : vv)
+            for(std::size_t i = 0; i < inner; ++i, ++n)
+                v.push_back(n % 1000);
+        return vv;
+    }
+
+    // The loop every algorithm used to run.
+    template<typename Rng>
+    std::int64_t loop_sum(Rng & rng)
+    {
+        std::int64_t sum = 0;
+        for(auto it = ranges::begin(rng), last = ranges::end(rng); it != last; ++it)
+            sum += *it;
+        return sum;
+    }
+
+    template<typename Rng>
+    std::int64_t for_each_sum(Rng & rng)
+    {
+        std::int64_t sum = 0;
+        ranges::for_each(rng, [&](int i) { sum += i; });
+        return sum;
+    }
+
+    void BM_join_loop(benchmark::State & st)
+    {
+        auto vv = events(st.range(0), st.range(1));
+        auto rng = vv | ranges::views::join;
+        for(auto _ : st)
+            benchmark::DoNotOptimize(loop_sum(rng));
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(1));
+    }
+
+    void BM_join_for_each(benchmark::State & st)
+    {
+        auto vv = events(st.range(0), st.range(1));
+        auto rng = vv | ranges::views::join;
+        for(auto _ : st)
+            benchmark::DoNotOptimize(for_each_sum(rng));
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(1));
+    }
+
+    void BM_join_accumulate(benchmark::State & st)
+    {
+        auto vv = events(st.range(0), st.range(1));
+        auto rng = vv | ranges::views::join;
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::accumulate(rng, std::int64_t(0)));
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(1));
+    }
+
+    void BM_join_count_if(benchmark::State & st)
+    {
+        auto vv = events(st.range(0), st.range(1));
+        auto rng = vv | ranges::views::join;
+        for(auto _ : st)
+            benchmark::DoNotOptimize(
+                ranges::count_if(rng, [](int i) { return i % 7 == 3; }));
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(1));
+    }
+
+    void BM_join_copy(benchmark::State & st)
+    {
+        auto vv = events(st.range(0), st.range(1));
+        auto rng = vv | ranges::views::join;
+        std::vector<int> out(st.range(0) * st.range(1));
+        for(auto _ : st)
+        {
+            ranges::copy(rng, out.begin());
+            benchmark::DoNotOptimize(out.data());
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(1));
+    }
+
+    // The baseline: a hand-written nested loop.
+    void BM_nested_loop(benchmark::State & st)
+    {
+        auto vv = events(st.range(0), st.range(1));
+        for(auto _ : st)
+        {
+            std::int64_t sum = 0;
+            for(auto const & v : vv)
+                for(int i : v)
+                    sum += i;
+            benchmark::DoNotOptimize(sum);
+        }
+        st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(1));
+    }
+
+    void BM_concat_loop(benchmark::State & st)
+    {
+        auto vv = events(3, st.range(0));
+        auto rng = ranges::views::concat(vv[0], vv[1], vv[2]);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(loop_sum(rng));
+        st.SetItemsProcessed(st.iterations() * 3 * st.range(0));
+    }
+
+    void BM_concat_for_each(benchmark::State & st)
+    {
+        auto vv = events(3, st.range(0));
+        auto rng = ranges::views::concat(vv[0], vv[1], vv[2]);
+        for(auto _ : st)
+            benchmark::DoNotOptimize(for_each_sum(rng));
+        st.SetItemsProcessed(st.iterations() * 3 * st.range(0));
+    }
+
+    void BM_deque_loop(benchmark::State & st)
+    {
+        auto const vv = events(1, st.range(0));
+        std::deque<int> dq(vv[0].begin(), vv[0].end());
+        for(auto _ : st)
+            benchmark::DoNotOptimize(loop_sum(dq));
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    void BM_deque_for_each(benchmark::State & st)
+    {
+        auto const vv = events(1, st.range(0));
+        std::deque<int> dq(vv[0].begin(), vv[0].end());
+        for(auto _ : st)
+            benchmark::DoNotOptimize(for_each_sum(dq));
+        st.SetItemsProcessed(st.iterations() * st.range(0));
+    }
+
+    void join_sizes(benchmark::internal::Benchmark * b)
+    {
+        b->Args({200, 64})->Args({1000, 10})->Args({20, 1000});
+    }
+
+    BENCHMARK(BM_nested_loop)->Apply(join_sizes);
+    BENCHMARK(BM_join_loop)->Apply(join_sizes);
+    BENCHMARK(BM_join_for_each)->Apply(join_sizes);
+    BENCHMARK(BM_join_accumulate)->Apply(join_sizes);
+    BENCHMARK(BM_join_count_if)->Apply(join_sizes);
+    BENCHMARK(BM_join_copy)->Apply(join_sizes);
+    BENCHMARK(BM_concat_loop)->Arg(1 << 12);
+    BENCHMARK(BM_concat_for_each)->Arg(1 << 12);
+    BENCHMARK(BM_deque_loop)->Arg(1 << 14);
+    BENCHMARK(BM_deque_for_each)->Arg(1 << 14);
+} // namespace
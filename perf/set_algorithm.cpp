@@ -0,0 +1,157 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Intersects, subtracts, and tests the inclusion of sorted sequences whose
+// lengths differ by a matrix of ratios, with the algorithms that gallop through
+// the longer sequence and with the element-at-a-time loops of the standard
+// library. The longer sequence has 2^20 elements; the argument is the ratio.
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/view/set_algorithm.hpp>
+
+namespace
+{
+    constexpr std::int64_t long_size = 1 << 20;
+
+    std::vector<int> sorted_ints(std::int64_t n, unsigned seed)
+    {
+        std::mt19937 gen(seed);
+        std::vector<int> v(static_cast<std::size_t>(n));
+        for(auto & i : v)
+            i = static_cast<int>(gen() >> 2);
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+
+    // Half of the elements of the short sequence are in the long one, and half
+    // are not. All of those of the subset are.
+    struct inputs
+    {
+        std::vector<int> long_, short_, subset_;
+
+        explicit inputs(std::int64_t ratio)
+          : long_(sorted_ints(long_size, 1))
+        {
+            auto const other = sorted_ints(long_size / ratio, 2);
+            auto const step = static_cast<std::size_t>(ratio);
+            for(std::size_t i = 0; i < other.size(); ++i)
+            {
+                short_.push_back(i % 2 ? other[i] : long_[i * step]);
+                subset_.push_back(long_[i * step]);
+            }
+            std::sort(short_.begin(), short_.end());
+        }
+    };
+
+    void BM_intersection_std(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        std::vector<int> out;
+        for(auto _ : st)
+        {
+            out.clear();
+            std::set_intersection(in.short_.begin(),
+                                  in.short_.end(),
+                                  in.long_.begin(),
+                                  in.long_.end(),
+                                  std::back_inserter(out));
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+
+    void BM_intersection(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        std::vector<int> out;
+        for(auto _ : st)
+        {
+            out.clear();
+            ranges::set_intersection(in.short_, in.long_, ranges::back_inserter(out));
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+
+    void BM_intersection_view(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(
+                ranges::distance(ranges::views::set_intersection(in.short_, in.long_)));
+    }
+
+    void BM_difference_std(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        std::vector<int> out;
+        for(auto _ : st)
+        {
+            out.clear();
+            std::set_difference(in.short_.begin(),
+                                in.short_.end(),
+                                in.long_.begin(),
+                                in.long_.end(),
+                                std::back_inserter(out));
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+
+    void BM_difference(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        std::vector<int> out;
+        for(auto _ : st)
+        {
+            out.clear();
+            ranges::set_difference(in.short_, in.long_, ranges::back_inserter(out));
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+
+    void BM_includes_std(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(std::includes(
+                in.long_.begin(), in.long_.end(), in.subset_.begin(), in.subset_.end()));
+    }
+
+    void BM_includes(benchmark::State & st)
+    {
+        inputs const in(st.range(0));
+        for(auto _ : st)
+            benchmark::DoNotOptimize(ranges::includes(in.long_, in.subset_));
+    }
+
+    void ratios(benchmark::internal::Benchmark * b)
+    {
+        for(std::int64_t ratio : {1, 4, 16, 64, 1024, 16384})
+            b->Arg(ratio);
+    }
+
+    BENCHMARK(BM_intersection_std)->Apply(ratios);
+    BENCHMARK(BM_intersection)->Apply(ratios);
+    BENCHMARK(BM_intersection_view)->Apply(ratios);
+    BENCHMARK(BM_difference_std)->Apply(ratios);
+    BENCHMARK(BM_difference)->Apply(ratios);
+    BENCHMARK(BM_includes_std)->Apply(ratios);
+    BENCHMARK(BM_includes)->Apply(ratios);
+} // namespace
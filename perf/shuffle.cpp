@@ -0,0 +1,74 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Shuffles 2^16 to 2^26 32-bit integers with std::shuffle, ranges::shuffle and
+// ranges::bucket_shuffle, with std::mt19937_64 and std::mt19937. The argument
+// is the log2 of the number of elements.
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/utility/memory.hpp>
+
+namespace
+{
+    template<typename Gen, typename F>
+    void run(benchmark::State & st, F shuffle)
+    {
+        std::vector<std::uint32_t> v(std::size_t(1) << st.range(0));
+        std::iota(v.begin(), v.end(), 0u);
+        Gen gen(1);
+        for(auto _ : st)
+        {
+            shuffle(v, gen);
+            benchmark::DoNotOptimize(v.data());
+        }
+        st.SetItemsProcessed(st.iterations() * std::int64_t(v.size()));
+    }
+
+    template<typename Gen>
+    void BM_std_shuffle(benchmark::State & st)
+    {
+        run<Gen>(st, [](std::vector<std::uint32_t> & v, Gen & gen) {
+            std::shuffle(v.begin(), v.end(), gen);
+        });
+    }
+
+    template<typename Gen>
+    void BM_ranges_shuffle(benchmark::State & st)
+    {
+        run<Gen>(st, [](std::vector<std::uint32_t> & v, Gen & gen) {
+            ranges::shuffle(v, gen);
+        });
+    }
+
+    template<typename Gen>
+    void BM_bucket_shuffle(benchmark::State & st)
+    {
+        ranges::scratch_buffer<std::uint32_t> buf;
+        run<Gen>(st, [&buf](std::vector<std::uint32_t> & v, Gen & gen) {
+            ranges::bucket_shuffle(v, buf, gen);
+        });
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_std_shuffle, std::mt19937_64)->DenseRange(16, 26, 2);
+BENCHMARK_TEMPLATE(BM_ranges_shuffle, std::mt19937_64)->DenseRange(16, 26, 2);
+BENCHMARK_TEMPLATE(BM_bucket_shuffle, std::mt19937_64)->DenseRange(22, 26, 2);
+BENCHMARK_TEMPLATE(BM_std_shuffle, std::mt19937)->DenseRange(16, 26, 2);
+BENCHMARK_TEMPLATE(BM_ranges_shuffle, std::mt19937)->DenseRange(16, 26, 2);
@@ -0,0 +1,128 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Converts views that are not sized to containers: filters that keep 15 in 16
+// and 1 in 2 of 2^10 to 2^22 ints, a join of vectors of 16 ints and a join with
+// ", " of 8-character strings. Each is made with ranges::to, which reserves
+// room from ranges::size_hint, and, as it was before there were size hints,
+// from the iterators of views::common. The argument is the log2 of the number
+// of elements. A filter may keep none of its elements, so it reserves no room
+// and grows as it goes; it still reads its base once.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/common.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/join.hpp>
+
+namespace
+{
+    std::vector<int> ints(benchmark::State const & st)
+    {
+        std::vector<int> v(std::size_t(1) << st.range(0));
+        std::uint32_t x = 1;
+        for(int & i : v)
+            i = static_cast<int>(x = x * 1664525u + 1013904223u);
+        return v;
+    }
+
+    template<int N>
+    auto filtered(std::vector<int> const & v)
+    {
+        return v | ranges::views::filter([](int i) { return i % N != 0; });
+    }
+
+    std::vector<std::vector<int>> chunks(benchmark::State const & st)
+    {
+        return std::vector<std::vector<int>>((std::size_t(1) << st.range(0)) / 16,
+                                             std::vector<int>(16, 1));
+    }
+
+    std::vector<std::string> words(benchmark::State const & st)
+    {
+        return std::vector<std::string>((std::size_t(1) << st.range(0)) / 10,
+                                        std::string(8, 'x'));
+    }
+
+    template<typename F>
+    void run(benchmark::State & st, F convert)
+    {
+        for(auto _ : st)
+        {
+            auto c = convert();
+            benchmark::DoNotOptimize(c.data());
+        }
+        st.SetItemsProcessed(st.iterations() * (std::int64_t(1) << st.range(0)));
+    }
+
+    template<typename C, typename Rng>
+    C from_common(Rng && rng)
+    {
+        auto common = static_cast<Rng &&>(rng) | ranges::views::common;
+        return C(ranges::begin(common), ranges::end(common));
+    }
+
+    template<int N>
+    void BM_filter_common(benchmark::State & st)
+    {
+        auto const v = ints(st);
+        run(st, [&] { return from_common<std::vector<int>>(filtered<N>(v)); });
+    }
+    template<int N>
+    void BM_filter_to(benchmark::State & st)
+    {
+        auto const v = ints(st);
+        run(st, [&] { return filtered<N>(v) | ranges::to<std::vector>(); });
+    }
+
+    void BM_join_common(benchmark::State & st)
+    {
+        auto const vv = chunks(st);
+        run(st, [&] { return from_common<std::vector<int>>(vv | ranges::views::join); });
+    }
+    void BM_join_to(benchmark::State & st)
+    {
+        auto const vv = chunks(st);
+        run(st, [&] { return vv | ranges::views::join | ranges::to<std::vector>(); });
+    }
+
+    void BM_join_with_common(benchmark::State & st)
+    {
+        auto const ws = words(st);
+        std::string const comma = ", ";
+        run(st, [&] {
+            return from_common<std::string>(ranges::views::join(ws, comma));
+        });
+    }
+    void BM_join_with_to(benchmark::State & st)
+    {
+        auto const ws = words(st);
+        std::string const comma = ", ";
+        run(st, [&] {
+            return ranges::views::join(ws, comma) | ranges::to<std::string>();
+        });
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_filter_common, 16)->DenseRange(10, 22, 4);
+BENCHMARK_TEMPLATE(BM_filter_to, 16)->DenseRange(10, 22, 4);
+BENCHMARK_TEMPLATE(BM_filter_common, 2)->DenseRange(10, 22, 4);
+BENCHMARK_TEMPLATE(BM_filter_to, 2)->DenseRange(10, 22, 4);
+BENCHMARK(BM_join_common)->DenseRange(10, 22, 4);
+BENCHMARK(BM_join_to)->DenseRange(10, 22, 4);
+BENCHMARK(BM_join_with_common)->DenseRange(10, 22, 4);
+BENCHMARK(BM_join_with_to)->DenseRange(10, 22, 4);
@@ -59,6 +59,28 @@ namespace
     static std::string name() { return "random_uniform_integer_sequence"; }
   };
 
+  /// Random integers drawn from a handful of distinct values
+  struct few_unique_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist{0, 15};
+    auto operator()(std::size_t) {
+      return ranges::views::generate([&]{ return dist(gen); });
+    }
+    static std::string name() { return "few_unique_integer_sequence"; }
+  };
+
+  /// Ascending integers with every 100th element replaced by a random one
+  struct nearly_sorted_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist;
+    auto operator()(std::size_t) {
+      return ranges::views::iota(0) | ranges::views::transform([&](int i) {
+        return i % 100 == 0 ? dist(gen) : i;
+      });
+    }
+    static std::string name() { return "nearly_sorted_integer_sequence"; }
+  };
+
   struct ascending_integer_sequence {
     auto operator()(std::size_t) { return ranges::views::iota(1); }
     static std::string name() { return "ascending_integer_sequence"; }
@@ -218,15 +240,20 @@ namespace
     std::cout << '#'
               << "pattern: " << seq.name() << '\n';
     std::cout << '#' << setw(19) << 'N' << setw(20) << "ranges::sort" << setw(20)
-              << "std::sort"
+              << "std::sort" << setw(20) << "speedup"
               << '\n';
     RANGES_FOR(auto p, ranges::views::zip(ranges_sort_benchmark.results,
                                          std_sort_benchmark.results)) {
       auto rs = p.first;
       auto ss = p.second;
+      // How many times faster ranges::sort is than std::sort.
+      auto const speedup = rs.mean_t.count() == 0 ? 1.0 :
+          static_cast<double>(ss.mean_t.count()) / rs.mean_t.count();
 
       std::cout << setw(20) << rs.size << setw(20) << to_millis(rs.mean_t)
-                << setw(20) << to_millis(ss.mean_t) << '\n';
+                << setw(20) << to_millis(ss.mean_t)
+                << setw(20) << std::fixed << std::setprecision(2) << speedup
+                << '\n';
     }
   }
 } // unnamed namespace
@@ -236,14 +263,19 @@ int main()
   constexpr std::size_t max_size = 2000000;
 
   print(random_uniform_integer_sequence(), 20);
+  print(few_unique_integer_sequence(), 20);
+  print(nearly_sorted_integer_sequence(), 20);
   print(ascending_integer_sequence(), 20);
   print(descending_integer_sequence(), 20);
   print(even_odd_integer_sequence(), 20);
   print(organ_pipe_integer_sequence(), 20);
 
   benchmark_sort(random_uniform_integer_sequence(), max_size);
+  benchmark_sort(few_unique_integer_sequence(), max_size);
+  benchmark_sort(nearly_sorted_integer_sequence(), max_size);
   benchmark_sort(ascending_integer_sequence(), max_size);
   benchmark_sort(descending_integer_sequence(), max_size);
+  benchmark_sort(even_odd_integer_sequence(), max_size);
   benchmark_sort(organ_pipe_integer_sequence(), max_size);
 }
 
@@ -0,0 +1,143 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Splits synthetic access-log lines into words with views::split. A contiguous
+// char range finds its delimiters with memchr; the same characters seen through
+// views::transform are not contiguous and take the element-wise search.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/view/split.hpp>
+#include <range/v3/view/transform.hpp>
+
+namespace
+{
+    std::string log_lines(std::size_t bytes)
+    {
+        static char const * const levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+        static char const * const paths[] = {
+            "/api/v1/items", "/api/v1/users/search", "/static/app.js", "/healthz"};
+        std::mt19937 gen(42);
+        std::string s;
+        while(s.size() < bytes)
+        {
+            s += "2024-03-0" + std::to_string(1 + gen() % 9) + "T12:" +
+                 std::to_string(10 + gen() % 50) + ":" + std::to_string(10 + gen() % 50) +
+                 "." + std::to_string(100 + gen() % 900) + "Z ";
+            s += levels[gen() % 4];
+            s += " [worker-" + std::to_string(gen() % 32) + "] GET ";
+            s += paths[gen() % 4];
+            s += "?id=" + std::to_string(gen() % 100000) + " " +
+                 std::to_string(gen() % 5 ? 200 : 404) + " " +
+                 std::to_string(gen() % 2000) + "ms user=u" +
+                 std::to_string(gen() % 1000) + "\n";
+        }
+        return s;
+    }
+
+    struct identity_char
+    {
+        char operator()(char c) const
+        {
+            return c;
+        }
+    };
+
+    // Walks every word as a consumer building a string_view from it would.
+    template<typename Rng>
+    std::size_t word_bytes(Rng && rng)
+    {
+        std::size_t n = 0;
+        for(auto && word : rng)
+            n += static_cast<std::size_t>(
+                ranges::distance(ranges::begin(word), ranges::end(word)));
+        return n;
+    }
+
+    std::string const & input()
+    {
+        static std::string const s = log_lines(std::size_t(1) << 22);
+        return s;
+    }
+
+    void BM_split_char(benchmark::State & st)
+    {
+        auto const & s = input();
+        for(auto _ : st)
+            benchmark::DoNotOptimize(word_bytes(ranges::views::split(s, ' ')));
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    void BM_split_char_generic(benchmark::State & st)
+    {
+        auto const & s = input();
+        auto chars = s | ranges::views::transform(identity_char{});
+        for(auto _ : st)
+            benchmark::DoNotOptimize(word_bytes(ranges::views::split(chars, ' ')));
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    void BM_split_pattern(benchmark::State & st)
+    {
+        auto const & s = input();
+        std::string const pattern = "] GET ";
+        for(auto _ : st)
+            benchmark::DoNotOptimize(word_bytes(ranges::views::split(s, pattern)));
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    void BM_split_pattern_generic(benchmark::State & st)
+    {
+        auto const & s = input();
+        std::string const pattern = "] GET ";
+        auto chars = s | ranges::views::transform(identity_char{});
+        for(auto _ : st)
+            benchmark::DoNotOptimize(word_bytes(ranges::views::split(chars, pattern)));
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    // A hand-written memchr loop, as a lower bound.
+    void BM_memchr(benchmark::State & st)
+    {
+        auto const & s = input();
+        for(auto _ : st)
+        {
+            std::size_t n = 0;
+            char const * p = s.data();
+            char const * const last = p + s.size();
+            while(true)
+            {
+                auto const q = static_cast<char const *>(
+                    std::memchr(p, ' ', static_cast<std::size_t>(last - p)));
+                n += static_cast<std::size_t>((q ? q : last) - p);
+                if(!q)
+                    break;
+                p = q + 1;
+            }
+            benchmark::DoNotOptimize(n);
+        }
+        st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(s.size()));
+    }
+
+    BENCHMARK(BM_split_char);
+    BENCHMARK(BM_split_char_generic);
+    BENCHMARK(BM_split_pattern);
+    BENCHMARK(BM_split_pattern_generic);
+    BENCHMARK(BM_memchr);
+} // namespace
@@ -0,0 +1,119 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Converts 2^8 to 2^14 rows of 16 ints, made by views::transform, to a vector
+// of vectors: with the global heap, and with ranges::to and an allocator that
+// draws them from a std::pmr::monotonic_buffer_resource over a buffer that is
+// released after each conversion. The "heap" counter is the number of calls of
+// the global operator new per conversion. The argument is the log2 of the
+// number of rows.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+
+#if RANGES_CXX_STD >= RANGES_CXX_STD_17 && __has_include(<memory_resource>)
+#include <memory_resource>
+
+namespace
+{
+    std::int64_t heap_allocations = 0;
+}
+
+void * operator new(std::size_t n)
+{
+    ++heap_allocations;
+    if(void * p = std::malloc(n != 0 ? n : 1))
+        return p;
+    throw std::bad_alloc{};
+}
+void operator delete(void * p) noexcept
+{
+    std::free(p);
+}
+void operator delete(void * p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    auto rows(benchmark::State const & st)
+    {
+        using namespace ranges;
+        return views::iota(0, int(1) << st.range(0)) | views::transform([](int i) {
+                   return views::iota(i, i + 16);
+               });
+    }
+
+    template<typename F>
+    void run(benchmark::State & st, F convert)
+    {
+        std::int64_t const before = heap_allocations;
+        for(auto _ : st)
+            convert();
+        st.counters["heap"] = benchmark::Counter(
+            double(heap_allocations - before) / double(st.iterations()));
+        st.SetItemsProcessed(st.iterations() * (std::int64_t(16) << st.range(0)));
+    }
+
+    void BM_to_heap(benchmark::State & st)
+    {
+        auto rng = rows(st);
+        run(st, [&] {
+            auto vv = rng | ranges::to<std::vector<std::vector<int>>>();
+            benchmark::DoNotOptimize(vv.data());
+        });
+    }
+
+    // What had to be written before ranges::to could take an allocator.
+    void BM_loop_arena(benchmark::State & st)
+    {
+        auto rng = rows(st);
+        std::vector<std::byte> buffer(std::size_t(128) << st.range(0));
+        run(st, [&] {
+            std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+            std::pmr::vector<std::pmr::vector<int>> vv{&arena};
+            for(auto && row : rng)
+            {
+                auto & v = vv.emplace_back();
+                for(int i : row)
+                    v.push_back(i);
+            }
+            benchmark::DoNotOptimize(vv.data());
+        });
+    }
+
+    void BM_to_arena(benchmark::State & st)
+    {
+        auto rng = rows(st);
+        std::vector<std::byte> buffer(std::size_t(128) << st.range(0));
+        run(st, [&] {
+            std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+            auto vv = ranges::to<std::pmr::vector<std::pmr::vector<int>>>(rng, &arena);
+            benchmark::DoNotOptimize(vv.data());
+        });
+    }
+} // namespace
+
+BENCHMARK(BM_to_heap)->DenseRange(8, 14, 3);
+BENCHMARK(BM_loop_arena)->DenseRange(8, 14, 3);
+BENCHMARK(BM_to_arena)->DenseRange(8, 14, 3);
+#endif
@@ -0,0 +1,166 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/permutation.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/numeric/iota.hpp>
+#include <range/v3/utility/memory.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+
+using namespace ranges;
+
+namespace
+{
+    // Every order of a few elements is about as likely as any other when they
+    // are dealt into 2^bits buckets and then shuffled bucket by bucket.
+    template<std::size_t N>
+    void test_permutations(int bits)
+    {
+        std::mt19937_64 gen;
+        std::array<int, N> a;
+        std::vector<std::array<int, N>> perms;
+        iota(a, 0);
+        do
+            perms.push_back(a);
+        while(next_permutation(a));
+
+        scratch_buffer<int> buf{static_cast<std::ptrdiff_t>(N)};
+        int const trials = 500 * static_cast<int>(perms.size());
+        std::vector<int> counts(perms.size());
+        for(int t = 0; t < trials; ++t)
+        {
+            iota(a, 0);
+            detail::bucket_shuffle_n_(
+                a.begin(), static_cast<std::ptrdiff_t>(N), buf.data(), bits, gen);
+            for(std::size_t p = 0; p < perms.size(); ++p)
+                if(perms[p] == a)
+                    ++counts[p];
+        }
+        double const expected = double(trials) / double(perms.size());
+        double chi2 = 0;
+        for(int c : counts)
+            chi2 += (c - expected) * (c - expected) / expected;
+        double const df = double(perms.size() - 1);
+        CHECK(chi2 < df + 6 * std::sqrt(2 * df));
+    }
+
+    // Checks that v is a shuffle of 0, 1, ..., and that the values in the first
+    // part of it are spread out.
+    void check_shuffled(std::vector<int> v)
+    {
+        auto const n = static_cast<double>(v.size());
+        double sum = 0;
+        constexpr int head = 100000;
+        for(int i = 0; i < head; ++i)
+            sum += v[static_cast<std::size_t>(i)];
+        // The mean of `head` of them is n / 2 give or take n / sqrt(12 head).
+        CHECK(std::abs(sum / head - n / 2) < 6 * n / std::sqrt(12.0 * head));
+        sort(v);
+        std::vector<int> w(v.size());
+        iota(w, 0);
+        CHECK(equal(v, w));
+    }
+
+    void test_large()
+    {
+        // Large enough to be dealt into buckets.
+        std::vector<int> v((std::size_t(1) << 23) + 12345);
+        iota(v, 0);
+        auto w = v;
+        std::mt19937_64 g1, g2;
+        CHECK(bucket_shuffle(v, g1) == v.end());
+        check_shuffled(v);
+
+        // A scratch buffer gives the same shuffle.
+        scratch_buffer<int> buf;
+        CHECK(bucket_shuffle(w.begin(), w.end(), buf, g2) == w.end());
+        CHECK(buf.capacity() >= static_cast<std::ptrdiff_t>(w.size()));
+        CHECK(v == w);
+
+        // And the next shuffle is a different one.
+        CHECK(bucket_shuffle(w, buf, g2) == w.end());
+        CHECK(v != w);
+    }
+
+    struct throwing_move
+    {
+        int i;
+        throwing_move(int i_)
+          : i(i_)
+        {}
+        throwing_move(throwing_move const &) = default;
+        throwing_move(throwing_move && that) noexcept(false)
+          : i(that.i)
+        {}
+        throwing_move & operator=(throwing_move const &) = default;
+        throwing_move & operator=(throwing_move && that) noexcept(false)
+        {
+            i = that.i;
+            return *this;
+        }
+    };
+
+    void test_fallbacks()
+    {
+        // Short sequences, generators that give fewer than 32 random bits at a
+        // time, and elements whose moves may throw are shuffled in place.
+        std::vector<int> v(1000);
+        iota(v, 0);
+        auto const w = v;
+        std::mt19937 g32;
+        bucket_shuffle(v, g32);
+        CHECK(is_permutation(v, w));
+        CHECK(v != w);
+        std::minstd_rand minstd;
+        bucket_shuffle(v, minstd);
+        CHECK(is_permutation(v, w));
+
+        std::vector<throwing_move> t;
+        for(int i = 0; i < 1000; ++i)
+            t.emplace_back(i);
+        scratch_buffer<throwing_move> buf;
+        CHECK(bucket_shuffle(t, buf) == t.end());
+        CHECK(buf.capacity() == 0);
+        CHECK(is_permutation(t, w, equal_to{}, &throwing_move::i));
+
+        std::vector<std::string> s{"a", "b", "c"};
+        bucket_shuffle(s);
+        CHECK(is_permutation(s, std::vector<std::string>{"a", "b", "c"}));
+
+        auto d = bucket_shuffle(std::vector<int>{1, 2, 3});
+        CPP_assert(same_as<decltype(d), dangling>);
+        (void)d;
+        std::vector<int> empty;
+        CHECK(bucket_shuffle(empty) == empty.end());
+    }
+} // namespace
+
+int main()
+{
+    test_permutations<4>(1);
+    test_permutations<5>(1);
+    test_permutations<5>(2);
+    test_large();
+    test_fallbacks();
+
+    return ::test_result();
+}
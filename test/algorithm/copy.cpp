@@ -18,8 +18,12 @@
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/view/delimit.hpp>
+#include <range/v3/view/ref.hpp>
+#include <range/v3/view/span.hpp>
+#include <range/v3/view/subrange.hpp>
 #include <range/v3/iterator/stream_iterators.hpp>
 #include "../simple_test.hpp"
+#include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
 #if RANGES_CXX_CONSTEXPR >= RANGES_CXX_CONSTEXPR_14 && RANGES_CONSTEXPR_INVOKE
@@ -83,6 +87,52 @@ int main()
         CHECK(std::strcmp(sz, buf) == 0);
     }
 
+    // Contiguous ranges of trivially copyable types are copied with memmove
+    CPP_assert(ranges::detail::memmove_copyable<float const *, float *>);
+    CPP_assert(ranges::detail::memmove_copyable<std::vector<int>::const_iterator,
+                                                std::vector<int>::iterator>);
+    CPP_assert(!ranges::detail::memmove_copyable<int const *, long *>);
+    CPP_assert(!ranges::detail::memmove_copyable<int *, int const *>);
+    CPP_assert(!ranges::detail::memmove_copyable<std::pair<int, int> const *,
+                                                 std::pair<int, int> *>);
+    {
+        std::vector<float> const src{1.f, 2.f, 3.f, 4.f, 5.f};
+        std::vector<float> dst(src.size());
+        auto res4 = ranges::copy(src, dst.begin());
+        CHECK(res4.in == src.end());
+        CHECK(res4.out == dst.end());
+        CHECK(dst == src);
+
+        std::fill(dst.begin(), dst.end(), 0.f);
+        auto res5 = ranges::copy(ranges::views::ref(src), dst.data());
+        CHECK(res5.in == src.end());
+        CHECK(res5.out == dst.data() + dst.size());
+        CHECK(dst == src);
+
+        std::fill(dst.begin(), dst.end(), 0.f);
+        auto res6 = ranges::copy(ranges::span<float const>(src), dst.begin());
+        CHECK(res6.out == dst.end());
+        CHECK(dst == src);
+
+        std::fill(dst.begin(), dst.end(), 0.f);
+        auto res7 = ranges::copy(
+            ranges::make_subrange(src.data() + 1, src.data() + 3), dst.data());
+        CHECK(res7.in == src.data() + 3);
+        CHECK(res7.out == dst.data() + 2);
+        CHECK(dst[0] == 2.f);
+        CHECK(dst[1] == 3.f);
+        CHECK(dst[2] == 0.f);
+
+        // Empty and overlapping (left-shifting) copies
+        auto res8 = ranges::copy(dst.begin(), dst.begin(), dst.begin() + 1);
+        CHECK(res8.out == dst.begin() + 1);
+        int buf[] = {0, 1, 2, 3, 4, 5};
+        auto res9 = ranges::copy(buf + 2, buf + 6, buf);
+        CHECK(res9.in == buf + 6);
+        CHECK(res9.out == buf + 4);
+        ::check_equal(buf, {2, 3, 4, 5, 4, 5});
+    }
+
     {
         using namespace ranges;
         std::ostringstream sout;
@@ -16,6 +16,7 @@
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/copy_backward.hpp>
 #include "../simple_test.hpp"
+#include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
 int main()
@@ -70,5 +71,19 @@ int main()
         CHECK(std::equal(a, a + size(a), out));
     }
 
+    {
+        // Overlapping (right-shifting) copy of a trivially copyable type
+        int buf[] = {0, 1, 2, 3, 4, 5};
+        auto res = ranges::copy_backward(buf, buf + 4, buf + 6);
+        CHECK(res.in == buf + 4);
+        CHECK(res.out == buf + 2);
+        ::check_equal(buf, {0, 1, 0, 1, 2, 3});
+
+        std::vector<int> vec(begin(buf), end(buf));
+        auto res2 = ranges::copy_backward(vec.begin(), vec.begin(), vec.end());
+        CHECK(res2.in == vec.begin());
+        CHECK(res2.out == vec.end());
+    }
+
     return test_result();
 }
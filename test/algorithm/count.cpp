@@ -9,6 +9,7 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count.hpp>
 #include "../simple_test.hpp"
@@ -19,6 +20,23 @@ struct S
     int i;
 };
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> v;
+        std::ptrdiff_t expected = 0;
+        for(int i = 0; i < n; ++i)
+        {
+            v.push_back(T(i % 3));
+            expected += i % 3 == 2;
+        }
+        CHECK(ranges::count(v, T(2)) == expected);
+        CHECK(ranges::count(v, T(7)) == 0);
+    }
+}
+
 int main()
 {
     using namespace ranges;
@@ -57,5 +75,12 @@ int main()
     CHECK(count(make_subrange(InputIterator<const S*>(sa),
                       Sentinel<const S*>(sa)), 2, &S::i) == 0);
 
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<int>();
+    test_contiguous<unsigned long long>();
+    test_contiguous<float>();
+    test_contiguous<double>();
+
     return ::test_result();
 }
@@ -0,0 +1,157 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+
+using namespace ranges;
+
+namespace
+{
+    std::mt19937 gen;
+
+    // Whether every element of v is no less than its children in a heap of the
+    // given arity.
+    template<typename T, typename C = less>
+    bool heap_ordered(std::vector<T> const & v, std::size_t arity, C pred = C{})
+    {
+        for(std::size_t i = 1; i < v.size(); ++i)
+            if(pred(v[(i - 1) / arity], v[i]))
+                return false;
+        return true;
+    }
+
+    std::vector<int> random_ints(std::size_t n, int bound)
+    {
+        std::uniform_int_distribution<int> dist(0, bound);
+        std::vector<int> v(n);
+        for(auto & i : v)
+            i = dist(gen);
+        return v;
+    }
+
+    template<std::size_t Arity>
+    void test_arity()
+    {
+        for(std::size_t n : {0u, 1u, 2u, 3u, 4u, 5u, 9u, 17u, 100u, 1000u})
+        {
+            for(int bound : {3, 1000000})
+            {
+                auto v = random_ints(n, bound);
+                auto sorted = v;
+                std::sort(sorted.begin(), sorted.end());
+
+                CHECK(make_dary_heap<Arity>(v) == v.end());
+                CHECK(heap_ordered(v, Arity));
+                CHECK(is_dary_heap<Arity>(v));
+                CHECK(is_dary_heap_until<Arity>(v.begin(), v.end()) == v.end());
+
+                // Popping takes the elements out largest first.
+                for(std::size_t i = n; i > 0; --i)
+                {
+                    auto const top = v.front();
+                    CHECK(pop_dary_heap<Arity>(v.begin(), v.begin() + i) ==
+                          v.begin() + i);
+                    CHECK(v[i - 1] == top);
+                    CHECK(v[i - 1] == sorted[i - 1]);
+                    CHECK(is_dary_heap<Arity>(v.begin(), v.begin() + (i - 1)));
+                }
+
+                // Pushing the elements one at a time builds a heap.
+                v = random_ints(n, bound);
+                sorted = v;
+                std::sort(sorted.begin(), sorted.end());
+                for(std::size_t i = 1; i <= n; ++i)
+                {
+                    CHECK(push_dary_heap<Arity>(v.begin(), v.begin() + i) ==
+                          v.begin() + i);
+                    CHECK(is_dary_heap<Arity>(v.begin(), v.begin() + i));
+                }
+                CHECK(sort_dary_heap<Arity>(v) == v.end());
+                CHECK(v == sorted);
+            }
+        }
+
+        // is_dary_heap_until finds the first child that is larger than its
+        // parent.
+        std::vector<int> bad(20, 5);
+        bad[13] = 6;
+        CHECK(is_dary_heap_until<Arity>(bad) == bad.begin() + 13);
+        CHECK(!is_dary_heap<Arity>(bad));
+    }
+
+    void test_projection()
+    {
+        using P = std::pair<int, std::unique_ptr<std::string>>;
+        std::vector<P> v;
+        for(int i : random_ints(500, 100))
+            v.emplace_back(i, std::unique_ptr<std::string>(new std::string(
+                                  static_cast<std::size_t>(i), 'x')));
+        // A min-heap of move-only elements.
+        make_dary_heap<4>(v, greater{}, &P::first);
+        CHECK(is_dary_heap<4>(v, greater{}, &P::first));
+        sort_dary_heap<4>(v, greater{}, &P::first);
+        CHECK(is_sorted(v, greater{}, &P::first));
+        for(auto const & p : v)
+            CHECK(p.second->size() == static_cast<std::size_t>(p.first));
+    }
+
+    void test_binary()
+    {
+        // A 2-ary heap is the heap of the binary algorithms.
+        auto v = random_ints(1000, 1000);
+        make_heap(v);
+        CHECK(is_dary_heap<2>(v));
+        CHECK(std::is_heap(v.begin(), v.end()));
+        auto w = v;
+        std::vector<int> popped, std_popped;
+        for(auto end = v.end(); end != v.begin(); --end)
+        {
+            pop_heap(v.begin(), end);
+            CHECK(std::is_heap(v.begin(), end - 1));
+            popped.push_back(*(end - 1));
+        }
+        for(auto end = w.end(); end != w.begin(); --end)
+        {
+            std::pop_heap(w.begin(), end);
+            std_popped.push_back(*(end - 1));
+        }
+        CHECK(popped == std_popped);
+
+        // Binary heaps of a dangling range.
+        auto dangles = make_dary_heap<2>(std::vector<int>{1, 2, 3});
+        CPP_assert(same_as<decltype(dangles), dangling>);
+        (void)dangles;
+    }
+} // namespace
+
+int main()
+{
+    test_arity<2>();
+    test_arity<3>();
+    test_arity<4>();
+    test_arity<8>();
+    test_projection();
+    test_binary();
+
+    return ::test_result();
+}
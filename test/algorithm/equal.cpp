@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/view/unbounded.hpp>
@@ -271,6 +272,24 @@ void test_rng_pred()
                   std::equal_to<int>()));
 }
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> a(static_cast<std::size_t>(n), T(1));
+        std::vector<T> b = a;
+        CHECK(ranges::equal(a, b));
+        CHECK(!ranges::equal(a.data(), a.data() + n, b.data(), b.data() + n + 1));
+        for(int i = 0; i < n; ++i)
+        {
+            b[static_cast<std::size_t>(i)] = T(2);
+            CHECK(!ranges::equal(a, b));
+            b[static_cast<std::size_t>(i)] = T(1);
+        }
+    }
+}
+
 int main()
 {
     ::test();
@@ -291,5 +310,18 @@ int main()
     static_assert(ranges::equal(IL{}, IL{}), "");
 #endif
 
+    test_contiguous<char>();
+    test_contiguous<int>();
+    test_contiguous<long long>();
+    test_contiguous<float>();
+    test_contiguous<double>();
+
+    {
+        // Floating point equality is not bitwise equality
+        double const d0[] = {0.0, 1.0};
+        double const d1[] = {-0.0, 1.0};
+        CHECK(ranges::equal(d0, d1));
+    }
+
     return ::test_result();
 }
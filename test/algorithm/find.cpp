@@ -30,6 +30,25 @@ struct S
     int i_;
 };
 
+// Exercise the vectorized kernels at every length and hit position around
+// the vector width, including the scalar tail.
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> v(static_cast<std::size_t>(n), T(1));
+        CHECK(ranges::find(v, T(2)) == v.end());
+        for(int i = 0; i < n; ++i)
+        {
+            v[static_cast<std::size_t>(i)] = T(2);
+            CHECK(ranges::find(v, T(2)) == v.begin() + i);
+            CHECK(ranges::find(v.data() + i, v.data() + n, T(2)) == v.data() + i);
+            v[static_cast<std::size_t>(i)] = T(1);
+        }
+    }
+}
+
 int main()
 {
     using namespace ranges;
@@ -87,5 +106,19 @@ int main()
         CHECK(it == vec.begin() + 1);
     }
 
+    test_contiguous<char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<int>();
+    test_contiguous<long long>();
+    test_contiguous<float>();
+    test_contiguous<double>();
+
+    {
+        // Floating point equality is not bitwise equality
+        double const d[] = {1.0, -0.0, 2.0};
+        CHECK(ranges::find(d, 0.0) == d + 1);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,254 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
+#include <range/v3/functional/overload.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/cartesian_product.hpp>
+#include <range/v3/view/const.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+template<typename Rng>
+using pushable_range = detail::pushable_t<iterator_t<Rng>, sentinel_t<Rng>>;
+
+struct is_multiple_of
+{
+    int n;
+    bool operator()(int i) const
+    {
+        return i % n == 0;
+    }
+};
+
+// The elements of [first, last), read one iterator increment at a time.
+template<typename I, typename S>
+std::vector<int> pulled(I first, S last)
+{
+    std::vector<int> v;
+    for(; first != last; ++first)
+        v.push_back(*first);
+    return v;
+}
+
+// Runs the algorithms that push over rng and checks the results against the
+// elements read one at a time.
+template<typename Rng>
+void check_algorithms(Rng && rng, std::vector<int> const & expected)
+{
+    CHECK(pulled(begin(rng), end(rng)) == expected);
+
+    std::vector<int> seen;
+    CHECK(for_each_while(rng, [&](int i) {
+              seen.push_back(i);
+              return true;
+          }) == end(rng));
+    CHECK(seen == expected);
+
+    seen.clear();
+    CHECK(for_each(rng, [&](int i) { seen.push_back(i); }).in == end(rng));
+    CHECK(seen == expected);
+
+    long sum = 0;
+    for(int i : expected)
+        sum += i;
+    CHECK(accumulate(rng, 0L) == sum);
+    CHECK((rng | to<std::vector>()) == expected);
+
+    for(int n : {1, 2, 7, 50, 1000})
+    {
+        auto const pred = is_multiple_of{n};
+        CHECK(count_if(rng, pred) == count_if(expected.begin(), expected.end(), pred));
+        CHECK(any_of(rng, pred) == any_of(expected.begin(), expected.end(), pred));
+        // find_if stops where the element-wise search would, and iteration
+        // carries on correctly from there.
+        auto it = find_if(rng, pred);
+        auto eit = find_if(expected.begin(), expected.end(), pred);
+        CHECK((it == end(rng)) == (eit == expected.end()));
+        if(eit != expected.end())
+        {
+            CHECK(*it == *eit);
+            if(forward_range<Rng>)
+                CHECK(equal(pulled(next(it), end(rng)),
+                            make_subrange(next(eit), expected.end())));
+            CHECK(equal(pulled(it, end(rng)), make_subrange(eit, expected.end())));
+        }
+    }
+}
+
+void test_cpo()
+{
+    std::vector<int> v{1, 2, 3, 4, 5};
+    int calls = 0;
+    auto it = for_each_while(v, [&](int i) {
+        ++calls;
+        return i < 3;
+    });
+    CHECK(it == v.begin() + 2);
+    CHECK(calls == 3);
+    CHECK(for_each_while(v.begin(), v.begin(), [](int) { return true; }) ==
+          v.begin());
+
+    // The sink may be any predicate.
+    auto rng = views::iota(0, 10);
+    CHECK(*for_each_while(rng, is_multiple_of{5}) == 1);
+}
+
+void test_iota()
+{
+    CPP_assert(pushable_range<decltype(views::iota(0))>::value);
+    CPP_assert(pushable_range<decltype(views::iota(0, 10))>::value);
+    check_algorithms(views::iota(3, 20), pulled(views::iota(3, 20).begin(),
+                                                views::iota(3, 20).end()));
+    check_algorithms(views::iota(5, 5), {});
+
+    // An unbounded iota stops only when the sink says so.
+    auto it = for_each_while(views::iota(10), [](int i) { return i < 1000; });
+    CHECK(*it == 1000);
+}
+
+void test_pipeline()
+{
+    auto rng = views::iota(0) | views::filter(is_multiple_of{3}) |
+               views::transform([](int i) { return i * 2; }) |
+               views::take_while([](int i) { return i < 100; });
+    CPP_assert(pushable_range<decltype(rng)>::value);
+    std::vector<int> expected;
+    for(int i = 0; i < 100; i += 6)
+        expected.push_back(i);
+    check_algorithms(rng, expected);
+
+    // Adaptors over containers push the elements of the container.
+    std::vector<int> v;
+    for(int i = 0; i < 200; ++i)
+        v.push_back((i * 37) % 101);
+    auto filtered = v | views::remove_if(is_multiple_of{2});
+    CPP_assert(pushable_range<decltype(filtered)>::value);
+    CPP_assert(common_range<decltype(filtered)>);
+    check_algorithms(filtered, pulled(filtered.begin(), filtered.end()));
+
+    auto const & cv = v;
+    auto squares = cv | views::transform([](int i) { return i * i; });
+    CPP_assert(pushable_range<decltype(squares)>::value);
+    check_algorithms(squares, pulled(squares.begin(), squares.end()));
+    check_algorithms(squares | views::const_, pulled(squares.begin(), squares.end()));
+
+    // Pushing starts and stops wherever the iterators are.
+    auto first = next(filtered.begin(), 10), last = next(filtered.begin(), 30);
+    std::vector<int> part;
+    for_each(first, last, [&](int i) { part.push_back(i); });
+    CHECK(part == pulled(first, last));
+
+    // An iterator-level function is not applied to the pushed elements.
+    using I = std::vector<int>::iterator;
+    auto offset = overload([&v](I it) { return it - v.begin(); },
+                           [](copy_tag, I) -> std::ptrdiff_t { return 0; },
+                           [&v](move_tag, I it) { return it - v.begin(); });
+    auto offsets = v | views::iter_transform(offset);
+    CPP_assert(!pushable_range<decltype(offsets)>::value);
+    CHECK(accumulate(offsets, 0L) == 199L * 200 / 2);
+}
+
+void test_join()
+{
+    // Joined ranges push their segments, which may push their own elements.
+    std::vector<std::vector<int>> vv{{1, 2, 3}, {}, {4, 5, 6, 7}, {8}};
+    auto rng = vv | views::transform([](std::vector<int> const & inner) {
+                   return inner | views::filter(is_multiple_of{2});
+               }) |
+               views::join;
+    check_algorithms(rng, {2, 4, 6, 8});
+
+    auto counts = views::iota(0, 6) | views::transform([](int i) {
+                      return views::iota(0, i);
+                  }) |
+                  views::join;
+    check_algorithms(counts, pulled(counts.begin(), counts.end()));
+}
+
+void test_cartesian_product()
+{
+    auto flat = [](auto && t) {
+        return std::get<0>(t) * 100 + std::get<1>(t) * 10 + std::get<2>(t);
+    };
+    auto cp = views::cartesian_product(views::iota(0, 3), views::iota(0, 4),
+                                       views::iota(0, 2));
+    CPP_assert(pushable_range<decltype(cp)>::value);
+    auto rng = cp | views::transform(flat);
+    auto const expected = pulled(rng.begin(), rng.end());
+    CHECK(expected.size() == 24u);
+    check_algorithms(rng, expected);
+
+    // Starting and stopping inside rows.
+    for(int lo : {0, 1, 5, 8, 23})
+    {
+        for(int hi : {lo, lo + 1, lo + 7, 24})
+        {
+            if(hi > 24)
+                continue;
+            std::vector<int> seen;
+            for_each(next(cp.begin(), lo), next(cp.begin(), hi), [&](auto && t) {
+                seen.push_back(flat(t));
+            });
+            CHECK(equal(seen,
+                        make_subrange(expected.begin() + lo, expected.begin() + hi)));
+        }
+    }
+
+    auto one = views::cartesian_product(views::iota(0, 5));
+    CPP_assert(pushable_range<decltype(one)>::value);
+    CHECK(count_if(one, [](auto && t) { return std::get<0>(t) % 2 == 0; }) == 3);
+
+    std::vector<int> v{1, 2, 3}, empty;
+    CHECK(count_if(views::cartesian_product(v, empty, v), [](auto &&) { return true; }) ==
+          0);
+
+    // A product whose first range is not common ends in a default sentinel.
+    auto lines = views::cartesian_product(views::iota(0) | views::take_while([](int i) {
+                                              return i < 3;
+                                          }),
+                                          v);
+    CPP_assert(pushable_range<decltype(lines)>::value);
+    CHECK(count_if(lines, [](auto && t) { return std::get<1>(t) == 2; }) == 3);
+    auto it = find_if(lines, [](auto && t) { return std::get<0>(t) == 1; });
+    CHECK(std::get<0>(*it) == 1);
+    CHECK(std::get<1>(*it) == 1);
+}
+
+int main()
+{
+    test_cpo();
+    test_iota();
+    test_pipeline();
+    test_join();
+    test_cartesian_product();
+
+    return ::test_result();
+}
@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/lexicographical_compare.hpp>
 #include "../simple_test.hpp"
@@ -167,10 +168,39 @@ void test_iter_comp()
 }
 
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> a(static_cast<std::size_t>(n), T(1));
+        std::vector<T> b = a;
+        CHECK(!ranges::lexicographical_compare(a, b));
+        b.push_back(T(0));
+        CHECK(ranges::lexicographical_compare(a, b));
+        CHECK(!ranges::lexicographical_compare(b, a));
+        b.pop_back();
+        for(int i = 0; i < n; ++i)
+        {
+            b[static_cast<std::size_t>(i)] = T(-1);
+            CHECK(ranges::lexicographical_compare(b, a) == (T(-1) < T(1)));
+            CHECK(ranges::lexicographical_compare(a, b) == (T(1) < T(-1)));
+            b[static_cast<std::size_t>(i)] = T(1);
+        }
+    }
+}
+
 int main()
 {
     test_iter();
     test_iter_comp();
 
+    test_contiguous<char>();
+    test_contiguous<signed char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+
     return test_result();
 }
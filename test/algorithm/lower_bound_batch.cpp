@@ -0,0 +1,169 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/lower_bound_batch.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+
+using namespace ranges;
+
+namespace
+{
+    std::mt19937 gen;
+
+    using input_it = InputIterator<std::vector<int>::const_iterator>;
+    using forward_it = ForwardIterator<std::vector<int>::const_iterator>;
+
+    std::vector<int> random_ints(std::size_t n, int bound, bool sorted)
+    {
+        std::uniform_int_distribution<int> dist(-2, bound + 1);
+        std::vector<int> v(n);
+        for(auto & i : v)
+            i = dist(gen);
+        if(sorted)
+            std::sort(v.begin(), v.end());
+        return v;
+    }
+
+    // Checks the iterators and the offsets of every kind of batch against
+    // one lower_bound per query.
+    void check(std::vector<int> const & hay, std::vector<int> const & queries)
+    {
+        std::vector<std::vector<int>::const_iterator> expected;
+        for(int q : queries)
+            expected.push_back(lower_bound(hay, q));
+
+        std::vector<std::vector<int>::const_iterator> its(queries.size());
+        auto res = lower_bound_batch(hay, queries, its.begin());
+        CHECK(res.in == queries.end());
+        CHECK(res.out == its.end());
+        CHECK(its == expected);
+
+        std::vector<std::ptrdiff_t> offsets;
+        lower_bound_batch(hay, queries, ranges::back_inserter(offsets));
+        CHECK(offsets.size() == queries.size());
+        for(std::size_t i = 0; i < offsets.size(); ++i)
+            CHECK(offsets[i] == expected[i] - hay.begin());
+
+        // Through a haystack that is not random-access.
+        offsets.clear();
+        lower_bound_batch(forward_it(hay.begin()),
+                          forward_it(hay.end()),
+                          queries.begin(),
+                          queries.end(),
+                          ranges::back_inserter(offsets));
+        for(std::size_t i = 0; i < offsets.size(); ++i)
+            CHECK(offsets[i] == expected[i] - hay.begin());
+
+        if(!std::is_sorted(queries.begin(), queries.end()))
+            return;
+        its.assign(queries.size(), hay.end());
+        lower_bound_batch(sorted_queries, hay, queries, its.begin());
+        CHECK(its == expected);
+        offsets.clear();
+        lower_bound_batch(sorted_queries,
+                          forward_it(hay.begin()),
+                          forward_it(hay.end()),
+                          input_it(queries.begin()),
+                          input_it(queries.end()),
+                          ranges::back_inserter(offsets));
+        CHECK(offsets.size() == queries.size());
+        for(std::size_t i = 0; i < offsets.size(); ++i)
+            CHECK(offsets[i] == expected[i] - hay.begin());
+    }
+
+    void test_sizes()
+    {
+        for(std::size_t n : {0u, 1u, 2u, 3u, 15u, 16u, 17u, 100u, 1000u})
+        {
+            for(std::size_t m : {0u, 1u, 15u, 16u, 17u, 40u, 300u})
+            {
+                // Values that are absent, duplicated, and out of range.
+                auto const hay = random_ints(n, static_cast<int>(n / 2), true);
+                check(hay, random_ints(m, static_cast<int>(n / 2), false));
+                check(hay, random_ints(m, static_cast<int>(n / 2), true));
+            }
+        }
+    }
+
+    void test_projection()
+    {
+        using P = std::pair<int, char>;
+        std::vector<P> hay;
+        for(int i = 0; i < 50; ++i)
+            hay.emplace_back(100 - 2 * i, 'x');
+        // Descending order, and queries computed on the fly.
+        auto queries = views::iota(0, 120) | views::transform([](int i) { return i; });
+        std::vector<std::ptrdiff_t> offsets;
+        lower_bound_batch(
+            hay, queries, ranges::back_inserter(offsets), greater{}, &P::first);
+        std::vector<std::ptrdiff_t> sorted_offsets;
+        lower_bound_batch(sorted_queries,
+                          hay,
+                          queries | views::transform([](int i) { return 119 - i; }),
+                          ranges::back_inserter(sorted_offsets),
+                          greater{},
+                          &P::first);
+        for(int q = 0; q < 120; ++q)
+        {
+            auto const expected =
+                lower_bound(hay, q, greater{}, &P::first) - hay.begin();
+            CHECK(offsets[static_cast<std::size_t>(q)] == expected);
+            CHECK(sorted_offsets[static_cast<std::size_t>(119 - q)] == expected);
+        }
+
+        // Sorted searches of a haystack that is not random-access walk it once,
+        // however many offsets they write.
+        std::forward_list<int> const fl(1000, 7);
+        int steps = 0;
+        auto counted = fl | views::filter([&steps](int) { return ++steps, true; });
+        ranges::begin(counted);
+        steps = 0;
+        std::vector<std::ptrdiff_t> walked;
+        lower_bound_batch(sorted_queries,
+                          counted,
+                          views::repeat_n(8, 500),
+                          ranges::back_inserter(walked));
+        CHECK(walked.size() == 500u);
+        CHECK(walked.back() == 1000);
+        CHECK(steps <= 1001);
+
+        // Offsets into a temporary haystack outlive it.
+        std::vector<long> out(3);
+        lower_bound_batch(
+            std::vector<int>{1, 3, 5}, std::vector<int>{0, 3, 9}, out.begin());
+        ::check_equal(out, {0L, 1L, 3L});
+    }
+} // namespace
+
+int main()
+{
+    test_sizes();
+    test_projection();
+
+    return ::test_result();
+}
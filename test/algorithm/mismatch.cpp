@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/mismatch.hpp>
 #include "../simple_test.hpp"
@@ -99,6 +100,31 @@ struct S
     int i;
 };
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> a(static_cast<std::size_t>(n), T(1));
+        std::vector<T> b = a;
+        auto r = ranges::mismatch(a, b);
+        CHECK(r.in1 == a.end());
+        CHECK(r.in2 == b.end());
+        for(int i = 0; i < n; ++i)
+        {
+            b[static_cast<std::size_t>(i)] = T(2);
+            r = ranges::mismatch(a, b);
+            CHECK(r.in1 == a.begin() + i);
+            CHECK(r.in2 == b.begin() + i);
+            // The shorter range bounds the search
+            auto r2 = ranges::mismatch(a.data(), a.data() + i, b.data(), b.data() + n);
+            CHECK(r2.in1 == a.data() + i);
+            CHECK(r2.in2 == b.data() + i);
+            b[static_cast<std::size_t>(i)] = T(1);
+        }
+    }
+}
+
 int main()
 {
     test_iter<InputIterator<const int*>>();
@@ -135,5 +161,12 @@ int main()
     CHECK(ps2.in1->i == -4);
     CHECK(ps2.in2->i == 5);
 
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<int>();
+    test_contiguous<long long>();
+    test_contiguous<float>();
+    test_contiguous<double>();
+
     return test_result();
 }
@@ -21,6 +21,7 @@
 #include <memory>
 #include <random>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/nth_element.hpp>
 #include "../simple_test.hpp"
@@ -73,6 +74,99 @@ namespace
     {
         int i,j;
     };
+
+    // Checks that v[M] is the element of rank M, with none greater before it
+    // and none less after.
+    void check_selected(std::vector<int> v, unsigned M)
+    {
+        auto sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        CHECK(ranges::nth_element(v, v.begin() + M) == v.end());
+        CHECK(v[M] == sorted[M]);
+        for(unsigned i = 0; i < M; ++i)
+            CHECK(!(v[M] < v[i]));
+        for(unsigned i = M + 1; i < v.size(); ++i)
+            CHECK(!(v[i] < v[M]));
+    }
+
+    // Inputs that are not random, at sizes where the pivots come from samples.
+    void test_patterns()
+    {
+        for(unsigned N : {601u, 5000u, 100000u})
+        {
+            std::vector<int> v(N);
+            for(unsigned M : {0u, 1u, N / 100, N / 2, N - N / 100, N - 1})
+            {
+                for(unsigned i = 0; i < N; ++i)
+                    v[i] = (int)i;
+                check_selected(v, M); // sorted
+                std::reverse(v.begin(), v.end());
+                check_selected(v, M);
+                std::reverse(v.begin() + N / 2, v.end());
+                check_selected(v, M); // organ pipe
+                for(unsigned i = 0; i < N; ++i)
+                    v[i] = (int)(gen() % 3);
+                check_selected(v, M);
+                std::fill(v.begin(), v.end(), 7);
+                check_selected(v, M);
+            }
+        }
+    }
+
+    // The fallback that takes linear time on any input.
+    void test_linear()
+    {
+        for(unsigned N : {1u, 2u, 5u, 8u, 9u, 10u, 11u, 31u, 256u, 1009u})
+        {
+            std::vector<int> v(N);
+            for(unsigned M = 0; M < N; M += 1 + N / 16)
+            {
+                for(unsigned i = 0; i < N; ++i)
+                    v[i] = (int)(gen() % (N / 2 + 1));
+                auto sorted = v;
+                std::sort(sorted.begin(), sorted.end());
+                ranges::less pred;
+                ranges::identity proj;
+                ranges::detail::nth_element_linear_(
+                    v.begin(), v.begin() + M, v.end(), pred, proj);
+                CHECK(v[M] == sorted[M]);
+                for(unsigned i = 0; i < M; ++i)
+                    CHECK(!(v[M] < v[i]));
+                for(unsigned i = M + 1; i < N; ++i)
+                    CHECK(!(v[i] < v[M]));
+            }
+        }
+    }
+
+    // McIlroy's adversary decides the order of the elements as they are
+    // compared, so that every pivot is nearly the least of its range. The
+    // median of medians takes over after two rounds, before the partitions
+    // cost more than a linear number of comparisons.
+    void test_adversary()
+    {
+        int const n = 100000;
+        std::vector<int> val(n, n), idx(n);
+        for(int i = 0; i < n; ++i)
+            idx[i] = i;
+        int solid = 0, candidate = 0;
+        long comparisons = 0;
+        auto pred = [&](int x, int y) {
+            ++comparisons;
+            if(val[x] == n && val[y] == n)
+                val[x == candidate ? x : y] = solid++;
+            if(val[x] == n)
+                candidate = x;
+            else if(val[y] == n)
+                candidate = y;
+            return val[x] < val[y];
+        };
+        ranges::nth_element(idx, idx.begin() + n / 2, pred);
+        CHECK(comparisons < 20L * n);
+        for(int i = 0; i < n / 2; ++i)
+            CHECK(!pred(idx[n / 2], idx[i]));
+        for(int i = n / 2 + 1; i < n; ++i)
+            CHECK(!pred(idx[i], idx[n / 2]));
+    }
 }
 
 int main()
@@ -99,5 +193,17 @@ int main()
     CHECK(ia[M].i == M);
     CHECK(ia[M].j == M);
 
+    test_patterns();
+    test_linear();
+    test_adversary();
+
+    // Move-only elements.
+    std::vector<std::unique_ptr<int>> ptrs;
+    for(int i = 0; i < 1000; ++i)
+        ptrs.emplace_back(new int((i * 7919) % 1000));
+    ranges::nth_element(ptrs, ptrs.begin() + 250, std::less<int>(),
+                        [](std::unique_ptr<int> const & p) { return *p; });
+    CHECK(*ptrs[250] == 250);
+
     return test_result();
 }
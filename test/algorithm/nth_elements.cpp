@@ -0,0 +1,102 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <range/v3/algorithm/nth_element.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+
+using namespace ranges;
+
+namespace
+{
+    std::mt19937 gen;
+
+    // Checks that each rank of v holds the element of that rank, and that the
+    // elements between two ranks are between them.
+    void check(std::vector<int> v, std::vector<std::ptrdiff_t> const & ranks)
+    {
+        auto sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        CHECK(nth_elements(v, ranks) == v.end());
+        std::ptrdiff_t prev = 0;
+        for(auto r : ranks)
+        {
+            CHECK(v[std::size_t(r)] == sorted[std::size_t(r)]);
+            for(auto i = prev; i < r; ++i)
+                CHECK(!(v[std::size_t(r)] < v[std::size_t(i)]));
+            prev = r;
+        }
+        for(auto i = prev; i < std::ptrdiff_t(v.size()) && !ranks.empty(); ++i)
+            CHECK(!(v[std::size_t(i)] < v[std::size_t(prev)]));
+    }
+
+    void test_ranks()
+    {
+        for(std::size_t n : {1u, 2u, 7u, 8u, 100u, 1000u, 20000u})
+        {
+            for(int bound : {2, 1000000})
+            {
+                std::uniform_int_distribution<int> dist(0, bound);
+                std::vector<int> v(n);
+                for(auto & i : v)
+                    i = dist(gen);
+                auto const last = std::ptrdiff_t(n) - 1;
+                check(v, {});
+                check(v, {0});
+                check(v, {last});
+                check(v, {0, last});
+                check(v, {last / 2, last / 2, last / 2});
+                std::vector<std::ptrdiff_t> percentiles;
+                for(std::ptrdiff_t p = 1; p < 100; ++p)
+                    percentiles.push_back(std::ptrdiff_t(n) * p / 100);
+                check(v, percentiles);
+                std::vector<std::ptrdiff_t> all;
+                for(std::ptrdiff_t r = 0; r <= last && n <= 1000; ++r)
+                    all.push_back(r);
+                check(v, all);
+            }
+        }
+    }
+
+    void test_projection()
+    {
+        using P = std::pair<int, int>;
+        std::vector<P> v;
+        for(int i = 0; i < 1000; ++i)
+            v.emplace_back((i * 7919) % 1000, i);
+        int const ranks[] = {10, 500, 990};
+        auto it = nth_elements(v.begin(), v.end(), ranks, ranks + 3, greater{}, &P::first);
+        CHECK(it == v.end());
+        CHECK(v[10].first == 989);
+        CHECK(v[500].first == 499);
+        CHECK(v[990].first == 9);
+
+        auto d = nth_elements(std::vector<int>{3, 1, 2}, std::vector<int>{1});
+        CPP_assert(same_as<decltype(d), dangling>);
+        (void)d;
+    }
+} // namespace
+
+int main()
+{
+    test_ranks();
+    test_projection();
+
+    return ::test_result();
+}
@@ -0,0 +1,266 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// Exercise the thread pool even where there is a single hardware thread.
+#define RANGES_PARALLEL_THREADS 4
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ex = ranges::execution;
+
+CPP_assert(ranges::execution_policy<ex::sequenced_policy>);
+CPP_assert(ranges::execution_policy<ex::parallel_policy const &>);
+CPP_assert(ranges::execution_policy<ex::parallel_unsequenced_policy>);
+CPP_assert(!ranges::execution_policy<int>);
+
+struct S
+{
+    int key;
+    int index;
+};
+
+template<typename Policy>
+void test_policy(Policy const & policy, int n)
+{
+    std::vector<int> v(static_cast<std::size_t>(n));
+    std::iota(v.begin(), v.end(), 0);
+
+    // for_each
+    {
+        std::vector<int> w = v;
+        auto it = ranges::for_each(policy, w, [](int & i) { i *= 2; });
+        CHECK(it == w.end());
+        for(int i = 0; i < n; ++i)
+            CHECK(w[static_cast<std::size_t>(i)] == 2 * i);
+        std::atomic<long long> sum{0};
+        ranges::for_each(policy, ranges::views::iota(0, n), [&](int i) { sum += i; });
+        CHECK(sum.load() == static_cast<long long>(n) * (n - 1) / 2);
+    }
+
+    // transform
+    {
+        std::vector<long long> out(static_cast<std::size_t>(n));
+        auto res = ranges::transform(
+            policy, v, out.begin(), [](int i) { return 3LL * i; });
+        CHECK(res.in == v.end());
+        CHECK(res.out == out.end());
+        for(int i = 0; i < n; ++i)
+            CHECK(out[static_cast<std::size_t>(i)] == 3LL * i);
+    }
+
+    // count_if, find_if
+    {
+        auto is_odd = [](int i) { return i % 2 != 0; };
+        CHECK(ranges::count_if(policy, v, is_odd) == n / 2);
+        auto rng = ranges::views::iota(0, n) |
+                   ranges::views::transform([](int i) { return i % 1000; });
+        CHECK(ranges::count_if(policy, rng, [](int i) { return i == 7; }) ==
+              ranges::count_if(rng, [](int i) { return i == 7; }));
+        for(int target : {0, 1, n / 3, n / 2, n - 1, n})
+        {
+            if(target < 0 || target > n)
+                continue;
+            auto it = ranges::find_if(policy, v, [=](int i) { return i >= target; });
+            CHECK((it - v.begin()) == target);
+        }
+        auto it = ranges::find_if(policy, rng, [](int i) { return i == 999; });
+        CHECK(it == ranges::find_if(rng, [](int i) { return i == 999; }));
+    }
+
+    // accumulate
+    {
+        CHECK(ranges::accumulate(policy, v, 0LL) ==
+              static_cast<long long>(n) * (n - 1) / 2);
+        // The operands of the operation differ: it is applied to the elements
+        // in order, never to two partial results.
+        auto sum_squares = [](long long acc, int i) {
+            return acc + (i % 1000) * (i % 1000);
+        };
+        CHECK(ranges::accumulate(policy, v, 0LL, sum_squares) ==
+              ranges::accumulate(v, 0LL, sum_squares));
+        // Not commutative: the partial results must be combined in order.
+        auto digits = v | ranges::views::transform([](int i) { return i % 10; });
+        auto const m = n < 20000 ? n : 20000;
+        auto to_string = [](int i) { return std::to_string(i); };
+        CHECK(ranges::accumulate(policy,
+                                 digits.begin(),
+                                 digits.begin() + m,
+                                 std::string{},
+                                 std::plus<std::string>{},
+                                 to_string) ==
+              ranges::accumulate(digits.begin(),
+                                 digits.begin() + m,
+                                 std::string{},
+                                 std::plus<std::string>{},
+                                 to_string));
+    }
+
+    // copy_if
+    {
+        std::vector<int> out(static_cast<std::size_t>(n));
+        auto res =
+            ranges::copy_if(policy, v, out.begin(), [](int i) { return i % 3 == 0; });
+        CHECK(res.in == v.end());
+        CHECK((res.out - out.begin()) == (n + 2) / 3);
+        for(int i = 0; i < (n + 2) / 3; ++i)
+            CHECK(out[static_cast<std::size_t>(i)] == 3 * i);
+    }
+
+    // partial_sum
+    {
+        std::vector<long long> in(v.begin(), v.end());
+        std::vector<long long> out(static_cast<std::size_t>(n));
+        auto res = ranges::partial_sum(policy, in, out.begin());
+        CHECK(res.in == in.end());
+        CHECK(res.out == out.end());
+        long long sum = 0;
+        for(int i = 0; i < n; ++i)
+        {
+            sum += i;
+            CHECK(out[static_cast<std::size_t>(i)] == sum);
+        }
+        // Not associative: the scan cannot be regrouped.
+        std::vector<long long> ones(static_cast<std::size_t>(n), 1);
+        std::vector<long long> expected(static_cast<std::size_t>(n));
+        ranges::partial_sum(ones, expected.begin(), ranges::minus{});
+        ranges::partial_sum(policy, ones, out.begin(), ranges::minus{});
+        CHECK(out == expected);
+    }
+
+    // sort, stable_sort
+    {
+        std::mt19937 gen(static_cast<std::mt19937::result_type>(n));
+        std::vector<S> s(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            s[static_cast<std::size_t>(i)] = S{static_cast<int>(gen() % 1000), i};
+        std::vector<S> s2 = s;
+
+        ranges::sort(policy, s, std::less<int>{}, &S::key);
+        CHECK(std::is_sorted(s.begin(), s.end(), [](S const & a, S const & b) {
+            return a.key < b.key;
+        }));
+
+        auto check_stable = [](std::vector<S> const & x) {
+            for(std::size_t i = 1; i < x.size(); ++i)
+            {
+                CHECK(x[i - 1].key <= x[i].key);
+                if(x[i - 1].key == x[i].key)
+                    CHECK(x[i - 1].index < x[i].index);
+            }
+        };
+        std::vector<S> s3 = s2;
+        ranges::stable_sort(policy, s2, std::less<int>{}, &S::key);
+        check_stable(s2);
+
+        // Few distinct keys make the merges split unevenly.
+        for(auto & x : s3)
+            x.key %= 3;
+        ranges::scratch_buffer<S> buf;
+        CHECK(ranges::stable_sort(policy, s3, buf, std::less<int>{}, &S::key) ==
+              s3.end());
+        check_stable(s3);
+        CHECK(buf.capacity() >= (n + 1) / 2);
+        std::reverse(s3.begin(), s3.end());
+        ranges::stable_sort(policy, s3.begin(), s3.end(), buf, ranges::greater{}, &S::key);
+        for(std::size_t i = 1; i < s3.size(); ++i)
+        {
+            CHECK(s3[i - 1].key >= s3[i].key);
+            if(s3[i - 1].key == s3[i].key)
+                CHECK(s3[i - 1].index > s3[i].index);
+        }
+
+        std::vector<std::string> str(static_cast<std::size_t>(n));
+        for(auto & x : str)
+            x = std::to_string(gen());
+        std::vector<std::string> expected = str;
+        std::sort(expected.begin(), expected.end(), std::greater<std::string>{});
+        CHECK(ranges::sort(policy, str, ranges::greater{}) == str.end());
+        CHECK(str == expected);
+    }
+}
+
+int main()
+{
+    for(int n : {0, 1, 100, 5000, 100000, 300007})
+    {
+        test_policy(ex::seq, n);
+        test_policy(ex::par, n);
+        test_policy(ex::par_unseq, n);
+    }
+
+    // Sequences that are not random-access run sequentially.
+    {
+        std::list<int> l{1, 2, 3, 4, 5};
+        CHECK(ranges::count_if(ex::par, l, [](int i) { return i > 2; }) == 3);
+        CHECK(*ranges::find_if(ex::par, l, [](int i) { return i > 2; }) == 3);
+        CHECK(ranges::accumulate(ex::par, l, 0) == 15);
+        int a[] = {1, 2, 3, 4};
+        int out[4] = {};
+        ranges::partial_sum(ex::par,
+                            ForwardIterator<int const *>(a),
+                            ForwardIterator<int const *>(a + 4),
+                            out);
+        CHECK(out[3] == 10);
+    }
+
+    // The merge sort merges runs sorted on different threads, and the strings
+    // it moves from are left empty while other pieces are still being merged.
+    {
+        std::mt19937 gen(2718);
+        std::vector<std::string> str(200003);
+        for(auto & x : str)
+            x = std::string(20, 'x') + std::to_string(gen() % 5000);
+        std::vector<std::string> expected = str;
+        std::sort(expected.begin(), expected.end());
+        std::atomic<int> runs{0};
+        ranges::aux::parallel_merge_sort(str.begin(), str.end(), [&](auto f, auto l) {
+            ++runs;
+            std::sort(f, l);
+        });
+        CHECK(runs.load() > 1);
+        CHECK(str == expected);
+    }
+
+    // Nested parallel algorithms do not deadlock.
+    {
+        std::vector<std::vector<int>> vv(64, std::vector<int>(10000));
+        ranges::for_each(ex::par, vv, [](std::vector<int> & v) {
+            ranges::for_each(ex::par, v, [](int & i) { i = 1; });
+            ranges::sort(ex::par, v);
+        });
+        CHECK(ranges::accumulate(vv, 0, [](int acc, std::vector<int> const & v) {
+                  return acc + ranges::accumulate(ex::par, v, 0);
+              }) == 64 * 10000);
+    }
+
+    return ::test_result();
+}
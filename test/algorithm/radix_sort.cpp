@@ -0,0 +1,221 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/view/iota.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+
+using namespace ranges;
+
+namespace
+{
+    std::mt19937_64 gen;
+
+    struct record
+    {
+        std::int64_t timestamp;
+        std::uint32_t id;
+        std::string payload;
+    };
+
+    // Its move constructor may throw, so the sort fills its buffer first.
+    struct boxed
+    {
+        int key;
+        boxed(int k)
+          : key(k)
+        {}
+        boxed(boxed const &) = default;
+        boxed(boxed && that) noexcept(false)
+          : key(that.key)
+        {}
+        boxed & operator=(boxed const &) = default;
+        boxed & operator=(boxed &&) = default;
+    };
+
+    // n integers from [0, bound), or of any value if bound is 0.
+    template<typename T>
+    std::vector<T> random_ints(std::size_t n, std::uint64_t bound = 0)
+    {
+        std::vector<T> v(n);
+        for(auto & t : v)
+            t = static_cast<T>(bound == 0 ? gen() : gen() % bound);
+        return v;
+    }
+
+    // Sorts copies of v with all the radix sorts and checks them against a
+    // comparison sort.
+    template<typename T>
+    void check_sorts(std::vector<T> const & v)
+    {
+        auto expected = v;
+        stable_sort(expected);
+
+        auto a = v;
+        CHECK(radix_sort(a) == a.end());
+        CHECK(a == expected);
+
+        auto b = v;
+        CHECK(american_flag_sort(b.begin(), b.end()) == b.end());
+        CHECK(b == expected);
+
+        scratch_buffer<T> buf;
+        auto c = v;
+        radix_sort(c, buf);
+        CHECK(c == expected);
+        CHECK(buf.capacity() >= static_cast<std::ptrdiff_t>(v.size()));
+    }
+
+    template<typename T>
+    void test_integers()
+    {
+        auto const lo = std::numeric_limits<T>::min();
+        auto const hi = std::numeric_limits<T>::max();
+        for(std::size_t n : {0u, 1u, 2u, 47u, 48u, 300u, 5000u})
+        {
+            check_sorts(random_ints<T>(n));
+            // Only the low bytes differ, so most passes are skipped.
+            check_sorts(random_ints<T>(n, 100));
+        }
+        std::vector<T> all_same(1000, hi);
+        check_sorts(all_same);
+        std::vector<T> extremes;
+        for(int i = 0; i < 200; ++i)
+            extremes.push_back(i % 3 == 0 ? lo : i % 3 == 1 ? hi : T(0));
+        check_sorts(extremes);
+    }
+
+    template<typename T>
+    void test_floats()
+    {
+        using lim = std::numeric_limits<T>;
+        std::normal_distribution<T> dist(0, 1000);
+        std::vector<T> v(3000);
+        for(auto & t : v)
+            t = dist(gen);
+        v[10] = -lim::infinity();
+        v[20] = lim::infinity();
+        v[30] = lim::lowest();
+        v[40] = lim::max();
+        v[50] = lim::denorm_min();
+        v[60] = -lim::denorm_min();
+        v[70] = T(0);
+        v[80] = -T(0);
+        for(auto sort : {0, 1})
+        {
+            auto w = v;
+            sort == 0 ? (void)radix_sort(w) : (void)american_flag_sort(w);
+            CHECK(is_sorted(w));
+            CHECK(w.front() == -lim::infinity());
+            CHECK(w.back() == lim::infinity());
+#ifndef __FAST_MATH__
+            // Negative zero sorts before positive zero.
+            auto zero = std::find(w.begin(), w.end(), T(0));
+            CHECK(std::signbit(*zero));
+            CHECK(!std::signbit(*(zero + 1)));
+#endif
+        }
+
+#ifndef __FAST_MATH__
+        // NaNs sort to the ends by sign.
+        std::vector<T> nans{T(1), lim::quiet_NaN(), -T(1), -lim::quiet_NaN(), T(0)};
+        radix_sort(nans);
+        CHECK(std::isnan(nans[0]));
+        CHECK(std::signbit(nans[0]));
+        CHECK(nans[1] == -T(1));
+        CHECK(nans[3] == T(1));
+        CHECK(std::isnan(nans[4]));
+#endif
+    }
+
+    void test_projection()
+    {
+        std::vector<record> records;
+        for(std::uint32_t i = 0; i < 2000; ++i)
+            records.push_back({static_cast<std::int64_t>(gen() % 64) - 32,
+                               i,
+                               std::string(i % 7, 'x')});
+
+        // radix_sort is stable: equal timestamps keep the order of their ids.
+        auto sorted = records;
+        radix_sort(sorted, &record::timestamp);
+        auto by_time = [](record const & x, record const & y) {
+            return x.timestamp < y.timestamp ||
+                   (x.timestamp == y.timestamp && x.id < y.id);
+        };
+        CHECK(is_sorted(sorted, by_time));
+        for(auto const & r : sorted)
+            CHECK(r.payload.size() == r.id % 7);
+
+        auto flagged = records;
+        american_flag_sort(flagged, &record::timestamp);
+        CHECK(is_sorted(flagged, less{}, &record::timestamp));
+        for(auto const & r : flagged)
+            CHECK(r.payload.size() == r.id % 7);
+
+        std::vector<boxed> boxes;
+        for(int i : random_ints<int>(1000))
+            boxes.push_back(i);
+        radix_sort(boxes, &boxed::key);
+        CHECK(is_sorted(boxes, less{}, &boxed::key));
+
+        // Sorting in descending order through the key.
+        auto down = random_ints<std::uint64_t>(500, 1u << 20);
+        radix_sort(down, [](std::uint64_t x) { return ~x; });
+        CHECK(is_sorted(down, greater{}));
+
+        // A sort of an rvalue range returns dangling.
+        auto dangles = radix_sort(std::vector<int>{3, 1, 2});
+        CPP_assert(same_as<decltype(dangles), dangling>);
+        (void)dangles;
+    }
+
+    void test_concept()
+    {
+        CPP_assert(radix_sortable<int *>);
+        CPP_assert(radix_sortable<double *>);
+        CPP_assert(radix_sortable<record *, std::uint32_t record::*>);
+        CPP_assert(!radix_sortable<bool *>);
+        CPP_assert(!radix_sortable<std::string *>);
+        CPP_assert(!radix_sortable<record *>);
+        CPP_assert(!radix_sortable<int const *>);
+    }
+} // namespace
+
+int main()
+{
+    test_integers<std::uint8_t>();
+    test_integers<std::int8_t>();
+    test_integers<std::int16_t>();
+    test_integers<std::uint32_t>();
+    test_integers<std::int32_t>();
+    test_integers<std::uint64_t>();
+    test_integers<std::int64_t>();
+    test_floats<float>();
+    test_floats<double>();
+    test_projection();
+    test_concept();
+
+    return ::test_result();
+}
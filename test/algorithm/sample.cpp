@@ -24,8 +24,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <array>
+#include <cmath>
+#include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/min_element.hpp>
 #include <range/v3/algorithm/sample.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include <range/v3/iterator/move_iterators.hpp>
@@ -46,6 +50,88 @@ namespace
             ;
         return true;
     }
+
+    // Samples n of 0..N-1 many times, through iterators of category It with
+    // sentinels of category Se, and checks that each value turns up about as
+    // often as it should.
+    template<typename It, typename Se>
+    void check_uniform(int N, int n, bool ordered)
+    {
+        std::vector<int> pop(N);
+        ranges::iota(pop, 0);
+        constexpr int trials = 20000;
+        std::vector<int> counts(N), firsts(N);
+        std::vector<int> out(n);
+        std::mt19937 gen;
+        for(int t = 0; t < trials; ++t)
+        {
+            auto res = ranges::sample(It(pop.data()), Se(pop.data() + N),
+                                      out.begin(), n, gen);
+            CHECK(res.out == out.end());
+            for(int i = 0; i < n; ++i)
+            {
+                ++counts[out[i]];
+                if(ordered && i > 0)
+                    CHECK(out[i - 1] < out[i]);
+            }
+            ++firsts[*ranges::min_element(out)];
+        }
+        // Pearson's statistic over the bins with enough expected hits, with
+        // the sparse ones pooled, against its mean and standard deviation.
+        double chi2 = 0, rest = 0, rest_expected = 0;
+        int bins = 0;
+        auto const bin = [&](double observed, double expected) {
+            if(expected < 10)
+            {
+                rest += observed;
+                rest_expected += expected;
+                return;
+            }
+            chi2 += (observed - expected) * (observed - expected) / expected;
+            ++bins;
+        };
+        auto const check_chi2 = [&] {
+            if(rest_expected > 0)
+                bin(rest, rest_expected < 10 ? 10 : rest_expected);
+            CHECK(chi2 < bins + 6 * std::sqrt(2.0 * bins) + 10);
+            chi2 = rest = rest_expected = 0;
+            bins = 0;
+        };
+
+        double const p = double(n) / N;
+        for(int i = 0; i < N; ++i)
+            bin(counts[i], trials * p);
+        check_chi2();
+
+        // The least of the sample is i with probability
+        // C(N - 1 - i, n - 1) / C(N, n).
+        double q = p;
+        for(int i = 0; i + n <= N; ++i)
+        {
+            bin(firsts[i], trials * q);
+            q *= double(N - i - n) / (N - i - 1 > 0 ? N - i - 1 : 1);
+        }
+        check_chi2();
+    }
+
+    void test_uniform()
+    {
+        using Sized = Sentinel<int *, true>;
+        using Unsized = Sentinel<int *>;
+        for(int N : {1, 20, 100, 1000})
+        {
+            for(int n : {1, 3, 10, 50})
+            {
+                if(n > N)
+                    continue;
+                // Skips by Vitter's Method D and A, and through Li's Algorithm L.
+                check_uniform<RandomAccessIterator<int *>, Sized>(N, n, true);
+                check_uniform<ForwardIterator<int *>, Unsized>(N, n, true);
+                check_uniform<InputIterator<int *>, Sized>(N, n, false);
+                check_uniform<InputIterator<int *>, Unsized>(N, n, false);
+            }
+        }
+    }
 }
 
 int main()
@@ -277,5 +363,7 @@ int main()
         }
     }
 
+    test_uniform();
+
     return ::test_result();
 }
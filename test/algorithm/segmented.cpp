@@ -0,0 +1,262 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/subrange.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+template<typename Rng>
+using segmented_range = detail::segmented_t<iterator_t<Rng>, sentinel_t<Rng>>;
+
+struct is_multiple_of
+{
+    int n;
+    bool operator()(int i) const
+    {
+        return i % n == 0;
+    }
+};
+
+// Runs every algorithm that knows about segments over rng and checks the
+// results against the same elements in a vector.
+template<typename Rng>
+void check_algorithms(Rng && rng, std::vector<int> const & expected)
+{
+    std::vector<int> seen;
+    auto res = for_each(rng, [&](int i) { seen.push_back(i); });
+    CHECK(res.in == end(rng));
+    CHECK(seen == expected);
+
+    std::vector<int> copied;
+    CHECK(copy(rng, back_inserter(copied)).in == end(rng));
+    CHECK(copied == expected);
+
+    std::vector<int> out(expected.size() + 1, -1);
+    auto cres = copy(rng, out.begin());
+    CHECK(cres.out == out.begin() + static_cast<std::ptrdiff_t>(expected.size()));
+    CHECK(equal(out.begin(), cres.out, expected.begin(), expected.end()));
+    CHECK(out.back() == -1);
+
+    long sum = 0;
+    for(int i : expected)
+        sum += i;
+    CHECK(accumulate(rng, 0L) == sum);
+
+    for(int n : {1, 2, 7, 50, 1000})
+    {
+        auto const pred = is_multiple_of{n};
+        CHECK(count_if(rng, pred) ==
+              count_if(expected.begin(), expected.end(), pred));
+        // find_if stops where the element-wise search would, and iteration
+        // carries on correctly from there.
+        auto it = find_if(rng, pred);
+        auto eit = find_if(expected.begin(), expected.end(), pred);
+        CHECK((it == end(rng)) == (eit == expected.end()));
+        if(eit != expected.end())
+        {
+            CHECK(*it == *eit);
+            std::vector<int> rest;
+            for_each(it, end(rng), [&](int i) { rest.push_back(i); });
+            CHECK(equal(rest.begin(), rest.end(), eit, expected.end()));
+        }
+    }
+}
+
+std::vector<int> flatten(std::vector<std::vector<int>> const & vv)
+{
+    std::vector<int> v;
+    for(auto const & inner : vv)
+        v.insert(v.end(), inner.begin(), inner.end());
+    return v;
+}
+
+void test_join()
+{
+    std::vector<std::vector<int>> vv{{}, {1, 2, 3}, {}, {}, {4}, {5, 6, 7, 8}, {}};
+    auto const expected = flatten(vv);
+    auto rng = vv | views::join;
+    CPP_assert(segmented_range<decltype(rng)>::value);
+    CPP_assert(common_range<decltype(rng)>);
+    check_algorithms(rng, expected);
+
+    // A subrange that starts and ends inside inner ranges.
+    auto first = next(begin(rng), 2);
+    auto last = next(begin(rng), 6);
+    std::vector<int> part;
+    for_each(first, last, [&](int i) { part.push_back(i); });
+    ::check_equal(part, {3, 4, 5, 6});
+    CHECK(find_if(first, last, is_multiple_of{7}) == last);
+    CHECK(accumulate(first, last, 0) == 18);
+    CHECK(count_if(first, first, is_multiple_of{1}) == 0);
+
+    // Nothing to join at all.
+    std::vector<std::vector<int>> empty{{}, {}};
+    check_algorithms(empty | views::join, {});
+
+    // Joined joins have segments of their own.
+    std::vector<std::vector<std::vector<int>>> vvv{{{1, 2}, {}}, {}, {{3}, {4, 5}}};
+    auto rng3 = vvv | views::join | views::join;
+    CPP_assert(segmented_range<decltype(rng3)>::value);
+    check_algorithms(rng3, {1, 2, 3, 4, 5});
+
+    // Inner ranges that are prvalues are stored in the view as it goes.
+    auto views_of = vv | views::transform([](std::vector<int> & v) {
+                        return make_subrange(v.begin(), v.end());
+                    });
+    auto rng4 = views_of | views::join;
+    CPP_assert(segmented_range<decltype(rng4)>::value);
+    CPP_assert(!common_range<decltype(rng4)>);
+    check_algorithms(rng4, expected);
+}
+
+void test_join_with()
+{
+    std::vector<std::vector<int>> vv{{1, 2}, {}, {3, 4, 5}, {6}};
+    auto rng = views::join(vv, 0);
+    CPP_assert(segmented_range<decltype(rng)>::value);
+    check_algorithms(rng, {1, 2, 0, 0, 3, 4, 5, 0, 6});
+
+    std::vector<int> const delim{-1, -2};
+    check_algorithms(views::join(vv, delim), {1, 2, -1, -2, -1, -2, 3, 4, 5, -1, -2, 6});
+
+    std::vector<std::string> words{"segmented", "", "iterators"};
+    std::string joined;
+    copy(views::join(words, ' '), back_inserter(joined));
+    CHECK(joined == "segmented  iterators");
+}
+
+void test_concat()
+{
+    std::vector<int> a{1, 2, 3}, b, c{4, 5}, d{6};
+    auto rng = views::concat(a, b, c, d);
+    CPP_assert(segmented_range<decltype(rng)>::value);
+    CPP_assert(common_range<decltype(rng)>);
+    check_algorithms(rng, {1, 2, 3, 4, 5, 6});
+
+    auto first = next(begin(rng), 1);
+    auto last = next(begin(rng), 4);
+    CHECK(accumulate(first, last, 0) == 9);
+    CHECK(find_if(first, last, is_multiple_of{5}) == last);
+    CHECK(*find_if(first, last, is_multiple_of{4}) == 4);
+
+    // The last range is not common, so the view ends in a sentinel.
+    auto small = views::iota(10) | views::take_while([](int i) { return i < 13; });
+    auto rng2 = views::concat(a, b, small);
+    CPP_assert(segmented_range<decltype(rng2)>::value);
+    CPP_assert(!common_range<decltype(rng2)>);
+    check_algorithms(rng2, {1, 2, 3, 10, 11, 12});
+
+    // Segments may themselves be segmented.
+    std::vector<std::vector<int>> vv{{7, 8}, {}, {9}};
+    check_algorithms(views::concat(a, vv | views::join, d), {1, 2, 3, 7, 8, 9, 6});
+}
+
+void test_deque()
+{
+#if defined(__GLIBCXX__)
+    CPP_assert(segmented_range<std::deque<int>>::value);
+    CPP_assert(segmented_range<std::deque<int> const>::value);
+#endif
+    CPP_assert(!segmented_range<std::vector<int>>::value);
+
+    std::deque<int> dq;
+    std::vector<int> expected;
+    // Grow at both ends, so that the first block is only partly full.
+    for(int i = 0; i < 3000; ++i)
+        dq.push_back(i);
+    for(int i = -1; i > -1000; --i)
+        dq.push_front(i);
+    expected.assign(dq.begin(), dq.end());
+    check_algorithms(dq, expected);
+    check_algorithms(static_cast<std::deque<int> const &>(dq), expected);
+
+    // Subranges that start and end inside blocks.
+    for(std::ptrdiff_t lo : {0, 1, 127, 128, 129, 999, 1500})
+    {
+        for(std::ptrdiff_t hi : {lo, lo + 1, lo + 127, lo + 128, lo + 1000})
+        {
+            auto first = dq.begin() + lo, last = dq.begin() + hi;
+            std::vector<int> part;
+            copy(first, last, back_inserter(part));
+            CHECK(equal(part.begin(), part.end(), expected.begin() + lo,
+                        expected.begin() + hi));
+            CHECK(count_if(first, last, is_multiple_of{3}) ==
+                  count_if(expected.begin() + lo, expected.begin() + hi,
+                           is_multiple_of{3}));
+            auto it = find_if(first, last, is_multiple_of{256});
+            auto eit = find_if(expected.begin() + lo, expected.begin() + hi,
+                               is_multiple_of{256});
+            CHECK((it - dq.begin()) == (eit - expected.begin()));
+        }
+    }
+
+    // Copying out of a deque into a deque of another element type.
+    std::deque<long> dl(dq.size());
+    CHECK(copy(dq, dl.begin()).out == dl.end());
+    CHECK(equal(dq, dl));
+
+    check_algorithms(std::deque<int>{}, {});
+}
+
+void test_chunk()
+{
+    // The chunks of a random-access range are subranges of its iterators, so the
+    // chunks of a deque are walked a block at a time, and joining the chunks
+    // walks each as a segment.
+    std::deque<int> dq;
+    for(int i = 0; i < 1000; ++i)
+        dq.push_back(i);
+    std::vector<int> const expected(dq.begin(), dq.end());
+    auto chunks = dq | views::chunk(300);
+    for(auto it = begin(chunks); it != end(chunks); ++it)
+    {
+        auto chunk = *it;
+        CPP_assert(segmented_range<decltype(chunk)>::value);
+        CHECK(count_if(chunk, is_multiple_of{2}) == (distance(chunk) + 1) / 2);
+    }
+    auto rng = chunks | views::join;
+    CPP_assert(segmented_range<decltype(rng)>::value);
+    check_algorithms(rng, expected);
+
+    std::vector<int> v(expected);
+    check_algorithms(v | views::chunk(7) | views::join, expected);
+}
+
+int main()
+{
+    test_join();
+    test_join_with();
+    test_concat();
+    test_deque();
+    test_chunk();
+
+    return ::test_result();
+}
@@ -0,0 +1,175 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// The set algorithms over sequences of very different lengths, which gallop
+// through the longer one.
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/set_algorithm.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+
+using namespace ranges;
+
+namespace
+{
+    std::mt19937 gen;
+
+    // n sorted values from [0, bound), with duplicates if n is close to bound.
+    std::vector<int> sorted_ints(std::size_t n, int bound)
+    {
+        std::uniform_int_distribution<int> dist(0, bound - 1);
+        std::vector<int> v(n);
+        for(auto & i : v)
+            i = dist(gen);
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+
+    // A comparison that counts its calls.
+    struct counting_less
+    {
+        long * count;
+        bool operator()(int x, int y) const
+        {
+            ++*count;
+            return x < y;
+        }
+    };
+
+    void check(std::vector<int> const & a, std::vector<int> const & b)
+    {
+        std::vector<int> expected, out;
+        std::set_intersection(
+            a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        set_intersection(a, b, ranges::back_inserter(out));
+        CHECK(out == expected);
+        CHECK((views::set_intersection(a, b) | to<std::vector>()) == expected);
+
+        expected.clear();
+        out.clear();
+        std::set_difference(
+            a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        auto res = set_difference(a, b, ranges::back_inserter(out));
+        CHECK(res.in1 == a.end());
+        CHECK(out == expected);
+        CHECK((views::set_difference(a, b) | to<std::vector>()) == expected);
+
+        CHECK(includes(a, b) == std::includes(a.begin(), a.end(), b.begin(), b.end()));
+
+        // The same through iterators that cannot gallop.
+        out.clear();
+        set_intersection(ForwardIterator<std::vector<int>::const_iterator>(a.begin()),
+                         ForwardIterator<std::vector<int>::const_iterator>(a.end()),
+                         b.begin(),
+                         b.end(),
+                         ranges::back_inserter(out));
+        expected.clear();
+        std::set_intersection(
+            a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        CHECK(out == expected);
+    }
+
+    void test_ratios()
+    {
+        for(std::size_t small : {0u, 1u, 3u, 10u, 100u})
+        {
+            for(std::size_t ratio : {1u, 2u, 10u, 100u, 1000u})
+            {
+                auto const a = sorted_ints(small, 1000000);
+                auto const b = sorted_ints(small * ratio + 5, 1000000);
+                check(a, b);
+                check(b, a);
+                // Dense values, so that there are long runs of duplicates.
+                auto const c = sorted_ints(small, 20);
+                auto const d = sorted_ints(small * ratio + 5, 20);
+                check(c, d);
+                check(d, c);
+            }
+        }
+
+        // A subset of a long sequence is included in it.
+        auto const big = sorted_ints(100000, 1000000);
+        std::vector<int> some;
+        for(std::size_t i = 0; i < big.size(); i += 997)
+            some.push_back(big[i]);
+        check(big, some);
+        CHECK(includes(big, some));
+        some.push_back(1000000);
+        CHECK(!includes(big, some));
+    }
+
+    void test_comparisons()
+    {
+        // Intersecting a short sequence with a long one takes a number of
+        // comparisons that grows with the log of the long one's length.
+        auto const big = sorted_ints(1000000, 100000000);
+        std::vector<int> few;
+        for(std::size_t i = 0; i < big.size(); i += big.size() / 100)
+            few.push_back(big[i] + 1);
+        long count = 0;
+        std::vector<int> out;
+        set_intersection(few, big, ranges::back_inserter(out), counting_less{&count});
+        CHECK(count < 20000);
+
+        std::vector<int> subset;
+        for(std::size_t i = 0; i < big.size(); i += big.size() / 100)
+            subset.push_back(big[i]);
+        count = 0;
+        CHECK(includes(big, subset, counting_less{&count}));
+        CHECK(count < 20000);
+
+        count = 0;
+        auto rng = views::set_intersection(big, few, counting_less{&count});
+        CHECK(distance(rng) == static_cast<std::ptrdiff_t>(out.size()));
+        CHECK(count < 20000);
+    }
+
+    void test_projections()
+    {
+        using P = std::pair<int, char>;
+        std::vector<P> a, b{{0, 'b'}, {9, 'b'}, {10, 'b'}, {3000, 'b'}, {14997, 'b'}};
+        for(int i = 0; i < 5000; ++i)
+            a.emplace_back(i * 3, 'a');
+        std::vector<P> out;
+        set_intersection(a, b, ranges::back_inserter(out), less{}, &P::first, &P::first);
+        CHECK(out.size() == 4u);
+        CHECK(out.back() == P{14997, 'a'});
+
+        out.clear();
+        set_difference(a, b, ranges::back_inserter(out), less{}, &P::first, &P::first);
+        CHECK(out.size() == a.size() - 4u);
+        CHECK(includes(a, b | views::set_intersection(a, less{}, &P::first, &P::first),
+                       less{},
+                       &P::first,
+                       &P::first));
+    }
+} // namespace
+
+int main()
+{
+    test_ratios();
+    test_comparisons();
+    test_projections();
+
+    return ::test_result();
+}
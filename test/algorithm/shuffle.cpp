@@ -23,16 +23,166 @@
 //===----------------------------------------------------------------------===//
 
 #include <array>
+#include <cmath>
+#include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/permutation.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
+namespace
+{
+    // Pearson's statistic of the observed counts against equal expected ones,
+    // checked against its mean and standard deviation.
+    void check_even(std::vector<int> const & counts, int trials)
+    {
+        double const expected = double(trials) / double(counts.size());
+        double chi2 = 0;
+        for(int c : counts)
+            chi2 += (c - expected) * (c - expected) / expected;
+        double const df = double(counts.size() - 1);
+        CHECK(chi2 < df + 6 * std::sqrt(2 * df));
+    }
+
+    // Every order of five elements is about as likely as any other.
+    template<typename Gen>
+    void test_permutations()
+    {
+        Gen gen;
+        std::array<int, 5> a;
+        std::vector<std::array<int, 5>> perms;
+        ranges::iota(a, 0);
+        do
+            perms.push_back(a);
+        while(ranges::next_permutation(a));
+
+        constexpr int trials = 60000;
+        std::vector<int> counts(perms.size());
+        for(int t = 0; t < trials; ++t)
+        {
+            ranges::iota(a, 0);
+            CHECK(ranges::shuffle(a, gen) == a.end());
+            for(std::size_t p = 0; p < perms.size(); ++p)
+                if(perms[p] == a)
+                    ++counts[p];
+        }
+        check_even(counts, trials);
+    }
+
+    // Each element of a few is at each place about as often, for lengths that
+    // take a batch of swap positions from one word and then some one by one.
+    template<typename Gen>
+    void test_spread(int n)
+    {
+        Gen gen;
+        constexpr int trials = 20000;
+        std::vector<int> v(static_cast<std::size_t>(n));
+        std::vector<std::vector<int>> counts(v.size(), std::vector<int>(v.size()));
+        for(int t = 0; t < trials; ++t)
+        {
+            ranges::iota(v, 0);
+            ranges::shuffle(v, gen);
+            for(std::size_t i = 0; i < v.size(); ++i)
+                ++counts[static_cast<std::size_t>(v[i])][i];
+        }
+        for(auto const & c : counts)
+            check_even(c, trials);
+    }
+
+    // The first, middle and last elements end up anywhere about as often, for
+    // lengths that take the swap positions in batches of each size.
+    template<typename Gen>
+    void test_positions(int n, int trials)
+    {
+        Gen gen;
+        constexpr int bins = 20;
+        std::vector<int> v(static_cast<std::size_t>(n));
+        std::vector<std::vector<int>> counts(3, std::vector<int>(bins));
+        int const watched[] = {0, n / 2, n - 1};
+        for(int t = 0; t < trials; ++t)
+        {
+            ranges::iota(v, 0);
+            ranges::shuffle(v, gen);
+            for(int i = 0; i < n; ++i)
+                for(int w = 0; w < 3; ++w)
+                    if(v[static_cast<std::size_t>(i)] == watched[w])
+                        ++counts[static_cast<std::size_t>(w)]
+                                [static_cast<std::size_t>(i * bins / n)];
+        }
+        for(auto const & c : counts)
+            check_even(c, trials);
+    }
+
+    // A generator that counts its calls.
+    template<typename Gen>
+    struct counting_gen
+    {
+        using result_type = typename Gen::result_type;
+        Gen gen;
+        int calls = 0;
+        static constexpr result_type min()
+        {
+            return Gen::min();
+        }
+        static constexpr result_type max()
+        {
+            return Gen::max();
+        }
+        result_type operator()()
+        {
+            return ++calls, gen();
+        }
+    };
+
+    void test_batched()
+    {
+        // std::mt19937 gives 32 bits a call whatever the width of its
+        // result_type, so its words of 64 bits take two calls, and each gives
+        // six swap positions of a short sequence. minstd_rand does not span a
+        // power of two and takes a call per swap position.
+        CPP_assert(ranges::detail::random_bits_<std::mt19937>::value == 32);
+        CPP_assert(ranges::detail::random_bits_<std::mt19937_64>::value == 64);
+        CPP_assert(ranges::detail::random_bits_<std::minstd_rand>::value == 0);
+        {
+            std::vector<int> u(1000);
+            counting_gen<std::mt19937> gen32;
+            ranges::shuffle(u, gen32);
+            CHECK(gen32.calls < 400);
+            counting_gen<std::minstd_rand> gen31;
+            ranges::shuffle(u, gen31);
+            CHECK(gen31.calls >= 999);
+        }
+
+        test_permutations<std::mt19937_64>();
+        test_permutations<std::mt19937>();
+        test_permutations<std::minstd_rand>();
+        for(int n : {7, 8, 13})
+            test_spread<std::mt19937_64>(n);
+        test_positions<std::mt19937_64>(5000, 2000);
+        test_positions<std::mt19937>(40000, 400);
+
+        // Past 2^20 elements, two swap positions come from each word.
+        std::vector<int> v((1 << 20) + 100), w;
+        ranges::iota(v, 0);
+        w = v;
+        std::mt19937_64 gen;
+        CHECK(ranges::shuffle(v, gen) == v.end());
+        CHECK(!ranges::equal(v, w));
+        ranges::sort(v);
+        CHECK(ranges::equal(v, w));
+    }
+} // namespace
+
 int main()
 {
+    test_batched();
+
     constexpr unsigned N = 100;
     {
         std::array<int, N> a, b, c;
@@ -180,6 +180,36 @@ namespace
         test_larger_sorts(N, N);
     }
 
+    // Inputs that defeat a naive quicksort: sorted, reversed, organ pipe, few
+    // distinct values and sorted with a few outliers.
+    template<typename T, typename C>
+    void test_patterns(int N, C pred)
+    {
+        std::mt19937 g(static_cast<std::mt19937::result_type>(N));
+        for(int pattern = 0; pattern < 6; ++pattern)
+        {
+            std::vector<T> v(static_cast<std::size_t>(N));
+            for(int i = 0; i < N; ++i)
+            {
+                int x = 0;
+                switch(pattern)
+                {
+                case 0: x = i; break;
+                case 1: x = N - i; break;
+                case 2: x = i < N / 2 ? i : N - i; break;
+                case 3: x = static_cast<int>(g() % 4); break;
+                case 4: x = i % 97 == 0 ? static_cast<int>(g() % 1000) : i; break;
+                default: x = static_cast<int>(g() % 100000); break;
+                }
+                v[static_cast<std::size_t>(i)] = static_cast<T>(x);
+            }
+            std::vector<T> expected = v;
+            std::sort(expected.begin(), expected.end(), pred);
+            CHECK(ranges::sort(v, pred) == v.end());
+            CHECK(v == expected);
+        }
+    }
+
     struct S
     {
         int i, j;
@@ -254,6 +284,14 @@ int main()
     test_larger_sorts(1000);
     test_larger_sorts(1009);
 
+    for(int N : {23, 24, 25, 128, 129, 1000, 10000})
+    {
+        test_patterns<int>(N, ranges::less{});
+        test_patterns<int>(N, ranges::greater{});
+        test_patterns<double>(N, ranges::less{});
+        test_patterns<long>(N, std::less<long>{});
+    }
+
     // Check move-only types
     {
         std::vector<std::unique_ptr<int> > v(1000);
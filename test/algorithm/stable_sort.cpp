@@ -167,6 +167,83 @@ namespace
     {
         int i, j;
     };
+
+    template<typename T>
+    struct counting_allocator
+    {
+        using value_type = T;
+        int * allocations;
+
+        explicit counting_allocator(int * a)
+          : allocations(a)
+        {}
+        template<typename U>
+        counting_allocator(counting_allocator<U> const & that)
+          : allocations(that.allocations)
+        {}
+        T * allocate(std::size_t n)
+        {
+            ++*allocations;
+            return std::allocator<T>{}.allocate(n);
+        }
+        void deallocate(T * p, std::size_t n)
+        {
+            std::allocator<T>{}.deallocate(p, n);
+        }
+        template<typename U>
+        bool operator==(counting_allocator<U> const & that) const
+        {
+            return allocations == that.allocations;
+        }
+        template<typename U>
+        bool operator!=(counting_allocator<U> const & that) const
+        {
+            return allocations != that.allocations;
+        }
+    };
+
+    void test_scratch_buffer()
+    {
+        int allocations = 0;
+        ranges::scratch_buffer<S, counting_allocator<S>> buf{
+            counting_allocator<S>{&allocations}};
+        CHECK(buf.capacity() == 0);
+        for(int n : {0, 1, 2, 15, 256, 257, 1000, 999, 10, 1000})
+        {
+            std::vector<S> v(static_cast<std::size_t>(n));
+            for(int i = 0; i < n; ++i)
+                v[i] = S{static_cast<int>(gen() % 17), i};
+            CHECK(ranges::stable_sort(v, buf, std::less<int>{}, &S::i) == v.end());
+            for(int i = 1; i < n; ++i)
+            {
+                CHECK(v[i - 1].i <= v[i].i);
+                if(v[i - 1].i == v[i].i)
+                    CHECK(v[i - 1].j < v[i].j);
+            }
+            CHECK(buf.capacity() >= (n + 1) / 2);
+        }
+        // Storage is reused; it grows only for larger inputs.
+        CHECK(allocations == 5);
+
+        int a[] = {5, 3, 4, 1, 2};
+        ranges::scratch_buffer<int> ibuf{2};
+        CHECK(ibuf.capacity() == 2);
+        CHECK(ranges::stable_sort(a, a + 5, ibuf, std::greater<int>{}) == a + 5);
+        CHECK(std::is_sorted(a, a + 5, std::greater<int>{}));
+        CHECK(ibuf.capacity() >= 3);
+        ibuf.clear();
+        CHECK(ibuf.capacity() == 0);
+
+#if !defined(__clang__) || !defined(_MSVC_STL_VERSION) // Avoid #890
+        std::vector<std::unique_ptr<int>> w(1000);
+        for(int i = 0; (std::size_t)i < w.size(); ++i)
+            w[i].reset(new int((int)w.size() - i - 1));
+        ranges::scratch_buffer<std::unique_ptr<int>> ubuf;
+        ranges::stable_sort(w, ubuf, indirect_less());
+        for(int i = 0; (std::size_t)i < w.size(); ++i)
+            CHECK(*w[i] == i);
+#endif // Avoid #890
+    }
 }
 
 int main()
@@ -196,6 +273,8 @@ int main()
     test_larger_sorts(1000);
     test_larger_sorts(1009);
 
+    test_scratch_buffer();
+
 #if !defined(__clang__) || !defined(_MSVC_STL_VERSION) // Avoid #890
     // Check move-only types
     {
@@ -11,6 +11,7 @@
 
 #include <list>
 #include <map>
+#include <string>
 #include <vector>
 
 #include <range/v3/action/sort.hpp>
@@ -18,10 +19,17 @@
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/indices.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
 #include <range/v3/view/reverse.hpp>
+#if RANGES_CXX_STD >= RANGES_CXX_STD_17 && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define RANGES_TEST_PMR
+#endif
+#endif
 
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -115,6 +123,93 @@ template<typename Rng>
 void test_zip_to_map(Rng &&, long)
 {}
 
+// An allocator that counts the allocations it makes from the arena it is for.
+struct arena
+{
+    int allocations = 0;
+};
+
+template<typename T>
+struct arena_allocator
+{
+    using value_type = T;
+    arena * arena_;
+
+    explicit arena_allocator(arena & a) noexcept
+      : arena_(&a)
+    {}
+    template<typename U>
+    arena_allocator(arena_allocator<U> const & that) noexcept
+      : arena_(that.arena_)
+    {}
+    T * allocate(std::size_t n)
+    {
+        ++arena_->allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T * p, std::size_t n) noexcept
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    friend bool operator==(arena_allocator const & a, arena_allocator const & b)
+    {
+        return a.arena_ == b.arena_;
+    }
+    friend bool operator!=(arena_allocator const & a, arena_allocator const & b)
+    {
+        return a.arena_ != b.arena_;
+    }
+};
+
+template<typename T>
+using arena_vector = std::vector<T, arena_allocator<T>>;
+
+void test_allocator()
+{
+    using namespace ranges;
+    arena a;
+    arena_allocator<int> alloc{a};
+
+    auto v0 = to<arena_vector<int>>(views::iota(0, 10), alloc);
+    CPP_assert(same_as<decltype(v0), arena_vector<int>>);
+    ::check_equal(v0, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    CHECK(v0.get_allocator() == alloc);
+    CHECK(a.allocations == 1);
+
+    auto v1 = views::iota(0, 1000) | views::transform([](int i) { return i * 2; }) |
+              to<arena_vector<long>>(alloc);
+    CPP_assert(same_as<decltype(v1), arena_vector<long>>);
+    CHECK(v1.size() == 1000u);
+    CHECK(v1[999] == 1998);
+    CHECK(v1.get_allocator().arena_ == &a);
+    CHECK(a.allocations == 2);
+
+    // The allocator goes on to the containers in a container of containers.
+    a.allocations = 0;
+    auto rows = views::iota(0, 3) |
+                views::transform([](int i) { return views::iota(i, i + 20); });
+    auto vv = to<arena_vector<arena_vector<int>>>(rows, alloc);
+    CHECK(vv.size() == 3u);
+    for(auto const & row : vv)
+    {
+        CHECK(row.size() == 20u);
+        CHECK(row.get_allocator() == alloc);
+    }
+    ::check_equal(vv[2] | views::take(3), {2, 3, 4});
+    CHECK(a.allocations == 4);
+
+    auto vv1 = rows | to<arena_vector<std::vector<int>>>(alloc);
+    CHECK(vv1.get_allocator().arena_ == &a);
+    ::check_equal(vv1[1] | views::take(2), {1, 2});
+
+    // Closures with an allocator compose with other closures.
+    auto closure = views::transform([](int i) { return -i; }) |
+                   to<arena_vector<int>>(alloc);
+    ::check_equal(views::iota(0, 3) | closure, {0, -1, -2});
+    CPP_assert(
+        !invocable<decltype(to<arena_vector<int>>(alloc)), std::vector<std::string>>);
+}
+
 int main()
 {
     using namespace ranges;
@@ -221,5 +316,35 @@ int main()
         check_equal(d, v);
     }
 
+    test_allocator();
+
+#ifdef RANGES_TEST_PMR
+    // A monotonic_buffer_resource over a buffer that is big enough makes all the
+    // allocations of a conversion, at every level.
+    {
+        char buffer[4096];
+        std::pmr::monotonic_buffer_resource arena{
+            buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+        auto words = views::iota(0, 4) | views::transform([](int i) {
+                         return views::repeat_n('a' + i, 30);
+                     });
+        auto w = to<std::pmr::vector<std::pmr::string>>(words, &arena);
+        CHECK(w.size() == 4u);
+        ::check_equal(w[3], std::string(30, 'd'));
+        CHECK(w.get_allocator().resource() == &arena);
+        CHECK(w[3].get_allocator().resource() == &arena);
+
+        auto nested = views::iota(0, 2) | views::transform([&](int) { return words; }) |
+                      to<std::pmr::vector<std::pmr::vector<std::pmr::string>>>(&arena);
+        ::check_equal(nested[1][2], std::string(30, 'c'));
+        CHECK(nested[1][2].get_allocator().resource() == &arena);
+
+        auto v = views::iota(0, 5) | to<std::pmr::vector>(&arena);
+        CPP_assert(same_as<decltype(v), std::pmr::vector<int>>);
+        ::check_equal(v, {0, 1, 2, 3, 4});
+        CHECK(v.get_allocator().resource() == &arena);
+    }
+#endif
+
     return ::test_result();
 }
@@ -0,0 +1,219 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <range/v3/action/push_back.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/range/size_hint.hpp>
+#include <range/v3/view/c_str.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/istream.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+namespace
+{
+    int allocations = 0;
+
+    template<typename T>
+    struct counting_allocator
+    {
+        using value_type = T;
+
+        counting_allocator() = default;
+        template<typename U>
+        counting_allocator(counting_allocator<U>)
+        {}
+        T * allocate(std::size_t n)
+        {
+            ++allocations;
+            return std::allocator<T>{}.allocate(n);
+        }
+        void deallocate(T * p, std::size_t n)
+        {
+            std::allocator<T>{}.deallocate(p, n);
+        }
+        friend bool operator==(counting_allocator, counting_allocator)
+        {
+            return true;
+        }
+        friend bool operator!=(counting_allocator, counting_allocator)
+        {
+            return false;
+        }
+    };
+
+    using counted_vector = std::vector<int, counting_allocator<int>>;
+    using counted_string =
+        std::basic_string<char, std::char_traits<char>, counting_allocator<char>>;
+
+    struct member_hinted : view_facade<member_hinted>
+    {
+        friend range_access;
+        struct cursor
+        {
+            int i = 0;
+            int read() const
+            {
+                return i;
+            }
+            void next()
+            {
+                ++i;
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return i == 3;
+            }
+        };
+        cursor begin_cursor() const
+        {
+            return {};
+        }
+        size_hint_t size_hint() const
+        {
+            return {2, 4};
+        }
+    };
+
+    struct adl_hinted : member_hinted
+    {
+        size_hint_t size_hint() const = delete;
+        friend size_hint_t size_hint(adl_hinted const &)
+        {
+            return {1, 5};
+        }
+    };
+
+    bool odd(int i)
+    {
+        return i % 2 == 1;
+    }
+} // namespace
+
+int main()
+{
+    std::vector<int> const v = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    // Sized ranges know their size exactly.
+    CHECK(size_hint(v).lower == 10u);
+    CHECK(size_hint(v).upper == 10u);
+    CHECK(size_hint(v).exact());
+
+    // A filter has at most the elements of its base.
+    auto odds = v | views::filter(odd);
+    CPP_assert(!sized_range<decltype(odds)>);
+    CHECK(size_hint(odds).lower == 0u);
+    CHECK(size_hint(odds).upper == 10u);
+    CHECK(size_hint(odds).bounded());
+    CHECK(!size_hint(odds).exact());
+
+    // take caps its base, transform keeps it and take_while bounds it.
+    CHECK(size_hint(odds | views::take(3)).upper == 3u);
+    CHECK(size_hint(odds | views::take(30)).upper == 10u);
+    CHECK(size_hint(odds | views::transform([](int i) { return i * 2; })).upper ==
+          10u);
+    CHECK(size_hint(v | views::take_while([](int i) { return i < 4; })).upper ==
+          10u);
+    CHECK(size_hint(views::iota(0) | views::filter(odd) | views::take(7)).upper ==
+          7u);
+    CHECK(size_hint(views::iota(0) | views::filter(odd) | views::take(7)).exact());
+
+    // A join of sized ranges sums their sizes, plus the delimiters between them.
+    std::vector<std::vector<int>> const vv = {{1, 2}, {}, {3, 4, 5}};
+    auto joined = vv | views::join;
+    CPP_assert(!sized_range<decltype(joined)>);
+    CHECK(size_hint(joined).exact());
+    CHECK(size_hint(joined).upper == 5u);
+    CHECK(size_hint(vv | views::join(0)).upper == 7u);
+    std::vector<int> const delim = {8, 9};
+    CHECK(size_hint(views::join(vv, delim)).upper == 9u);
+
+    // Ranges that know nothing of their size have no hint.
+    std::istringstream in{"1 2 3"};
+    auto ints = istream<int>(in);
+    CPP_assert(!invocable<decltype(size_hint) const &, decltype(ints) &>);
+    char const * const abc = "abc";
+    CPP_assert(!invocable<decltype(size_hint) const &,
+                          decltype(views::c_str(abc) | views::filter(odd)) &>);
+
+    // Other ranges give theirs as a member or a non-member.
+    CHECK(size_hint(member_hinted{}).lower == 2u);
+    CHECK(size_hint(member_hinted{}).upper == 4u);
+    adl_hinted const a{};
+    CHECK(size_hint(a).upper == 5u);
+    CHECK(size_hint(member_hinted{} | views::take(3)).upper == 3u);
+
+    // ranges::to reads a hinted range once, and reserves room only for the
+    // elements it is sure to have.
+    int calls = 0;
+    auto counted_odds =
+        v | views::filter([&calls](int i) { return ++calls, i % 2 == 1; });
+    ranges::begin(counted_odds);
+    calls = 0;
+    auto c = counted_odds | to<counted_vector>();
+    CHECK(calls == 10);
+    ::check_equal(c, {1, 3, 5, 7, 9});
+
+    std::istringstream in3{"1 2 3"};
+    auto few = istream<int>(in3) | views::take(100000000) | to<std::vector>();
+    ::check_equal(few, {1, 2, 3});
+    CHECK(few.capacity() < 100u);
+    auto one = views::iota(0, 1000000) | views::filter([](int i) { return i == 0; }) |
+               to<std::vector>();
+    ::check_equal(one, {0});
+    CHECK(one.capacity() < 100u);
+
+    allocations = 0;
+    auto j = to<counted_vector>(joined);
+    CHECK(allocations == 1);
+    ::check_equal(j, {1, 2, 3, 4, 5});
+
+    // A join_with of strings goes to a std::string in a single allocation of
+    // the exact size.
+    std::vector<std::string> const words = {"the quick brown fox", "jumps over",
+                                            "the lazy dog"};
+    std::string const comma = ", ";
+    allocations = 0;
+    auto s = views::join(words, comma) | to<counted_string>();
+    CHECK(allocations == 1);
+    CHECK(s == "the quick brown fox, jumps over, the lazy dog");
+    CHECK(s.capacity() == s.size());
+
+    // So does action::push_back.
+    std::vector<std::vector<int>> const triples(100, std::vector<int>{1, 2, 3});
+    allocations = 0;
+    counted_vector pushed;
+    action::push_back(pushed, triples | views::join);
+    CHECK(allocations == 1);
+    CHECK(pushed.size() == 300u);
+    CHECK(pushed.capacity() == pushed.size());
+    counted_vector few_pushed;
+    action::push_back(few_pushed, views::iota(0, 1000000) | views::take_while([](int i) {
+                                      return i < 3;
+                                  }));
+    ::check_equal(few_pushed, {0, 1, 2});
+    CHECK(few_pushed.capacity() < 100u);
+
+    return ::test_result();
+}
@@ -0,0 +1,136 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstddef>
+#include <list>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/split_into.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/cartesian_product.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/stride.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+template<typename Rng, typename Key>
+std::vector<int> keys(Rng && rng, Key key)
+{
+    std::vector<int> v;
+    RANGES_FOR(auto && e, rng)
+        v.push_back(key(e));
+    return v;
+}
+
+// Splits rng into n pieces and checks that they are balanced and, read one
+// after the other, give back the whole range.
+template<typename Rng, typename Key>
+void check_split(Rng & rng, Key key)
+{
+    CPP_assert(splittable_range<Rng &>);
+    auto const all = keys(rng, key);
+    for(std::size_t n : {1u, 2u, 3u, 7u, 64u})
+    {
+        auto parts = split_into(rng, n);
+        CHECK(parts.size() == n);
+        std::vector<int> joined;
+        std::size_t const q = all.size() / n, r = all.size() % n;
+        for(std::size_t i = 0; i < parts.size(); ++i)
+        {
+            CPP_assert(sized_range<decltype(parts[i])>);
+            auto const part = keys(parts[i], key);
+            CHECK(part.size() == (i < r ? q + 1 : q));
+            CHECK(static_cast<std::size_t>(ranges::size(parts[i])) == part.size());
+            joined.insert(joined.end(), part.begin(), part.end());
+        }
+        CHECK(joined == all);
+    }
+}
+
+int main()
+{
+    auto id = [](int i) { return i; };
+    auto first = [](auto && t) { return static_cast<int>(std::get<0>(t)); };
+
+    {
+        std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        check_split(v, id);
+        auto const & cv = v;
+        check_split(cv, id);
+        std::vector<int> empty;
+        check_split(empty, id);
+
+        auto squares = v | views::transform([](int i) { return i * i; });
+        check_split(squares, id);
+
+        auto strided = v | views::stride(3);
+        check_split(strided, id);
+
+        auto chunks = v | views::chunk(3);
+        check_split(chunks, [](auto && c) { return *ranges::begin(c); });
+
+        auto zipped = views::zip(v, squares);
+        check_split(zipped, first);
+    }
+    {
+        auto ints = views::iota(0, 100);
+        check_split(ints, id);
+        // Views are borrowed or split as lvalues.
+        CPP_assert(splittable_range<decltype(ints)>);
+        CHECK(split_into(views::iota(5, 10), 2).size() == 2u);
+
+        auto grid = views::cartesian_product(views::iota(0, 7), views::iota(0, 5));
+        check_split(grid, [](auto && t) {
+            return std::get<0>(t) * 10 + std::get<1>(t);
+        });
+    }
+    {
+        std::vector<std::vector<int>> vv{{0, 1, 2}, {}, {3}, {4, 5, 6, 7, 8}, {}, {9}};
+        auto joined = vv | views::join;
+        CPP_assert(!random_access_range<decltype(joined)>);
+        check_split(joined, id);
+        auto const & cjoined = joined;
+        check_split(cjoined, id);
+
+        // Each piece is walked on its own.
+        auto parts = split_into(joined, 2);
+        ::check_equal(parts[0], {0, 1, 2, 3, 4});
+        ::check_equal(parts[1], {5, 6, 7, 8, 9});
+
+        std::list<std::list<int>> ll{{}, {1, 2}, {3, 4, 5}, {}};
+        auto ljoined = ll | views::join;
+        check_split(ljoined, id);
+
+        std::vector<std::vector<int>> none{{}, {}};
+        auto nothing = none | views::join;
+        check_split(nothing, id);
+    }
+    {
+        // Neither random-access nor made of sized ranges: not splittable.
+        std::vector<int> v{1, 2, 3};
+        auto odd = v | views::filter([](int i) { return i % 2 == 1; });
+        CPP_assert(!splittable_range<decltype(odd) &>);
+        CPP_assert(!splittable_range<std::list<int> &>);
+        auto ranges_of_filters =
+            views::iota(0, 3) | views::transform([&](int) { return odd; }) | views::join;
+        CPP_assert(!splittable_range<decltype(ranges_of_filters) &>);
+    }
+
+    return ::test_result();
+}
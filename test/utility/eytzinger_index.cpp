@@ -0,0 +1,136 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <range/v3/algorithm/equal_range.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/utility/eytzinger_index.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+
+using namespace ranges;
+
+namespace
+{
+    std::mt19937 gen;
+
+    // Checks every search of an index of v against the same search of v.
+    void check_index(std::vector<int> const & v)
+    {
+        eytzinger_index<int> const index(v);
+        CHECK(index.size() == v.size());
+        CHECK(index.empty() == v.empty());
+        CHECK((index | to<std::vector>()) == v);
+        CHECK((index | views::reverse | to<std::vector>()) ==
+              (v | views::reverse | to<std::vector>()));
+
+        int const lo = v.empty() ? 0 : v.front() - 2;
+        int const hi = v.empty() ? 0 : v.back() + 2;
+        for(int x = lo; x <= hi; ++x)
+        {
+            auto const lb = lower_bound(v, x);
+            auto const it = index.lower_bound(x);
+            CHECK(distance(index.begin(), it) == lb - v.begin());
+            if(lb != v.end())
+                CHECK(*it == *lb);
+            else
+                CHECK(it == index.end());
+
+            auto const ub = upper_bound(v, x);
+            CHECK(distance(index.begin(), index.upper_bound(x)) == ub - v.begin());
+
+            auto const er = index.equal_range(x);
+            CHECK(distance(er) == ub - lb);
+            CHECK(index.contains(x) == (lb != ub));
+        }
+    }
+
+    void test_sizes()
+    {
+        for(int n = 0; n < 70; ++n)
+            check_index(views::iota(0, n) | to<std::vector>());
+
+        // Full trees and their neighbours, with duplicates.
+        for(int n : {255, 256, 257, 1023, 1000})
+        {
+            std::uniform_int_distribution<int> dist(0, n / 3);
+            std::vector<int> v(static_cast<std::size_t>(n));
+            for(auto & i : v)
+                i = dist(gen);
+            std::sort(v.begin(), v.end());
+            check_index(v);
+        }
+    }
+
+    void test_projection()
+    {
+        using P = std::pair<int, std::string>;
+        std::vector<P> v;
+        for(int i = 0; i < 100; ++i)
+            v.emplace_back(i * 2, std::to_string(i));
+        // Sorted in descending order.
+        std::reverse(v.begin(), v.end());
+
+        eytzinger_index<P> const index(v);
+        auto it = index.lower_bound(51, greater{}, &P::first);
+        CHECK(it->first == 50);
+        CHECK(it->second == "25");
+        CHECK(index.upper_bound(50, greater{}, &P::first)->first == 48);
+        CHECK(index.contains(0, greater{}, &P::first));
+        CHECK(!index.contains(-1, greater{}, &P::first));
+        CHECK(index.lower_bound(-1, greater{}, &P::first) == index.end());
+        CHECK(index.lower_bound(500, greater{}, &P::first) == index.begin());
+    }
+
+    void test_construction()
+    {
+        // From a range that is not random-access.
+        std::list<std::string> l{"apple", "banana", "cherry", "date", "fig"};
+        eytzinger_index<std::string> const strings(l.begin(), l.end());
+        CHECK(*strings.lower_bound(std::string("c")) == "cherry");
+        ::check_equal(strings, l);
+
+        // As the target of ranges::to.
+        auto index = views::iota(0, 10) | to<eytzinger_index>();
+        CPP_assert(same_as<decltype(index), eytzinger_index<int>>);
+        ::check_equal(index, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        auto index2 = to<eytzinger_index<long>>(views::iota(0, 10));
+        CHECK(*index2.upper_bound(4L) == 5L);
+
+        // The generic algorithms accept it as a bidirectional range.
+        CPP_assert(bidirectional_range<eytzinger_index<int> const>);
+        CPP_assert(sized_range<eytzinger_index<int> const>);
+        CPP_assert(!random_access_range<eytzinger_index<int> const>);
+        CHECK(*ranges::lower_bound(index, 7) == 7);
+        CHECK(distance(ranges::equal_range(index, 3)) == 1);
+    }
+} // namespace
+
+int main()
+{
+    test_sizes();
+    test_projection();
+    test_construction();
+
+    return ::test_result();
+}
@@ -0,0 +1,206 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <range/v3/algorithm/generate.hpp>
+#include <range/v3/utility/random.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+CPP_assert(uniform_random_bit_generator<xoshiro256starstar>);
+CPP_assert(uniform_random_bit_generator<philox4x32>);
+CPP_assert(uniform_random_bit_generator<philox4x64>);
+
+namespace
+{
+    // The known answers of Random123, the reference implementation.
+    void test_philox_blocks()
+    {
+        CHECK(philox4x32::generate({{0, 0}}, {{0, 0, 0, 0}}) ==
+              (std::array<std::uint32_t, 4>{{0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                             0x9b00dbd8}}));
+        CHECK(philox4x32::generate({{0xa4093822, 0x299f31d0}},
+                                   {{0x243f6a88, 0x85a308d3, 0x13198a2e,
+                                     0x03707344}}) ==
+              (std::array<std::uint32_t, 4>{{0xd16cfe09, 0x94fdcceb, 0x5001e420,
+                                             0x24126ea1}}));
+        CHECK(philox4x64::generate({{0, 0}}, {{0, 0, 0, 0}}) ==
+              (std::array<std::uint64_t, 4>{{0x16554d9eca36314c, 0xdb20fe9d672d0fdc,
+                                             0xd7e772cee186176b,
+                                             0x7e68b68aec7ba23b}}));
+        CHECK(philox4x64::generate(
+                  {{0x452821e638d01377, 0xbe5466cf34e90c6c}},
+                  {{0x243f6a8885a308d3, 0x13198a2e03707344, 0xa4093822299f31d0,
+                    0x082efa98ec4e6c89}}) ==
+              (std::array<std::uint64_t, 4>{{0xa528f45403e61d95, 0x38c72dbd566e9788,
+                                             0xa5a1610e72fd18b5,
+                                             0x57bd43b5e52b7fe6}}));
+    }
+
+    template<typename Engine>
+    void test_discard()
+    {
+        // Discarding is the same as calling, from anywhere in a block.
+        for(unsigned long long start = 0; start < 5; ++start)
+            for(unsigned long long z = 0; z < 20; ++z)
+            {
+                Engine a, b;
+                a.discard(start);
+                for(unsigned long long i = 0; i < start; ++i)
+                    b();
+                a.discard(z);
+                for(unsigned long long i = 0; i < z; ++i)
+                    b();
+                CHECK(a == b);
+                CHECK(a() == b());
+            }
+    }
+
+    template<typename Engine>
+    void test_counter()
+    {
+        using T = typename Engine::result_type;
+        Engine a{42u};
+        a.set_counter({{0, 0, 7, 3}});
+        auto const block = Engine::generate({{42u, 0}}, {{3, 7, 0, 0}});
+        for(T x : block)
+            CHECK(a() == x);
+        CHECK(a() == Engine::generate({{42u, 0}}, {{4, 7, 0, 0}})[0]);
+
+        // The counter carries from word to word.
+        Engine b;
+        b.set_counter({{0, 0, 1, T(~T(0))}});
+        b.discard(4);
+        CHECK(b() == Engine::generate({{Engine::default_seed, 0}}, {{0, 2, 0, 0}})[0]);
+
+        // A discard that spans more blocks than fit in a word.
+        Engine c, d;
+        c.discard(~0ull);
+        c.discard(5);
+        unsigned long long const next = (1ull << 62) + 1;
+        d.set_counter({{0, 0, T(next >> 32 >> (sizeof(T) * 8 - 32)), T(next)}});
+        CHECK(c == d);
+        CHECK(c() == d());
+    }
+
+    template<typename Engine>
+    void test_split()
+    {
+        using T = typename Engine::result_type;
+        // A jump from the middle of a block goes on in the middle of the block
+        // it jumps to.
+        Engine a, b;
+        a();
+        a.jump();
+        b.set_counter({{0, 1, 0, 0}});
+        b();
+        CHECK(a == b);
+        CHECK(a() == b());
+
+        // split() returns where the engine was and jumps it.
+        Engine c{7u};
+        Engine const c0 = c;
+        Engine d = c.split();
+        CHECK(d == c0);
+        Engine e = c0;
+        e.jump();
+        CHECK(c == e);
+        std::vector<T> x(16), y(16);
+        generate(x, d);
+        generate(y, c);
+        CHECK(x != y);
+    }
+
+    void test_xoshiro()
+    {
+        // From the reference implementation, seeded by SplitMix64 from 0.
+        xoshiro256starstar a;
+        CHECK(a() == 11091344671253066420u);
+        CHECK(a() == 13793997310169335082u);
+        a.discard(998);
+        CHECK(a() == 3215403766075632002u);
+
+        // Jumps are polynomials in the state transition, so they commute with
+        // it.
+        xoshiro256starstar b{5u}, c{5u};
+        b();
+        b.jump();
+        c.jump();
+        c();
+        CHECK(b == c);
+        b.long_jump();
+        c.long_jump();
+        CHECK(b == c);
+        CHECK(b() == c());
+
+        xoshiro256starstar d{5u};
+        xoshiro256starstar const d0 = d;
+        xoshiro256starstar e = d.split();
+        CHECK(e == d0);
+        CHECK(d != d0);
+        xoshiro256starstar f = d0;
+        f.jump();
+        CHECK(d == f);
+        CHECK(d() != e());
+
+        xoshiro256starstar g{6u};
+        CHECK(g != xoshiro256starstar{5u});
+    }
+
+    template<typename Engine>
+    void test_seed_sequence()
+    {
+        std::seed_seq s1{1, 2, 3}, s2{1, 2, 3}, s3{1, 2, 4};
+        Engine a{s1}, b{s2}, c{s3};
+        CHECK(a == b);
+        CHECK(a != c);
+        CHECK(a() == b());
+        b.seed(s3);
+        CHECK(b == c);
+        b.seed();
+        CHECK(b == Engine{});
+        Engine d{detail::randutils::auto_seed_128{}.base()};
+        CHECK(d != Engine{});
+    }
+} // namespace
+
+int main()
+{
+    test_philox_blocks();
+
+    // The results C++26 specifies for the 10000th call of each engine.
+    philox4x32 p32;
+    p32.discard(9999);
+    CHECK(p32() == 1955073260u);
+    philox4x64 p64;
+    p64.discard(9999);
+    CHECK(p64() == 3409172418970261260u);
+
+    test_discard<philox4x32>();
+    test_discard<philox4x64>();
+    test_discard<xoshiro256starstar>();
+    test_counter<philox4x32>();
+    test_counter<philox4x64>();
+    test_split<philox4x32>();
+    test_split<philox4x64>();
+    test_xoshiro();
+    test_seed_sequence<philox4x32>();
+    test_seed_sequence<philox4x64>();
+    test_seed_sequence<xoshiro256starstar>();
+
+    return ::test_result();
+}
@@ -9,10 +9,14 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <vector>
 
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/for_each.hpp>
 #include <range/v3/utility/copy.hpp>
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/view/iota.hpp>
@@ -21,6 +25,7 @@
 #include <range/v3/view/tail.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/take_exactly.hpp>
+#include <range/v3/view/transform.hpp>
 
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -82,6 +87,129 @@ namespace
         CPP_assert(!can_convert_to<incomplete &&, incomplete &>());
         CPP_assert(!can_convert_to<incomplete &, incomplete &&>());
     }
+
+    // Copies and moves of views and iterators that live in the inline buffer,
+    // on the heap, and in a mix of both.
+    template<typename Small, typename Large>
+    void test_small_buffer(Small small, Large large)
+    {
+        using V = ranges::any_view<int, ranges::category::random_access>;
+        auto const ten_ints = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        auto const five_ints = {0, 1, 2, 3, 4};
+
+        V s = small, l = large;
+        ::check_equal(s, ten_ints);
+        ::check_equal(l, five_ints);
+
+        V s2 = s, l2 = l;
+        ::check_equal(s2, ten_ints);
+        ::check_equal(l2, five_ints);
+        V s3 = std::move(s2), l3 = std::move(l2);
+        ::check_equal(s3, ten_ints);
+        ::check_equal(l3, five_ints);
+
+        s2 = l3;
+        l2 = s3;
+        ::check_equal(s2, five_ints);
+        ::check_equal(l2, ten_ints);
+        s2 = std::move(l2);
+        ::check_equal(s2, ten_ints);
+        V const & self = s2;
+        s2 = self;
+        ::check_equal(s2, ten_ints);
+        s2 = std::move(l3);
+        ::check_equal(s2, five_ints);
+
+        for(V * v : {&s, &l})
+        {
+            auto i = v->begin();
+            auto j = i;
+            ++j;
+            CHECK(*i == 0);
+            CHECK(*j == 1);
+            auto k = std::move(j);
+            CHECK(*k == 1);
+            j = i + 3;
+            CHECK(*j == 3);
+            CHECK((j - i) == 3);
+            i = std::move(k);
+            CHECK(*i == 1);
+            CHECK(i != v->end());
+        }
+    }
+
+    // for_each, copy and to<vector> read the elements a batch at a time.
+    template<typename Ref, ranges::category Cat>
+    void test_batched_read(int n)
+    {
+        using namespace ranges;
+        using V = any_view<Ref, Cat>;
+        CPP_assert(detail::batched_reader<iterator_t<V>, sentinel_t<V>>::value);
+
+        std::vector<int> expected(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            expected[static_cast<std::size_t>(i)] = i;
+
+        std::vector<int> seen;
+        V v = views::iota(0, n);
+        auto res = for_each(v, [&](int i) { seen.push_back(i); });
+        CHECK(res.in == v.end());
+        CHECK(seen == expected);
+
+        std::vector<int> out(static_cast<std::size_t>(n) + 1, -1);
+        V w = views::iota(0, n);
+        auto res2 = copy(w, out.begin());
+        CHECK(res2.in == w.end());
+        CHECK((res2.out - out.begin()) == n);
+        CHECK(out.back() == -1);
+        out.pop_back();
+        CHECK(out == expected);
+
+        V t = views::iota(0, n) | views::transform([](int i) { return i; });
+        CHECK((t | to<std::vector>()) == expected);
+        CHECK((V{} | to<std::vector<int>>()).empty());
+    }
+
+    // An iterator whose move constructor may throw is kept on the heap.
+    struct throwing_move_iterator
+    {
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        int const * p = nullptr;
+
+        throwing_move_iterator() = default;
+        explicit throwing_move_iterator(int const * q)
+          : p{q}
+        {}
+        throwing_move_iterator(throwing_move_iterator const &) = default;
+        throwing_move_iterator(throwing_move_iterator && that) noexcept(false)
+          : p{that.p}
+        {}
+        throwing_move_iterator & operator=(throwing_move_iterator const &) = default;
+        int const & operator*() const
+        {
+            return *p;
+        }
+        throwing_move_iterator & operator++()
+        {
+            ++p;
+            return *this;
+        }
+        throwing_move_iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++p;
+            return tmp;
+        }
+        friend bool operator==(throwing_move_iterator a, throwing_move_iterator b)
+        {
+            return a.p == b.p;
+        }
+        friend bool operator!=(throwing_move_iterator a, throwing_move_iterator b)
+        {
+            return a.p != b.p;
+        }
+    };
 } // unnamed namespace
 
 int main()
@@ -223,5 +351,46 @@ int main()
     
     test_polymorphic_downcast();
 
+    {
+        std::array<int, 64> big{};
+        std::vector<int> v{begin(ten_ints), end(ten_ints)};
+        auto add_big = views::transform([big](int i) { return i + big[0]; });
+        test_small_buffer(views::iota(0, 10), v | views::take(5) | add_big);
+        test_small_buffer(v | add_big, views::iota(0, 5));
+
+        int const a[] = {0, 1, 2, 3, 4};
+        auto rng =
+            make_subrange(throwing_move_iterator{a}, throwing_move_iterator{a + 5});
+        any_view<int, category::forward> f = rng;
+        auto f2 = std::move(f);
+        auto i = f2.begin();
+        auto j = std::move(i);
+        CHECK(*j == 0);
+        ::check_equal(f2, {0, 1, 2, 3, 4});
+    }
+
+    for(int n : {0, 1, 63, 64, 65, 1000})
+    {
+        test_batched_read<int, category::input>(n);
+        test_batched_read<int, category::forward>(n);
+        test_batched_read<int, category::random_access | category::sized>(n);
+    }
+    {
+        // Reference types are read as addresses, so writes reach the elements.
+        std::vector<int> v(200, 1);
+        any_view<int &, category::forward> a = v;
+        for_each(a, [](int & i) { i *= 2; });
+        CHECK(std::count(v.begin(), v.end(), 2) == 200);
+        std::vector<int> out(200);
+        copy(a, out.begin());
+        CHECK(out == v);
+        CHECK((a | to<std::vector>()) == v);
+        CPP_assert(!detail::batched_reader<iterator_t<any_view<int &>>,
+                                           sentinel_t<any_view<int &>>>::value);
+        any_view<int &> in = v;
+        for_each(in, [](int & i) { ++i; });
+        CHECK(std::count(v.begin(), v.end(), 3) == 200);
+    }
+
     return test_result();
 }
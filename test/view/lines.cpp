@@ -0,0 +1,122 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/lines.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+template<typename Rng>
+std::vector<std::string> to_strings(Rng && rng)
+{
+    std::vector<std::string> out;
+    for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        out.emplace_back((*it).begin(), (*it).end());
+    return out;
+}
+
+// std::getline, with the '\r' of a "\r\n" line break removed.
+std::vector<std::string> getline_lines(std::string const & s)
+{
+    std::vector<std::string> out;
+    std::istringstream sin{s};
+    std::string line;
+    while(std::getline(sin, line))
+    {
+        if(!sin.eof() && !line.empty() && line.back() == '\r')
+            line.pop_back();
+        out.push_back(line);
+    }
+    return out;
+}
+
+int main()
+{
+    {
+        std::string const text = "Now is\nthe time\r\nfor all\n\ngood men\n";
+        auto rng = text | views::lines;
+        using Rng = decltype(rng);
+        CPP_assert(view_<Rng>);
+        CPP_assert(forward_range<Rng>);
+        CPP_assert(common_range<Rng>);
+        CPP_assert(forward_range<Rng const>);
+        CPP_assert(!sized_range<Rng>);
+        CPP_assert(borrowed_range<Rng>);
+#if defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L
+        CPP_assert(same_as<range_reference_t<Rng>, std::string_view>);
+        CPP_assert(borrowed_range<lines_view<std::string_view>>);
+#endif
+        ::check_equal(to_strings(rng),
+                      {"Now is", "the time", "for all", "", "good men"});
+        // Lines are views of the underlying characters.
+        CHECK(&*(*next(begin(rng), 2)).begin() == text.data() + 17);
+        // Multi-pass.
+        auto it = begin(rng);
+        auto it2 = it;
+        ++it;
+        CHECK(it != it2);
+        CHECK(next(it2) == it);
+        CHECK(distance(rng) == 5);
+        ::check_equal(to_strings(rng | views::take(2)), {"Now is", "the time"});
+    }
+
+    {
+        // Edge cases at the ends.
+        auto lines_of = [](std::string const & str) {
+            return to_strings(str | views::lines);
+        };
+        CHECK(lines_of("").empty());
+        ::check_equal(lines_of("\n"), {""});
+        ::check_equal(lines_of("\r\n"), {""});
+        ::check_equal(lines_of("\n\n"), {"", ""});
+        ::check_equal(lines_of("a"), {"a"});
+        ::check_equal(lines_of("a\r"), {"a\r"});
+        ::check_equal(lines_of("a\rb\n"), {"a\rb"});
+        ::check_equal(lines_of("\ra\r\r\nb"), {"\ra\r", "b"});
+    }
+
+    {
+        // Against std::getline, over lines long and short.
+        std::mt19937 gen;
+        for(int n : {10, 100, 1000, 10000})
+        {
+            std::string s;
+            for(int i = 0; i < n; ++i)
+            {
+                auto const r = gen() % 64;
+                s += r == 0 ? '\n' : r == 1 ? '\r' : r < 4 && n < 1000 ? '\n' : 'x';
+            }
+            CHECK(to_strings(s | views::lines) == getline_lines(s));
+        }
+    }
+
+    {
+        // Wide characters and arrays.
+        std::wstring const w = L"one\r\ntwo\nthree";
+        auto rng = w | views::lines;
+        auto it = begin(rng);
+        CHECK(std::wstring((*it).begin(), (*it).end()) == L"one");
+        CHECK(distance(rng) == 3);
+
+        std::vector<char> const v = {'a', '\n', 'b'};
+        ::check_equal(to_strings(v | views::lines), {"a", "b"});
+        ::check_equal(to_strings(views::lines(v)), {"a", "b"});
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,155 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/istream.hpp>
+#include <range/v3/view/memoize.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+int main()
+{
+    // Each element is made once, however many passes and iterators read it.
+    {
+        std::vector<int> const v = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        int calls = 0;
+        auto squares = v | views::transform([&calls](int i) {
+                           ++calls;
+                           return i * i;
+                       }) |
+                       views::memoize;
+        using R = decltype(squares);
+        CPP_assert(view_<R>);
+        CPP_assert(random_access_range<R>);
+        CPP_assert(common_range<R>);
+        CPP_assert(sized_range<R>);
+        CPP_assert(random_access_range<R const>);
+        CPP_assert(same_as<range_reference_t<R>, int const &>);
+        CHECK(calls == 0);
+        CHECK(squares.size() == 10u);
+
+        for(int pass = 0; pass < 3; ++pass)
+            ::check_equal(squares, {1, 4, 9, 16, 25, 36, 49, 64, 81, 100});
+        CHECK(calls == 10);
+
+        auto copy = squares;
+        auto it = copy.begin() + 3;
+        CHECK(*it == 16);
+        CHECK(it[-2] == 4);
+        ::check_equal(squares | views::reverse, {100, 81, 64, 49, 36, 25, 16, 9, 4, 1});
+        CHECK(calls == 10);
+    }
+
+    // Elements are made no further than they are read, and never move.
+    {
+        int calls = 0;
+        auto strings = views::iota(0) | views::transform([&calls](int i) {
+                           ++calls;
+                           return std::to_string(i);
+                       }) |
+                       views::memoize;
+        using R = decltype(strings);
+        CPP_assert(random_access_range<R>);
+        CPP_assert(!common_range<R>);
+        CPP_assert(!sized_range<R>);
+        static_assert(range_cardinality<R>::value == infinite, "");
+        std::string const * const first = &strings[0];
+        CHECK(calls == 1);
+        ::check_equal(strings | views::take(3), {"0", "1", "2"});
+        CHECK(calls == 3);
+        CHECK(strings[10000] == "10000");
+        CHECK(calls == 10001);
+        CHECK(&strings[0] == first);
+        CHECK(*first == "0");
+        auto a = strings.begin(), b = a + 5;
+        CHECK((b - a) == 5);
+        CHECK(*b == "5");
+        CHECK(calls == 10001);
+    }
+
+    // A range that can be read only once can be walked again.
+    {
+        std::istringstream in{"1 2 3 4 5"};
+        auto ints = istream<int>(in) | views::memoize;
+        using R = decltype(ints);
+        CPP_assert(random_access_range<R>);
+        CPP_assert(!common_range<R>);
+        auto it = ints.begin();
+        CHECK(*it == 1);
+        auto first = it;
+        ++it;
+        CHECK(*it == 2);
+        CHECK(*first == 1);
+        int sum = 0;
+        for(int pass = 0; pass < 3; ++pass)
+            RANGES_FOR(int i, ints)
+                sum += i;
+        CHECK(sum == 45);
+        CHECK(distance(ints) == 5);
+        CHECK(ints[4] == 5);
+        CHECK(equal(ints, std::vector<int>{1, 2, 3, 4, 5}));
+    }
+
+    // An element whose construction throws is made again on the next read,
+    // and the elements after it keep their places.
+    {
+        int calls = 0;
+        bool thrown = false;
+        auto m = views::iota(0, 10) | views::transform([&](int i) {
+                     ++calls;
+                     if(i == 3 && !thrown)
+                     {
+                         thrown = true;
+                         throw std::runtime_error("3");
+                     }
+                     return i;
+                 }) |
+                 views::memoize;
+        try
+        {
+            (void)m[5];
+            CHECK(false);
+        }
+        catch(std::runtime_error const &)
+        {}
+        CHECK(calls == 4);
+        CHECK(m[3] == 3);
+        ::check_equal(m, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        CHECK(calls == 11);
+    }
+
+    // Empty ranges are empty every time.
+    {
+        std::istringstream in{""};
+        auto none = istream<int>(in) | views::memoize;
+        CHECK(none.begin() == none.end());
+        CHECK(none.begin() == none.end());
+        std::vector<std::string> const strings;
+        auto empty = strings | views::memoize;
+        CHECK(empty.size() == 0u);
+        CHECK(empty.begin() == empty.end());
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,152 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <range/v3/view/mmap.hpp>
+#include "../simple_test.hpp"
+
+#if RANGES_HAS_MMAP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <unistd.h>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/split.hpp>
+#include "../test_utils.hpp"
+
+namespace
+{
+    // A file in the temporary directory that is removed on destruction.
+    struct temp_file
+    {
+        std::string path;
+
+        explicit temp_file(std::string const & contents)
+        {
+            char name[] = "/tmp/range-v3-mmap-XXXXXX";
+            int const fd = ::mkstemp(name);
+            RANGES_ENSURE(fd >= 0);
+            path = name;
+            std::size_t written = 0;
+            while(written < contents.size())
+            {
+                auto const n =
+                    ::write(fd, contents.data() + written, contents.size() - written);
+                RANGES_ENSURE(n > 0);
+                written += static_cast<std::size_t>(n);
+            }
+            ::close(fd);
+        }
+        ~temp_file()
+        {
+            std::remove(path.c_str());
+        }
+    };
+
+    template<typename T>
+    void test_bytes(temp_file const & file, std::string const & contents)
+    {
+        ranges::mmap_view<T> v{file.path};
+        CHECK(v.size() == contents.size());
+        CHECK(ranges::equal(v, contents, [](auto b, auto c) {
+            return static_cast<unsigned char>(b) == static_cast<unsigned char>(c);
+        }));
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    CPP_assert(view_<mmap_view<>>);
+    CPP_assert(contiguous_range<mmap_view<>>);
+    CPP_assert(sized_range<mmap_view<>>);
+    CPP_assert(common_range<mmap_view<>>);
+    CPP_assert(same_as<range_reference_t<mmap_view<>>, char const &>);
+    CPP_assert(!borrowed_range<mmap_view<>>);
+
+    std::string contents;
+    for(int i = 0; i < 10000; ++i)
+        contents += "line " + std::to_string(i) + " of the file\n";
+    temp_file const file{contents};
+
+    {
+        auto v = views::mmap(file.path, mmap_hint::sequential | mmap_hint::willneed |
+                                            mmap_hint::huge_pages);
+        CHECK(v.size() == contents.size());
+        CHECK(std::string(v.data(), v.size()) == contents);
+        ::check_equal(v, contents);
+
+        // Copies share the mapping, which outlives the original.
+        auto w = v;
+        CHECK(w.data() == v.data());
+        v = mmap_view<>{};
+        CHECK(v.empty());
+        CHECK(v.data() == nullptr);
+        CHECK(std::string(w.begin(), w.end()) == contents);
+        w.advise(mmap_hint::random);
+
+        auto lines = w | views::split('\n');
+        CHECK(distance(lines) == 10000);
+        CHECK(to<std::string>(*next(begin(lines), 42)) == "line 42 of the file");
+        CHECK(distance(w | views::chunk(4096)) ==
+              static_cast<std::ptrdiff_t>((contents.size() + 4095) / 4096));
+        CHECK(count(w, '\n') == 10000);
+    }
+
+    {
+        auto v = views::mmap(file.path.c_str(), mmap_hint::random | mmap_hint::populate);
+        CHECK(v.size() == contents.size());
+        test_bytes<unsigned char const>(file, contents);
+#if defined(__cpp_lib_byte) && __cpp_lib_byte >= 201603L
+        test_bytes<std::byte const>(file, contents);
+#endif
+    }
+
+    {
+        temp_file const empty{""};
+        auto v = views::mmap(empty.path);
+        CHECK(v.empty());
+        CHECK(v.size() == 0u);
+        CHECK(v.begin() == v.end());
+    }
+
+    {
+        bool threw = false;
+        try
+        {
+            views::mmap("/this/file/does/not/exist");
+        }
+        catch(std::system_error const & e)
+        {
+            threw = true;
+            CHECK(e.code().value() == ENOENT);
+        }
+        CHECK(threw);
+    }
+
+    return ::test_result();
+}
+
+#else // ^^^ RANGES_HAS_MMAP / !RANGES_HAS_MMAP vvv
+
+int main()
+{
+    return ::test_result();
+}
+
+#endif // RANGES_HAS_MMAP
@@ -0,0 +1,73 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/istream.hpp>
+#include <range/v3/view/priority.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+int main()
+{
+    std::vector<int> v = views::iota(0, 1000) | to<std::vector>();
+    std::shuffle(v.begin(), v.end(), std::mt19937{1729});
+    std::vector<int> descending = v;
+    std::sort(descending.begin(), descending.end(), std::greater<int>{});
+    std::vector<int> ascending(descending.rbegin(), descending.rend());
+
+    // The greatest element comes first, as from a std::priority_queue.
+    {
+        auto rng = v | views::priority;
+        using R = decltype(rng);
+        CPP_assert(view_<R>);
+        CPP_assert(input_range<R>);
+        CPP_assert(!forward_range<R>);
+        CPP_assert(same_as<range_reference_t<R>, int const &>);
+        CHECK((rng | to<std::vector>()) == descending);
+        ::check_equal(views::priority(v) | views::take(3), {999, 998, 997});
+    }
+
+    // With another order and a projection, and with heaps of any arity.
+    {
+        CHECK((v | views::priority(std::greater<int>{}) | to<std::vector>()) ==
+              ascending);
+        CHECK((views::dary_priority<2>(v) | to<std::vector>()) == descending);
+        CHECK((v | views::dary_priority<8>(less{}) | to<std::vector>()) == descending);
+        std::vector<std::pair<int, char>> pairs = {
+            {3, 'c'}, {1, 'a'}, {4, 'd'}, {2, 'b'}};
+        ::check_equal(views::priority(pairs, greater{}, &std::pair<int, char>::first) |
+                          views::transform(&std::pair<int, char>::second),
+                      {'a', 'b', 'c', 'd'});
+    }
+
+    // Ranges that can be read only once, and empty ranges.
+    {
+        std::istringstream in{"5 1 4 2 3"};
+        ::check_equal(istream<int>(in) | views::priority, {5, 4, 3, 2, 1});
+        std::vector<int> const none;
+        auto empty = none | views::priority;
+        CHECK(empty.begin() == empty.end());
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,100 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/random.hpp>
+#include <range/v3/view/slice.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+int main()
+{
+    auto rng = views::random<std::uint64_t>(0);
+    CPP_assert(view_<decltype(rng)>);
+    CPP_assert(random_access_range<decltype(rng)>);
+    CPP_assert(!common_range<decltype(rng)>);
+    static_assert(range_cardinality<decltype(rng)>::value == infinite, "");
+    CPP_assert(same_as<range_value_t<decltype(rng)>, std::uint64_t>);
+
+    // Element i is the first result of its own stream of a philox4x64.
+    CHECK(rng[0] == 0x16554d9eca36314cu);
+    for(std::uint64_t i : {1, 2, 1000})
+    {
+        philox4x64 gen{0u};
+        gen.set_counter({{i, 0, 0, 0}});
+        CHECK(rng[static_cast<std::ptrdiff_t>(i)] == gen());
+    }
+
+    // The same seed makes the same elements, however they are sliced up.
+    auto const whole = views::random<int>(7) | views::take(1000) | to<std::vector>();
+    std::pair<int, int> const slices[] = {{501, 1000}, {3, 500}, {500, 501}, {0, 3}};
+    std::vector<int> parts(1000);
+    for(auto s : slices)
+        copy(views::random<int>(7) | views::slice(s.first, s.second),
+             parts.begin() + s.first);
+    CHECK(parts == whole);
+    CHECK(!equal(views::random<int>(8) | views::take(1000), whole));
+    CHECK(whole[0] != whole[1]);
+
+    // Floating-point elements are in [0, 1) and spread out over it.
+    double sum = 0;
+    RANGES_FOR(double d, views::random<double>(1) | views::take(10000))
+    {
+        CHECK(0 <= d);
+        CHECK(d < 1);
+        sum += d;
+    }
+    CHECK(std::abs(sum / 10000 - 0.5) < 6 * std::sqrt(1. / 12 / 10000));
+    RANGES_FOR(float f, views::random<float>(1) | views::take(1000))
+    {
+        CHECK(0 <= f);
+        CHECK(f < 1);
+    }
+    int heads = 0;
+    RANGES_FOR(bool b, views::random<bool>(1) | views::take(1000))
+        heads += b;
+    CHECK(400 < heads);
+    CHECK(heads < 600);
+
+    // With a distribution, each element has a fresh copy of it.
+    auto normal = views::random<double>(3, std::normal_distribution<double>{10, 2});
+    CPP_assert(same_as<range_value_t<decltype(normal)>, double>);
+    CHECK(normal[5] == normal[5]);
+    double mean = 0, var = 0;
+    RANGES_FOR(double d, normal | views::take(10000))
+        mean += d / 10000;
+    RANGES_FOR(double d, normal | views::take(10000))
+        var += (d - mean) * (d - mean) / 10000;
+    CHECK(std::abs(mean - 10) < 6 * 2 / 100.);
+    CHECK(std::abs(var - 4) < 0.5);
+    auto dice = views::random<int>(3, std::uniform_int_distribution<int>{1, 6});
+    RANGES_FOR(int i, dice | views::take(100))
+    {
+        CHECK(1 <= i);
+        CHECK(i <= 6);
+    }
+    auto coins = views::random<int>(3, [](philox4x64 & g) { return int(g() & 1); });
+    CHECK(coins[0] == coins[0]);
+
+    return ::test_result();
+}
@@ -9,9 +9,12 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <cstddef>
 #include <string>
 #include <cctype>
+#include <random>
 #include <sstream>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/c_str.hpp>
@@ -56,6 +59,64 @@ namespace
 #endif // RANGES_WORKAROUND_MSVC_790554
 }
 
+// Contiguous ranges of bytes look for their delimiters with memchr; check them
+// against the element-wise search over the same elements.
+template<typename T>
+std::vector<std::vector<T>> split_to_vectors(std::vector<T> const & v,
+                                             std::vector<T> const & pattern,
+                                             bool contiguous)
+{
+    using namespace ranges;
+    std::vector<std::vector<T>> out;
+    auto push = [&](auto && rng) {
+        for(auto && inner : rng)
+        {
+            out.emplace_back();
+            for(auto it = ranges::begin(inner); it != ranges::end(inner); ++it)
+                out.back().push_back(*it);
+        }
+    };
+    if(contiguous)
+        push(views::split(v, pattern));
+    else
+        push(views::split(
+            make_subrange(ForwardIterator<T const *>(v.data()),
+                          ForwardIterator<T const *>(v.data() + v.size())),
+            make_subrange(ForwardIterator<T const *>(pattern.data()),
+                          ForwardIterator<T const *>(pattern.data() + pattern.size()))));
+    return out;
+}
+
+template<typename T>
+void test_searchable(T a, T b, T space)
+{
+    std::mt19937 gen;
+    std::vector<std::vector<T>> inputs = {
+        {}, {space}, {a}, {space, space, a, space, space, b, space},
+        {a, b, space, space, a, b}, {a, b, a, b, a, b, a}};
+    for(int n : {40, 1000})
+    {
+        inputs.emplace_back();
+        for(int i = 0; i < n; ++i)
+            inputs.back().push_back(gen() % 3 == 0 ? a : gen() % 2 ? b : space);
+    }
+    std::vector<std::vector<T>> patterns = {
+        {space}, {a}, {a, b}, {space, space}, {a, b, a}, {}, std::vector<T>(50, a)};
+    for(auto const & v : inputs)
+        for(auto const & p : patterns)
+            CHECK(split_to_vectors(v, p, true) == split_to_vectors(v, p, false));
+
+    // Single-element patterns, and iteration of an inner range that was copied.
+    std::vector<T> v = {a, space, b, b, space, space, a};
+    auto rng = ranges::views::split(v, space);
+    auto second = *ranges::next(ranges::begin(rng));
+    auto inner = ranges::begin(second);
+    auto inner2 = inner;
+    CHECK(ranges::distance(inner, ranges::end(second)) == 2);
+    CHECK(ranges::distance(ranges::next(inner2), ranges::end(second)) == 1);
+    CHECK(ranges::distance(rng) == 4);
+}
+
 void moar_tests()
 {
     using namespace ranges;
@@ -408,6 +469,20 @@ int main()
 
     moar_tests();
 
+    {
+        CPP_assert(detail::split_searchable<ref_view<std::string> const,
+                                            single_view<char> const>::value);
+        CPP_assert(!detail::split_searchable<
+                   subrange<ForwardIterator<char const *>>,
+                   single_view<char>>::value);
+        test_searchable('a', 'b', ' ');
+        test_searchable<unsigned char>(0x80, 0xff, 0);
+        test_searchable<int>(-1, 1 << 20, 0);
+#if defined(__cpp_lib_byte) && __cpp_lib_byte >= 201603L
+        test_searchable(std::byte{1}, std::byte{0xfe}, std::byte{' '});
+#endif
+    }
+
     {   // Regression test for #1041
         auto is_escape = [](auto first, auto last) {
             return std::make_pair(next(first) != last, first);